@@ -59,6 +59,9 @@ public class FXAssetLib : ModuleRules
 				"WorkspaceMenuStructure", // <- 추가! WorkspaceMenu::GetMenuStructure()
 				"AssetRegistry",          // <- 추가! Asset Registry for dependency tracking
 				"EditorWidgets",          // <- 추가! Slate 위젯들 (SWindow 등)
+				"ImageCore",              // FImage (텍스처 채널 패킹)
+				"DirectoryWatcher",       // 공유 라이브러리 파일 변경 감지
+				"EditorSubsystem",        // UFXLibrarySubsystem (라이브러리 서비스)
 			}
 			);
 		
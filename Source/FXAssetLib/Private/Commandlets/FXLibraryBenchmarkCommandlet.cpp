@@ -0,0 +1,313 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Commandlets/FXLibraryBenchmarkCommandlet.h"
+#include "Model/FXLibraryModel.h"
+#include "Model/FXLibraryState.h"
+#include "Model/FXLibraryStorage.h"
+#include "Model/FXAssetRegistryView.h"
+#include "Model/FXFuzzyMatcher.h"
+#include "Model/FXSimilarityIndex.h"
+#include "Core/FXAssetLibConstants.h"
+
+namespace FXLibraryBenchmarkPrivate
+{
+	// 단건 추가는 매번 표시 목록 재구성/알림/스냅샷 게시가 일어나므로 일부만 측정
+	static constexpr int32 MaxSingleOps = 1000;
+
+	// 제거되어 정리 대상이 되는 항목 비율 (1/N)
+	static constexpr int32 MissingAssetInterval = 100;
+
+	// 유사 이펙트 질의 수
+	static constexpr int32 NumSimilarQueries = 100;
+
+	FSoftObjectPath MakeBenchmarkPath(int32 Index)
+	{
+		return FSoftObjectPath(FString::Printf(TEXT("/Game/FXBenchmark/P%d/NS_Bench_%d.NS_Bench_%d"), Index / 256, Index, Index));
+	}
+
+	// 복사본처럼 특징 벡터 태그를 가진 레지스트리 항목 (인덱스별로 고정된 임의 값)
+	FAssetDataTagMap MakeBenchmarkTags(int32 Index)
+	{
+		FRandomStream Random(Index);
+		FFXEffectFeatures Features;
+		for (float& Value : Features.Values)
+		{
+			Value = Random.FRand();
+		}
+
+		FAssetDataTagMap Tags;
+		Tags.Add(FFXAssetLibConstants::FeaturesMetadataTag, Features.ToTagString());
+		return Tags;
+	}
+
+	/**
+	 * 측정 구간 (소멸 시 결과 출력)
+	 */
+	struct FScopedMeasure
+	{
+		FScopedMeasure(const TCHAR* InLabel, int32 InNumEntries, int32 InNumOps)
+			: Label(InLabel)
+			, NumEntries(InNumEntries)
+			, NumOps(InNumOps)
+			, StartTime(FPlatformTime::Seconds())
+		{
+		}
+
+		~FScopedMeasure()
+		{
+			const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			const double NsPerOp = NumOps > 0 ? ElapsedMs * 1000000.0 / NumOps : 0.0;
+			UE_LOG(LogTemp, Display, TEXT("[FX Library Benchmark] %7d entries | %-24s | %8d ops | %10.3f ms | %10.1f ns/op"),
+				NumEntries, Label, NumOps, ElapsedMs, NsPerOp);
+		}
+
+		const TCHAR* Label;
+		int32 NumEntries;
+		int32 NumOps;
+		double StartTime;
+	};
+
+	void RunBenchmark(int32 NumEntries, int32 NumCategories)
+	{
+		TSharedRef<FFXInMemoryLibraryStorage> Storage = MakeShared<FFXInMemoryLibraryStorage>();
+		TSharedRef<FFXInMemoryAssetRegistryView> Registry = MakeShared<FFXInMemoryAssetRegistryView>();
+		TSharedRef<FFXLibraryState> State = MakeShared<FFXLibraryState>();
+
+		FFXLibraryModel Model(Storage, Registry);
+		Model.SetState(State);
+		Model.LoadFromSettings();
+
+		const FTopLevelAssetPath SystemClassPath(TEXT("/Script/Niagara"), TEXT("NiagaraSystem"));
+
+		// 카테고리별 항목 (라운드 로빈 분배)
+		TArray<FName> CategoryNames;
+		TArray<TArray<FSoftObjectPath>> CategoryAssets;
+		CategoryNames.Reserve(NumCategories);
+		CategoryAssets.SetNum(NumCategories);
+		for (int32 CategoryIndex = 0; CategoryIndex < NumCategories; ++CategoryIndex)
+		{
+			CategoryNames.Add(FName(*FString::Printf(TEXT("Bench_%d"), CategoryIndex)));
+		}
+
+		TArray<FSoftObjectPath> AllAssets;
+		AllAssets.Reserve(NumEntries);
+		for (int32 Index = 0; Index < NumEntries; ++Index)
+		{
+			const FSoftObjectPath AssetPath = MakeBenchmarkPath(Index);
+			AllAssets.Add(AssetPath);
+			CategoryAssets[Index % NumCategories].Add(AssetPath);
+			Registry->AddAsset(AssetPath, SystemClassPath, MakeBenchmarkTags(Index));
+		}
+
+		// 1. 일괄 추가 (카테고리당 배치 1회)
+		{
+			FScopedMeasure Measure(TEXT("Add (batch)"), NumEntries, NumEntries);
+			for (int32 CategoryIndex = 0; CategoryIndex < NumCategories; ++CategoryIndex)
+			{
+				Model.AddAssetsToCategory(CategoryNames[CategoryIndex], CategoryAssets[CategoryIndex]);
+			}
+		}
+
+		// 카테고리 트리 항목 수는 항목 추가마다 증분 유지
+		int32 NumTreeEntries = 0;
+		for (const TSharedPtr<FFXCategoryTreeNode>& RootNode : State->GetCategoryTree().GetRootNodes())
+		{
+			NumTreeEntries += RootNode->SubtreeAssetCount;
+		}
+		check(NumTreeEntries == NumEntries);
+
+		// 2. 단건 추가/제거 (선택된 카테고리에 추가: 표시 목록 재구성 포함)
+		State->SetSelectedCategory(State->FindCategory(CategoryNames[0]));
+		const int32 NumSingleOps = FMath::Min(NumEntries, MaxSingleOps);
+		TArray<FSoftObjectPath> ExtraAssets;
+		ExtraAssets.Reserve(NumSingleOps);
+		for (int32 Index = 0; Index < NumSingleOps; ++Index)
+		{
+			ExtraAssets.Add(MakeBenchmarkPath(NumEntries + Index));
+			Registry->AddAsset(ExtraAssets.Last(), SystemClassPath, MakeBenchmarkTags(NumEntries + Index));
+		}
+		{
+			FScopedMeasure Measure(TEXT("Add (single)"), NumEntries, NumSingleOps);
+			for (const FSoftObjectPath& AssetPath : ExtraAssets)
+			{
+				Model.AddAssetToCategory(CategoryNames[0], AssetPath);
+			}
+		}
+		{
+			FScopedMeasure Measure(TEXT("Remove (single)"), NumEntries, NumSingleOps);
+			for (const FSoftObjectPath& AssetPath : ExtraAssets)
+			{
+				Model.RemoveAssetFromCategory(CategoryNames[0], AssetPath);
+			}
+		}
+
+		// 3. 조회
+		int32 NumFound = 0;
+		{
+			FScopedMeasure Measure(TEXT("Lookup (registered)"), NumEntries, NumEntries);
+			for (const FSoftObjectPath& AssetPath : AllAssets)
+			{
+				NumFound += Model.IsAssetRegistered(AssetPath) ? 1 : 0;
+			}
+		}
+		{
+			FScopedMeasure Measure(TEXT("Lookup (in category)"), NumEntries, NumEntries);
+			for (int32 Index = 0; Index < NumEntries; ++Index)
+			{
+				NumFound += State->IsAssetInCategory(CategoryNames[Index % NumCategories], AllAssets[Index]) ? 1 : 0;
+			}
+		}
+		check(NumFound == NumEntries * 2);
+
+		// 4. 표시 목록 재구성 (카테고리 전환)
+		{
+			FScopedMeasure Measure(TEXT("Visible rebuild"), NumEntries, NumCategories);
+			for (const FName& CategoryName : CategoryNames)
+			{
+				State->SetSelectedCategory(State->FindCategory(CategoryName));
+			}
+		}
+
+		// 5. 검색 (입력 중인 검색어마다 역색인 조회 + 표시 목록 재구성)
+		const FString TypedName = FString::Printf(TEXT("ns_bench_%d"), NumEntries / 3);
+		TArray<FString> SearchTexts;
+		SearchTexts.Add(TEXT("bench class:niagara -cat:bench_0"));
+		SearchTexts.Add(TEXT("cat:bench_1|cat:bench_2 bench"));
+		for (int32 Length = 1; Length <= TypedName.Len(); ++Length)
+		{
+			SearchTexts.Add(TypedName.Left(Length));
+		}
+		{
+			FScopedMeasure Measure(TEXT("Search (as typed)"), NumEntries, SearchTexts.Num());
+			for (const FString& SearchText : SearchTexts)
+			{
+				State->SetSearchText(SearchText);
+			}
+		}
+		check(State->VisibleAssets.Num() > 0 && State->IsAssetInAnyCategory(*State->VisibleAssets[0]));
+		State->SetSearchText(FString());
+
+		// 6. 빠른 스폰 퍼지 매칭 (입력 중인 검색어마다, 오타 포함: 이어 쓰면 이전 후보 풀만 재검사)
+		FFXFuzzyMatcher Matcher;
+		Matcher.Reserve(NumEntries);
+		for (const FSoftObjectPath& AssetPath : AllAssets)
+		{
+			Matcher.AddCandidate(AssetPath.GetAssetName());
+		}
+		const FString TypoName = TypedName.Replace(TEXT("bench"), TEXT("bnech"));
+		TArray<FString> FuzzyTexts;
+		for (int32 Length = 1; Length <= TypedName.Len(); ++Length)
+		{
+			FuzzyTexts.Add(TypedName.Left(Length));
+		}
+		for (int32 Length = 1; Length <= TypoName.Len(); ++Length)
+		{
+			FuzzyTexts.Add(TypoName.Left(Length));
+		}
+		TArray<FFXFuzzyMatch> FuzzyMatches;
+		{
+			FScopedMeasure Measure(TEXT("Fuzzy (as typed)"), NumEntries, FuzzyTexts.Num());
+			for (const FString& FuzzyText : FuzzyTexts)
+			{
+				Matcher.Match(FuzzyText, FFXAssetLibConstants::QuickSpawnMaxResults, FuzzyMatches);
+			}
+		}
+		check(FuzzyMatches.Num() > 0 && FuzzyMatches[0].Distance <= FFXFuzzyMatcher::GetMaxErrors(TypoName.Len()));
+
+		// 7. 유사 이펙트 (기준 항목마다 전체 특징 벡터 최근접 이웃 + 표시 목록 재구성)
+		const int32 NumSimilar = FMath::Min(NumEntries, NumSimilarQueries);
+		{
+			FScopedMeasure Measure(TEXT("Similar (kNN)"), NumEntries, NumSimilar);
+			for (int32 QueryIndex = 0; QueryIndex < NumSimilar; ++QueryIndex)
+			{
+				State->SetSimilarSource(AllAssets[QueryIndex * (NumEntries / NumSimilar)]);
+			}
+		}
+		check(State->IsSimilarityActive() && *State->VisibleAssets[0] == State->GetSimilarSource());
+		check(State->VisibleAssets.Num() == FMath::Min(NumEntries, FFXAssetLibConstants::SimilarEffectsMaxResults + 1));
+		State->ClearSimilarSource();
+
+		// 8. 정리 (레지스트리에서 사라진 항목 제거)
+		int32 NumMissing = 0;
+		for (int32 Index = 0; Index < NumEntries; Index += MissingAssetInterval)
+		{
+			Registry->RemoveAsset(AllAssets[Index]);
+			NumMissing++;
+		}
+		{
+			FScopedMeasure Measure(TEXT("Cleanup invalid"), NumEntries, NumEntries);
+			const int32 NumRemoved = Model.CleanupInvalidAssets();
+			check(NumRemoved == NumMissing);
+		}
+
+		// 9. 레지스트리 변경 증분 반영 (정리와 달리 라이브러리 크기가 아닌 변경 수에 비례)
+		TArray<FFXAssetRegistryChange> RegistryChanges;
+		for (int32 Index = 1; Index < NumEntries && RegistryChanges.Num() < NumSingleOps; Index += MissingAssetInterval)
+		{
+			FFXAssetRegistryChange& Change = RegistryChanges.AddDefaulted_GetRef();
+			Change.Type = EFXAssetRegistryChange::Renamed;
+			Change.OldAssetPath = AllAssets[Index];
+			Change.AssetPath = FSoftObjectPath(AllAssets[Index].ToString().Replace(TEXT("/FXBenchmark/"), TEXT("/FXBenchmarkMoved/")));
+			AllAssets[Index] = Change.AssetPath;
+		}
+		{
+			FScopedMeasure Measure(TEXT("Registry rename (incr.)"), NumEntries, RegistryChanges.Num());
+			const int32 NumRenamed = Model.ApplyRegistryChanges(RegistryChanges);
+			check(NumRenamed == RegistryChanges.Num());
+		}
+
+		// 10. 일괄 제거 (모든 카테고리에서 절반)
+		TArray<FSoftObjectPath> HalfAssets;
+		HalfAssets.Reserve(NumEntries / 2);
+		for (int32 Index = 1; Index < NumEntries; Index += 2)
+		{
+			HalfAssets.Add(AllAssets[Index]);
+		}
+		{
+			FScopedMeasure Measure(TEXT("Remove (batch, all cats)"), NumEntries, HalfAssets.Num());
+			Model.RemoveAssetsFromCategory(NAME_None, HalfAssets);
+		}
+
+		const FFXLibraryStateMemoryStats MemoryStats = State->GetMemoryStats();
+		UE_LOG(LogTemp, Display, TEXT("[FX Library Benchmark] %7d entries | %d remaining, %.1f bytes/entry, %d storage writes marked, %d flushes, snapshot v%llu"),
+			NumEntries, MemoryStats.NumEntries, MemoryStats.GetBytesPerEntry(),
+			Storage->GetNumMarkedDirty(), Storage->GetNumFlushes(), Model.GetSnapshot()->GetVersion());
+	}
+}
+
+UFXLibraryBenchmarkCommandlet::UFXLibraryBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UFXLibraryBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace FXLibraryBenchmarkPrivate;
+
+	FString SizesParam = TEXT("1000,10000,100000");
+	FParse::Value(*Params, TEXT("Sizes="), SizesParam);
+
+	int32 NumCategories = 20;
+	FParse::Value(*Params, TEXT("Categories="), NumCategories);
+	NumCategories = FMath::Max(1, NumCategories);
+
+	TArray<FString> SizeTokens;
+	SizesParam.ParseIntoArray(SizeTokens, TEXT(","));
+
+	for (const FString& SizeToken : SizeTokens)
+	{
+		const int32 NumEntries = FCString::Atoi(*SizeToken);
+		if (NumEntries <= 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[FX Library Benchmark] Ignoring invalid size: %s"), *SizeToken);
+			continue;
+		}
+
+		RunBenchmark(NumEntries, FMath::Min(NumCategories, NumEntries));
+	}
+
+	return 0;
+}
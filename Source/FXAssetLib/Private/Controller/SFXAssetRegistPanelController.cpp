@@ -5,6 +5,13 @@
 #include "Model/FXLibraryState.h"
 #include "Utils/FXAssetOrganizer.h"
 #include "Utils/FXAssetMover.h"
+#include "Utils/FXAssetTierGenerator.h"
+#include "Utils/FXEmitterDeduplicator.h"
+#include "Utils/FXAssetReferenceCollector.h"
+#include "Utils/FXTexturePacker.h"
+#include "Materials/Material.h"
+#include "NiagaraSystem.h"
+#include "FXLibrarySettings.h"
 #include "Core/FXAssetLibConstants.h"
 
 SFXAssetRegistPanelController::SFXAssetRegistPanelController()
@@ -24,7 +31,10 @@ FReply SFXAssetRegistPanelController::OnRegisterClicked(
 	const FString& RootPath,
 	const FString& AssetName,
 	const FString& CategoryName,
-	const TArray<FAssetData>& SelectedAssets)
+	const FString& Hashtags,
+	const TArray<FAssetData>& SelectedAssets,
+	bool bGenerateCostTiers,
+	bool bReferenceOnly)
 {
 	if (!Model.IsValid())
 	{
@@ -32,8 +42,8 @@ FReply SFXAssetRegistPanelController::OnRegisterClicked(
 		return FReply::Handled();
 	}
 
-	// 유효성 검사
-	if (RootPath.IsEmpty() || AssetName.IsEmpty() || CategoryName.IsEmpty())
+	// 유효성 검사 (참조 전용 모드는 복사 경로/이름 불필요)
+	if (CategoryName.IsEmpty() || (!bReferenceOnly && (RootPath.IsEmpty() || AssetName.IsEmpty())))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Please fill in all required fields"));
 		return FReply::Handled();
@@ -56,6 +66,17 @@ FReply SFXAssetRegistPanelController::OnRegisterClicked(
 		{
 			// 원본 에셋 경로
 			FSoftObjectPath SourceAssetPath = AssetData.ToSoftObjectPath();
+
+			// 참조 전용 모드: 참조 수집/복사 없이 원본 경로를 그대로 등록
+			if (bReferenceOnly)
+			{
+				if (Model->AddReferencedAssetToCategory(*CategoryName, SourceAssetPath))
+				{
+					AddedCount++;
+					UE_LOG(LogTemp, Log, TEXT("Registered referenced asset (no copy): %s"), *SourceAssetPath.ToString());
+				}
+				continue;
+			}
 			
 			// 대상 폴더 경로 생성 (RootPath/Particles/CategoryName)
 			FString DestinationFolder = FXAssetOrganizer::GetFolderPathForAssetType(
@@ -69,15 +90,72 @@ FReply SFXAssetRegistPanelController::OnRegisterClicked(
 			}
 			
 			// 에셋과 모든 참조를 복사 (재귀적으로 Material, Texture 등도 복사)
+			TMap<FSoftObjectPath, FSoftObjectPath> ReferenceMap;
 			FSoftObjectPath CopiedAssetPath = FXAssetMover::CopyAssetWithReferences(
 				SourceAssetPath,
 				DestinationFolder,
 				AssetName,
-				RootPath
+				RootPath,
+				&ReferenceMap
 			);
 			
 			if (CopiedAssetPath.IsValid())
 			{
+				const UFXLibrarySettings* Settings = GetDefault<UFXLibrarySettings>();
+
+				// 복사된 머테리얼의 그레이스케일 마스크 채널 패킹
+				if (Settings->bPackGrayscaleTextureMasks)
+				{
+					FFXTexturePackResult PackResult;
+					for (const TPair<FSoftObjectPath, FSoftObjectPath>& Pair : ReferenceMap)
+					{
+						if (!Pair.Value.GetLongPackageName().StartsWith(RootPath))
+						{
+							continue;
+						}
+
+						if (UMaterial* CopiedMaterial = Cast<UMaterial>(Pair.Value.TryLoad()))
+						{
+							PackResult += FXTexturePacker::PackGrayscaleMasks(CopiedMaterial, RootPath);
+						}
+					}
+					UE_LOG(LogTemp, Log, TEXT("Texture packing for %s: %d packed textures, %d samplers saved, %.1f KB saved"),
+						*CopiedAssetPath.GetAssetName(), PackResult.PackedTextures, PackResult.SamplersSaved,
+						PackResult.MemoryBytesSaved / 1024.0);
+				}
+
+				// 구조가 동일한 이미터를 공유 이미터에 연결
+				if (Settings->bShareIdenticalEmitters)
+				{
+					int32 SharedCount = FXEmitterDeduplicator::ShareIdenticalEmitters(
+						Cast<UNiagaraSystem>(CopiedAssetPath.TryLoad()), RootPath);
+					UE_LOG(LogTemp, Log, TEXT("Linked %d emitters to shared library emitters: %s"),
+						SharedCount, *CopiedAssetPath.ToString());
+				}
+
+				// 비용 티어 변형 생성 (처리가 끝난 기본 복사본을 복제하여 같은 카테고리 폴더에 형제 에셋으로 저장)
+				if (bGenerateCostTiers)
+				{
+					TArray<FSoftObjectPath> TierAssets = FXAssetTierGenerator::GenerateCostTiers(
+						CopiedAssetPath,
+						DestinationFolder,
+						Settings->CostTiers
+					);
+					UE_LOG(LogTemp, Log, TEXT("Generated %d cost tier variants for: %s"),
+						TierAssets.Num(), *CopiedAssetPath.ToString());
+				}
+
+				// 등록 단위 경로 처리 통계 (레지스트리 조회 수가 복사 패키지 수에 비례하는지 확인)
+				const FFXRegistrationStats& Stats = FXAssetMover::GetLastRegistrationStats();
+				UE_LOG(LogTemp, Log, TEXT("Registration stats for %s: %d registry queries, %d copied packages"),
+					*CopiedAssetPath.GetAssetName(), Stats.RegistryQueries, Stats.CopiedPackages);
+
+				// 카테고리/해시태그를 레지스트리 태그로 기록 (라이브러리 인덱스 복구 및 FARFilter 검색용)
+				if (!FXAssetMover::WriteLibraryMetadata(CopiedAssetPath, *CategoryName, Hashtags))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("Failed to write library metadata: %s"), *CopiedAssetPath.ToString());
+				}
+
 				// 복사된 에셋을 카테고리에 추가
 				if (Model->AddAssetToCategory(*CategoryName, CopiedAssetPath))
 				{
@@ -3,6 +3,7 @@
 #include "Controller/SFXLibraryPanelController.h"
 #include "Model/FXLibraryState.h"
 #include "Model/FXLibraryModel.h"
+#include "Model/FXLibrarySubsystem.h"
 #include "Editor.h"
 #include "LevelEditor.h"
 #include "Selection.h"
@@ -13,6 +14,8 @@
 #include "IContentBrowserSingleton.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Utils/FXAssetReferenceCollector.h"
+#include "Utils/FXAssetTierGenerator.h"
+#include "Utils/FXNiagaraParameterUtils.h"
 #include "Core/FXAssetLibConstants.h"
 
 SFXLibraryPanelController::SFXLibraryPanelController()
@@ -29,12 +32,6 @@ void SFXLibraryPanelController::Initialize(
 {
 	State = InState;
 	Model = InModel;
-
-	if (Model.IsValid())
-	{
-		Model->SetState(State);
-		Model->LoadFromSettings();
-	}
 }
 
 FReply SFXLibraryPanelController::OnRefreshClicked()
@@ -119,11 +116,23 @@ FReply SFXLibraryPanelController::OnCleanupClicked()
 		return FReply::Handled();
 	}
 
-	int32 RemovedInvalidAssets = Model->CleanupInvalidAssets();
-	int32 RemovedEmptyCategories = Model->CleanupEmptyCategories();
+	// 에셋 검증은 워커 스레드에서 수행 (대형 라이브러리에서도 UI가 멈추지 않음), 빈 카테고리 정리는 결과 적용 후
+	TWeakPtr<FFXLibraryModel> WeakModel = Model;
+	const bool bStarted = Model->CleanupInvalidAssetsAsync(FOnFXCleanupComplete::CreateLambda([WeakModel](int32 RemovedInvalidAssets)
+	{
+		if (TSharedPtr<FFXLibraryModel> PinnedModel = WeakModel.Pin())
+		{
+			int32 RemovedEmptyCategories = PinnedModel->CleanupEmptyCategories();
+
+			UE_LOG(LogTemp, Warning, TEXT("Clean Up completed: Removed %d invalid assets, %d empty categories"),
+				RemovedInvalidAssets, RemovedEmptyCategories);
+		}
+	}));
 
-	UE_LOG(LogTemp, Warning, TEXT("Clean Up completed: Removed %d invalid assets, %d empty categories"), 
-		RemovedInvalidAssets, RemovedEmptyCategories);
+	if (!bStarted)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Clean Up already in progress"));
+	}
 
 	return FReply::Handled();
 }
@@ -135,14 +144,18 @@ void SFXLibraryPanelController::SpawnNiagaraActor(TSharedPtr<FSoftObjectPath> As
 		return;
 	}
 
-	// 참조된 에셋 목록 수집 (필터링된 /Game/ 하위 에셋만)
-	TArray<FReferencedAsset> ReferencedAssets = FFXAssetReferenceCollector::CollectAllReferences(*AssetPath);
+	// 변형 항목이면 기본 에셋을 스폰하고 오버라이드 적용
+	const FFXAssetVariant* Variant = State.IsValid() ? State->FindAssetVariant(*AssetPath) : nullptr;
+	SpawnNiagaraSystem(AssetPath->GetWithoutSubPath(), Variant);
+}
 
+void SFXLibraryPanelController::SpawnNiagaraSystem(const FSoftObjectPath& SystemPath, const FFXAssetVariant* Variant)
+{
 	// 1. FSoftObjectPath에서 실제 UNiagaraSystem 로드
-	UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(AssetPath->TryLoad());
+	UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(SystemPath.TryLoad());
 	if (!NiagaraSystem)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Failed to load Niagara System: %s"), *AssetPath->ToString());
+		UE_LOG(LogTemp, Warning, TEXT("Failed to load Niagara System: %s"), *SystemPath.ToString());
 		return;
 	}
 
@@ -189,6 +202,15 @@ void SFXLibraryPanelController::SpawnNiagaraActor(TSharedPtr<FSoftObjectPath> As
 		if (NiagaraComponent)
 		{
 			NiagaraComponent->SetAsset(NiagaraSystem);
+
+			// 파라미터 오버라이드 변형 적용
+			if (Variant)
+			{
+				int32 AppliedCount = FFXNiagaraParameterUtils::ApplyUserParameterOverrides(NiagaraComponent, Variant->Overrides);
+				UE_LOG(LogTemp, Log, TEXT("Applied %d parameter overrides for variant: %s"),
+					AppliedCount, *Variant->VariantName.ToString());
+			}
+
 			NiagaraComponent->Activate(true);
 
 			UE_LOG(LogTemp, Log, TEXT("Spawned Niagara Actor: %s at %s"),
@@ -202,6 +224,28 @@ void SFXLibraryPanelController::SpawnNiagaraActor(TSharedPtr<FSoftObjectPath> As
 	}
 }
 
+void SFXLibraryPanelController::SpawnNiagaraActorTier(TSharedPtr<FSoftObjectPath> AssetPath, FName TierName)
+{
+	if (!AssetPath.IsValid())
+	{
+		return;
+	}
+
+	// 티어 변형이 없으면 기본 에셋으로 스폰
+	FSoftObjectPath TierAssetPath = FXAssetTierGenerator::FindTierVariant(AssetPath->GetWithoutSubPath(), TierName);
+	if (!TierAssetPath.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Cost tier %s not found for %s, spawning base asset"),
+			*TierName.ToString(), *AssetPath->ToString());
+		SpawnNiagaraActor(AssetPath);
+		return;
+	}
+
+	// 파라미터 변형은 티어 시스템에도 같은 오버라이드 적용
+	const FFXAssetVariant* Variant = State.IsValid() ? State->FindAssetVariant(*AssetPath) : nullptr;
+	SpawnNiagaraSystem(TierAssetPath, Variant);
+}
+
 void SFXLibraryPanelController::BrowseToAsset(TSharedPtr<FSoftObjectPath> AssetPath)
 {
 	if (!AssetPath.IsValid())
@@ -209,8 +253,8 @@ void SFXLibraryPanelController::BrowseToAsset(TSharedPtr<FSoftObjectPath> AssetP
 		return;
 	}
 
-	// 에셋 로드
-	UObject* Asset = AssetPath->TryLoad();
+	// 에셋 로드 (변형 항목은 기본 에셋으로 이동)
+	UObject* Asset = AssetPath->GetWithoutSubPath().TryLoad();
 	if (!Asset)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Failed to load asset: %s"), *AssetPath->ToString());
@@ -251,6 +295,61 @@ void SFXLibraryPanelController::RemoveAssetFromLibrary(TSharedPtr<FSoftObjectPat
 	}
 }
 
+bool SFXLibraryPanelController::CreateVariantFromSelection(TSharedPtr<FSoftObjectPath> AssetPath, FName VariantName)
+{
+	if (!AssetPath.IsValid() || !State.IsValid() || !Model.IsValid() || !GEditor || VariantName.IsNone())
+	{
+		return false;
+	}
+
+	if (!State->SelectedCategory.IsValid())
+	{
+		return false;
+	}
+
+	const FSoftObjectPath BasePath = AssetPath->GetWithoutSubPath();
+
+	// 같은 나이아가라 시스템을 사용하는 선택된 컴포넌트 찾기
+	UNiagaraComponent* SourceComponent = nullptr;
+	USelection* SelectedActors = GEditor->GetSelectedActors();
+	for (FSelectionIterator It(*SelectedActors); It && !SourceComponent; ++It)
+	{
+		AActor* Actor = Cast<AActor>(*It);
+		if (!Actor)
+		{
+			continue;
+		}
+
+		TArray<UNiagaraComponent*> NiagaraComponents;
+		Actor->GetComponents<UNiagaraComponent>(NiagaraComponents);
+		for (UNiagaraComponent* NiagaraComp : NiagaraComponents)
+		{
+			if (NiagaraComp && NiagaraComp->GetAsset() && FSoftObjectPath(NiagaraComp->GetAsset()) == BasePath)
+			{
+				SourceComponent = NiagaraComp;
+				break;
+			}
+		}
+	}
+
+	if (!SourceComponent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Select a Niagara actor using %s to create a variant"), *BasePath.ToString());
+		return false;
+	}
+
+	FFXAssetVariant Variant;
+	Variant.VariantName = VariantName;
+	Variant.BasePath = BasePath;
+	if (FFXNiagaraParameterUtils::CaptureUserParameterOverrides(SourceComponent, Variant.Overrides) == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Selected actor has no modified user parameters: %s"), *SourceComponent->GetOwner()->GetActorLabel());
+		return false;
+	}
+
+	return Model->AddVariantToCategory(*State->SelectedCategory, Variant);
+}
+
 void SFXLibraryPanelController::OnCategoryChanged(TSharedPtr<FName> Category)
 {
 	if (State.IsValid())
@@ -275,3 +374,39 @@ void SFXLibraryPanelController::OnCategoryUnhovered()
 	}
 }
 
+void SFXLibraryPanelController::OnSearchTextChanged(const FText& NewText)
+{
+	if (State.IsValid())
+	{
+		State->SetSearchText(NewText.ToString());
+	}
+}
+
+void SFXLibraryPanelController::FindSimilarAssets(TSharedPtr<FSoftObjectPath> AssetPath)
+{
+	if (!State.IsValid() || !AssetPath.IsValid())
+	{
+		return;
+	}
+
+	// 백그라운드 추출 전인 항목은 기준 에셋 하나만 동기 로드해서 추출
+	if (!State->HasEffectFeatures(AssetPath->GetWithoutSubPath()))
+	{
+		UFXLibrarySubsystem* LibrarySubsystem = UFXLibrarySubsystem::Get();
+		if (!LibrarySubsystem || !LibrarySubsystem->ExtractEffectFeatures(*AssetPath))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("No effect features for similarity search: %s"), *AssetPath->ToString());
+			return;
+		}
+	}
+
+	State->SetSimilarSource(*AssetPath);
+}
+
+void SFXLibraryPanelController::ClearSimilarAssets()
+{
+	if (State.IsValid())
+	{
+		State->ClearSimilarSource();
+	}
+}
@@ -4,6 +4,9 @@
 #include "FXAssetLibEditorModeCommands.h"
 
 #include "FXLibrarySettings.h"
+#include "Model/FXLibraryWriteBehind.h"
+#include "Model/FXSharedLibrary.h"
+#include "Utils/FXAssetMover.h"
 #include "Core/FXAssetLibConstants.h"
 #include "ToolMenus.h"
 #include "ContentBrowserMenuContexts.h"
@@ -48,6 +51,11 @@ void FFXAssetLibModule::StartupModule()
         .SetGroup(WorkspaceMenu::GetMenuStructure().GetLevelEditorCategory())
         .SetIcon(FSlateIcon(FAppStyle::GetAppStyleSetName(), "LevelEditor.Tabs.Modes"));
 
+    // 라이브러리 쓰기 지연 저장 (에디터 종료 전 남은 변경 저장)
+    FFXLibraryWriteBehind::Get().Startup();
+
+    // 라이브러리 메타데이터(카테고리/해시태그/원본)를 에셋 레지스트리 태그로 노출
+    FXAssetMover::RegisterLibraryMetadataTags();
 }
 
 void FFXAssetLibModule::ShutdownModule()
@@ -55,6 +63,9 @@ void FFXAssetLibModule::ShutdownModule()
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
 
+	FFXLibraryWriteBehind::Get().Shutdown();
+	FFXSharedLibrary::Get().Shutdown();
+
 	FFXAssetLibEditorModeCommands::Unregister();
 
 	if (UToolMenus::IsToolMenuUIEnabled())
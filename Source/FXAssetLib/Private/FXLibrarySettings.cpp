@@ -6,6 +6,9 @@
 
 UFXLibrarySettings::UFXLibrarySettings()
 {
+    // 기본 비용 티어 (Config에 값이 있으면 덮어씀)
+    CostTiers.Add(FFXCostTierSettings(TEXT("Low"), 0.25f, 0.25f));
+    CostTiers.Add(FFXCostTierSettings(TEXT("Medium"), 0.5f, 0.5f));
 }
 UFXLibrarySettings::~UFXLibrarySettings()
 {
@@ -67,74 +70,76 @@ FText UFXLibrarySettings::GetSectionText() const
     return NSLOCTEXT("FXLib", "Section", "FX Library");
 }
 
-FFXCategoryData* UFXLibrarySettings::FindCategory(FName InCategoryName)
+void UFXLibrarySettings::PostReloadConfig(FProperty* PropertyThatWasLoaded)
 {
-    for (FFXCategoryData& Cat : Categories)
-    {
-        if (Cat.CategoryName == InCategoryName)
-        {
-            return &Cat;
-        }
-    }
-    return nullptr;
+    Super::PostReloadConfig(PropertyThatWasLoaded);
+
+    // ini 다시 읽기로 Categories가 통째로 바뀜
+    InvalidateCategoryIndex();
 }
 
-const FFXCategoryData* UFXLibrarySettings::FindCategory(FName InCategoryName) const
+#if WITH_EDITOR
+void UFXLibrarySettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
-    for (const FFXCategoryData& Cat : Categories)
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    // 디테일 패널에서 카테고리/에셋을 직접 수정한 경우
+    if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UFXLibrarySettings, Categories))
     {
-        if (Cat.CategoryName == InCategoryName)
-        {
-            return &Cat;
-        }
+        InvalidateCategoryIndex();
     }
-    return nullptr;
 }
 
-FFXCategoryData* UFXLibrarySettings::AddCategory(FName InCategoryName, const FSoftObjectPath& IconPath)
+void UFXLibrarySettings::PostEditUndo()
 {
-    // 이미 존재하는지 확인
-    if (FFXCategoryData* Existing = FindCategory(InCategoryName))
-    {
-        return Existing;
-    }
+    Super::PostEditUndo();
 
-    // 새 카테고리 추가
-    FFXCategoryData NewCategory(InCategoryName);
-    NewCategory.IconPath = IconPath;
+    // 트랜잭션 복원으로 Categories가 이전 상태로 돌아감 (개수가 같아도 내용이 다를 수 있음)
+    InvalidateCategoryIndex();
+}
+#endif
 
-    Categories.Add(NewCategory);
-    SaveConfig();
+FFXCategoryData* UFXLibrarySettings::FindCategory(FName InCategoryName)
+{
+    return CategoryIndex.FindCategory(Categories, InCategoryName);
+}
 
-    return &Categories.Last();
+const FFXCategoryData* UFXLibrarySettings::FindCategory(FName InCategoryName) const
+{
+    return CategoryIndex.FindCategory(Categories, InCategoryName);
 }
 
-bool UFXLibrarySettings::AddAssetToCategory(FName InCategoryName, const FSoftObjectPath& AssetPath)
+FFXCategoryData* UFXLibrarySettings::AddCategory(FName InCategoryName, const FSoftObjectPath& IconPath)
 {
-    FFXCategoryData* Category = FindCategory(InCategoryName);
-    if (!Category)
-    {
-        return false;
-    }
+    return &CategoryIndex.AddCategory(Categories, InCategoryName, IconPath);
+}
 
-    Category->Assets.AddUnique(AssetPath);
-    SaveConfig();
-    return true;
+bool UFXLibrarySettings::AddAssetToCategory(FName InCategoryName, const FSoftObjectPath& AssetPath)
+{
+    return CategoryIndex.AddAsset(Categories, InCategoryName, AssetPath);
 }
 
 int32 UFXLibrarySettings::RemoveAssetFromCategory(FName InCategoryName, const FSoftObjectPath& AssetPath)
 {
-    FFXCategoryData* Category = FindCategory(InCategoryName);
-    if (!Category)
-    {
-        return 0;
-    }
+    return CategoryIndex.RemoveAsset(Categories, InCategoryName, AssetPath);
+}
 
-    int32 Removed = Category->Assets.Remove(AssetPath);
-    if (Removed > 0)
-    {
-        SaveConfig();
-    }
-    return Removed;
+bool UFXLibrarySettings::ReplaceAssetInCategory(FName InCategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath)
+{
+    return CategoryIndex.ReplaceAsset(Categories, InCategoryName, AssetPath, NewAssetPath);
 }
 
+bool UFXLibrarySettings::RemoveCategory(FName InCategoryName)
+{
+    return CategoryIndex.RemoveCategory(Categories, InCategoryName);
+}
+
+bool UFXLibrarySettings::IsAssetInCategory(FName InCategoryName, const FSoftObjectPath& AssetPath) const
+{
+    return CategoryIndex.ContainsAsset(Categories, InCategoryName, AssetPath);
+}
+
+void UFXLibrarySettings::InvalidateCategoryIndex()
+{
+    CategoryIndex.Invalidate();
+}
@@ -0,0 +1,121 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXAssetRegistryView.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "UObject/ObjectRedirector.h"
+
+// ===== FFXEngineAssetRegistryView =====
+
+FAssetData FFXEngineAssetRegistryView::GetAssetByObjectPath(const FSoftObjectPath& ObjectPath) const
+{
+	// 메모리 상의 오브젝트 검색은 게임 스레드에서만 가능
+	return IAssetRegistry::GetChecked().GetAssetByObjectPath(ObjectPath, !IsInGameThread());
+}
+
+void FFXEngineAssetRegistryView::GetAssetsByPackageName(FName PackageName, TArray<FAssetData>& OutAssets) const
+{
+	IAssetRegistry::GetChecked().GetAssetsByPackageName(PackageName, OutAssets, true);
+}
+
+void FFXEngineAssetRegistryView::GetAssetsByObjectPaths(TConstArrayView<FSoftObjectPath> ObjectPaths, TArray<FAssetData>& OutAssets) const
+{
+	// 빈 필터는 전체 에셋을 반환하므로 조회하지 않음
+	if (ObjectPaths.Num() == 0)
+	{
+		return;
+	}
+
+	FARFilter Filter;
+	Filter.SoftObjectPaths.Append(ObjectPaths.GetData(), ObjectPaths.Num());
+
+	// 메모리 상의 오브젝트 열거는 게임 스레드에서만 가능
+	Filter.bIncludeOnlyOnDiskAssets = !IsInGameThread();
+
+	IAssetRegistry::GetChecked().GetAssets(Filter, OutAssets);
+}
+
+void FFXEngineAssetRegistryView::GetAssetsWithTag(FName PackagePath, FName TagName, TArray<FAssetData>& OutAssets) const
+{
+	FARFilter Filter;
+	Filter.PackagePaths.Add(PackagePath);
+	Filter.bRecursivePaths = true;
+	Filter.TagsAndValues.Add(TagName);
+	Filter.bIncludeOnlyOnDiskAssets = !IsInGameThread();
+
+	IAssetRegistry::GetChecked().GetAssets(Filter, OutAssets);
+}
+
+// ===== FFXInMemoryAssetRegistryView =====
+
+void FFXInMemoryAssetRegistryView::AddAsset(const FSoftObjectPath& ObjectPath, const FTopLevelAssetPath& ClassPath, FAssetDataTagMap Tags)
+{
+	const FName PackageName = ObjectPath.GetLongPackageFName();
+	const FName PackagePath = FName(*FPackageName::GetLongPackagePath(PackageName.ToString()));
+
+	RemoveAsset(ObjectPath);
+	Assets.Add(ObjectPath, FAssetData(PackageName, PackagePath, ObjectPath.GetAssetFName(), ClassPath, MoveTemp(Tags)));
+	AssetsByPackage.Add(PackageName, ObjectPath);
+}
+
+void FFXInMemoryAssetRegistryView::AddRedirector(const FSoftObjectPath& FromPath, const FSoftObjectPath& ToPath)
+{
+	const FName PackageName = FromPath.GetLongPackageFName();
+	const FName PackagePath = FName(*FPackageName::GetLongPackagePath(PackageName.ToString()));
+
+	FAssetDataTagMap Tags;
+	Tags.Add(TEXT("DestinationObject"), FString::Printf(TEXT("Object'%s'"), *ToPath.ToString()));
+
+	RemoveAsset(FromPath);
+	Assets.Add(FromPath, FAssetData(PackageName, PackagePath, FromPath.GetAssetFName(), UObjectRedirector::StaticClass()->GetClassPathName(), MoveTemp(Tags)));
+	AssetsByPackage.Add(PackageName, FromPath);
+}
+
+void FFXInMemoryAssetRegistryView::RemoveAsset(const FSoftObjectPath& ObjectPath)
+{
+	if (Assets.Remove(ObjectPath) > 0)
+	{
+		AssetsByPackage.RemoveSingle(ObjectPath.GetLongPackageFName(), ObjectPath);
+	}
+}
+
+FAssetData FFXInMemoryAssetRegistryView::GetAssetByObjectPath(const FSoftObjectPath& ObjectPath) const
+{
+	const FAssetData* AssetData = Assets.Find(ObjectPath);
+	return AssetData ? *AssetData : FAssetData();
+}
+
+void FFXInMemoryAssetRegistryView::GetAssetsByPackageName(FName PackageName, TArray<FAssetData>& OutAssets) const
+{
+	TArray<FSoftObjectPath> PackageAssets;
+	AssetsByPackage.MultiFind(PackageName, PackageAssets);
+	for (const FSoftObjectPath& ObjectPath : PackageAssets)
+	{
+		OutAssets.Add(Assets.FindChecked(ObjectPath));
+	}
+}
+
+void FFXInMemoryAssetRegistryView::GetAssetsByObjectPaths(TConstArrayView<FSoftObjectPath> ObjectPaths, TArray<FAssetData>& OutAssets) const
+{
+	for (const FSoftObjectPath& ObjectPath : ObjectPaths)
+	{
+		if (const FAssetData* AssetData = Assets.Find(ObjectPath))
+		{
+			OutAssets.Add(*AssetData);
+		}
+	}
+}
+
+void FFXInMemoryAssetRegistryView::GetAssetsWithTag(FName PackagePath, FName TagName, TArray<FAssetData>& OutAssets) const
+{
+	const FString PathPrefix = PackagePath.ToString();
+	for (const TPair<FSoftObjectPath, FAssetData>& Pair : Assets)
+	{
+		const FString AssetPackagePath = Pair.Value.PackagePath.ToString();
+		const bool bUnderPath = AssetPackagePath == PathPrefix || AssetPackagePath.StartsWith(PathPrefix + TEXT("/"));
+		if (bUnderPath && Pair.Value.FindTag(TagName))
+		{
+			OutAssets.Add(Pair.Value);
+		}
+	}
+}
@@ -0,0 +1,167 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXCategoryIndex.h"
+#include "FXLibrarySettings.h"
+
+int32 FFXCategoryIndex::FindCategoryIndex(const TArray<FFXCategoryData>& Categories, FName CategoryName) const
+{
+	if (IndexedCategoryCount != Categories.Num())
+	{
+		RebuildNameIndex(Categories);
+	}
+
+	if (const int32* Index = CategoryIndexByName.Find(CategoryName))
+	{
+		if (Categories.IsValidIndex(*Index) && Categories[*Index].CategoryName == CategoryName)
+		{
+			return *Index;
+		}
+
+		// 배열이 외부에서 수정됨 (개수는 같지만 순서/이름 변경)
+		RebuildNameIndex(Categories);
+		if (const int32* RebuiltIndex = CategoryIndexByName.Find(CategoryName))
+		{
+			return *RebuiltIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+FFXCategoryData* FFXCategoryIndex::FindCategory(TArray<FFXCategoryData>& Categories, FName CategoryName) const
+{
+	const int32 Index = FindCategoryIndex(Categories, CategoryName);
+	return Index != INDEX_NONE ? &Categories[Index] : nullptr;
+}
+
+const FFXCategoryData* FFXCategoryIndex::FindCategory(const TArray<FFXCategoryData>& Categories, FName CategoryName) const
+{
+	const int32 Index = FindCategoryIndex(Categories, CategoryName);
+	return Index != INDEX_NONE ? &Categories[Index] : nullptr;
+}
+
+FFXCategoryData& FFXCategoryIndex::AddCategory(TArray<FFXCategoryData>& Categories, FName CategoryName, const FSoftObjectPath& IconPath)
+{
+	if (FFXCategoryData* Existing = FindCategory(Categories, CategoryName))
+	{
+		return *Existing;
+	}
+
+	FFXCategoryData NewCategory(CategoryName);
+	NewCategory.IconPath = IconPath;
+
+	// 조회 직후라 색인이 배열과 맞으므로 새 항목만 추가
+	const int32 NewIndex = Categories.Add(NewCategory);
+	CategoryIndexByName.Add(CategoryName, NewIndex);
+	IndexedCategoryCount = Categories.Num();
+	return Categories[NewIndex];
+}
+
+bool FFXCategoryIndex::RemoveCategory(TArray<FFXCategoryData>& Categories, FName CategoryName)
+{
+	const int32 Index = FindCategoryIndex(Categories, CategoryName);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Categories.RemoveAt(Index);
+	AssetMembership.Remove(CategoryName);
+
+	// 뒤쪽 카테고리 인덱스가 바뀌므로 이름 색인 재생성
+	RebuildNameIndex(Categories);
+	return true;
+}
+
+bool FFXCategoryIndex::AddAsset(TArray<FFXCategoryData>& Categories, FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	FFXCategoryData* Category = FindCategory(Categories, CategoryName);
+	if (!Category)
+	{
+		return false;
+	}
+
+	// 중복 확인은 멤버십 집합으로 (배열 순서는 표시 순서로 유지)
+	bool bAlreadyInSet = false;
+	GetAssetMembership(*Category).Add(AssetPath, &bAlreadyInSet);
+	if (!bAlreadyInSet)
+	{
+		Category->Assets.Add(AssetPath);
+	}
+	return true;
+}
+
+int32 FFXCategoryIndex::RemoveAsset(TArray<FFXCategoryData>& Categories, FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	FFXCategoryData* Category = FindCategory(Categories, CategoryName);
+	if (!Category || GetAssetMembership(*Category).Remove(AssetPath) == 0)
+	{
+		return 0;
+	}
+
+	// 에셋은 카테고리 내에서 유일하므로 첫 항목만 제거 (표시 순서 유지)
+	return Category->Assets.RemoveSingle(AssetPath);
+}
+
+bool FFXCategoryIndex::ReplaceAsset(TArray<FFXCategoryData>& Categories, FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath)
+{
+	FFXCategoryData* Category = FindCategory(Categories, CategoryName);
+	if (!Category || AssetPath == NewAssetPath)
+	{
+		return false;
+	}
+
+	TSet<FSoftObjectPath>& Membership = GetAssetMembership(*Category);
+	if (Membership.Remove(AssetPath) == 0)
+	{
+		return false;
+	}
+
+	const int32 Index = Category->Assets.IndexOfByKey(AssetPath);
+	if (Membership.Contains(NewAssetPath))
+	{
+		Category->Assets.RemoveAt(Index);
+	}
+	else
+	{
+		Membership.Add(NewAssetPath);
+		Category->Assets[Index] = NewAssetPath;
+	}
+	return true;
+}
+
+bool FFXCategoryIndex::ContainsAsset(const TArray<FFXCategoryData>& Categories, FName CategoryName, const FSoftObjectPath& AssetPath) const
+{
+	const FFXCategoryData* Category = FindCategory(Categories, CategoryName);
+	return Category && GetAssetMembership(*Category).Contains(AssetPath);
+}
+
+void FFXCategoryIndex::Invalidate()
+{
+	CategoryIndexByName.Reset();
+	IndexedCategoryCount = INDEX_NONE;
+	AssetMembership.Reset();
+}
+
+void FFXCategoryIndex::RebuildNameIndex(const TArray<FFXCategoryData>& Categories) const
+{
+	CategoryIndexByName.Reset();
+	CategoryIndexByName.Reserve(Categories.Num());
+	for (int32 Index = 0; Index < Categories.Num(); ++Index)
+	{
+		// 중복 이름은 첫 항목 우선
+		if (!CategoryIndexByName.Contains(Categories[Index].CategoryName))
+		{
+			CategoryIndexByName.Add(Categories[Index].CategoryName, Index);
+		}
+	}
+	IndexedCategoryCount = Categories.Num();
+}
+
+TSet<FSoftObjectPath>& FFXCategoryIndex::GetAssetMembership(const FFXCategoryData& Category) const
+{
+	if (TSet<FSoftObjectPath>* Existing = AssetMembership.Find(Category.CategoryName))
+	{
+		return *Existing;
+	}
+	return AssetMembership.Add(Category.CategoryName, TSet<FSoftObjectPath>(Category.Assets));
+}
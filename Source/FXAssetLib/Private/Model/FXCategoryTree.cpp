@@ -0,0 +1,208 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXCategoryTree.h"
+
+namespace FXCategoryTreePrivate
+{
+	// 경로 구간 분리 (빈 구간/앞뒤 공백 제거)
+	static void SplitPath(const FString& CategoryPath, TArray<FString>& OutSegments)
+	{
+		OutSegments.Reset();
+		TArray<FString> RawSegments;
+		CategoryPath.ParseIntoArray(RawSegments, TEXT("/"), true);
+		for (FString& Segment : RawSegments)
+		{
+			Segment.TrimStartAndEndInline();
+			if (!Segment.IsEmpty())
+			{
+				OutSegments.Add(MoveTemp(Segment));
+			}
+		}
+	}
+
+	// 노드와 조상의 항목 수 갱신
+	static void AddAssetCount(const TSharedPtr<FFXCategoryTreeNode>& Node, int32 Delta)
+	{
+		Node->AssetCount += Delta;
+		for (TSharedPtr<FFXCategoryTreeNode> Current = Node; Current.IsValid(); Current = Current->Parent.Pin())
+		{
+			Current->SubtreeAssetCount += Delta;
+		}
+	}
+}
+
+void FFXCategoryTree::Rebuild(const TArray<TSharedPtr<FName>>& Categories, TFunctionRef<int32(FName)> GetAssetCount)
+{
+	Reset();
+	Nodes.Reserve(Categories.Num());
+	CategoryEntries.Reserve(Categories.Num());
+
+	for (const TSharedPtr<FName>& Category : Categories)
+	{
+		if (Category.IsValid())
+		{
+			AddCategory(Category, GetAssetCount(*Category));
+		}
+	}
+}
+
+void FFXCategoryTree::AddCategory(const TSharedPtr<FName>& Category, int32 AssetCount)
+{
+	if (!Category.IsValid() || CategoryEntries.Contains(*Category))
+	{
+		return;
+	}
+
+	// 구간이 없는 이름(예: "/")은 이름 그대로 최상위 노드
+	const FString CategoryPath = Category->ToString();
+	FString NormalizedPath = NormalizePath(CategoryPath);
+	if (NormalizedPath.IsEmpty())
+	{
+		NormalizedPath = CategoryPath.Replace(TEXT("/"), TEXT("_"));
+	}
+
+	TSharedPtr<FFXCategoryTreeNode> Node = FindOrAddNode(NormalizedPath);
+	if (!Node->IsCategory())
+	{
+		Node->Category = Category;
+	}
+
+	FCategoryEntry& Entry = CategoryEntries.Add(*Category);
+	Entry.Node = Node;
+	Entry.Category = Category;
+	Entry.AssetCount = AssetCount;
+	FXCategoryTreePrivate::AddAssetCount(Node, AssetCount);
+
+	Version++;
+}
+
+void FFXCategoryTree::RemoveCategory(FName CategoryName)
+{
+	FCategoryEntry Entry;
+	if (!CategoryEntries.RemoveAndCopyValue(CategoryName, Entry))
+	{
+		return;
+	}
+
+	TSharedPtr<FFXCategoryTreeNode> Node = Entry.Node;
+	FXCategoryTreePrivate::AddAssetCount(Node, -Entry.AssetCount);
+
+	if (Node->Category == Entry.Category)
+	{
+		Node->Category.Reset();
+
+		// 같은 경로로 합쳐진 다른 카테고리가 있으면 그 카테고리가 노드를 이어받음 (드문 경우라 선형 탐색)
+		for (const TPair<FName, FCategoryEntry>& Pair : CategoryEntries)
+		{
+			if (Pair.Value.Node == Node)
+			{
+				Node->Category = Pair.Value.Category;
+				break;
+			}
+		}
+	}
+
+	PruneFolderNodes(Node);
+	Version++;
+}
+
+void FFXCategoryTree::AdjustAssetCount(FName CategoryName, int32 Delta)
+{
+	if (Delta == 0)
+	{
+		return;
+	}
+
+	// 트리에 아직 없는 카테고리는 AddCategory에서 현재 항목 수로 시작
+	if (FCategoryEntry* Entry = CategoryEntries.Find(CategoryName))
+	{
+		Entry->AssetCount += Delta;
+		FXCategoryTreePrivate::AddAssetCount(Entry->Node, Delta);
+	}
+}
+
+TSharedPtr<FFXCategoryTreeNode> FFXCategoryTree::FindNode(FName Path) const
+{
+	const TSharedPtr<FFXCategoryTreeNode>* Node = Nodes.Find(Path);
+	return Node ? *Node : nullptr;
+}
+
+TSharedPtr<FFXCategoryTreeNode> FFXCategoryTree::FindCategoryNode(FName CategoryName) const
+{
+	const FCategoryEntry* Entry = CategoryEntries.Find(CategoryName);
+	return Entry ? Entry->Node : nullptr;
+}
+
+void FFXCategoryTree::Reset()
+{
+	RootNodes.Reset();
+	Nodes.Reset();
+	CategoryEntries.Reset();
+	Version++;
+}
+
+SIZE_T FFXCategoryTree::GetAllocatedSize() const
+{
+	SIZE_T Size = RootNodes.GetAllocatedSize() + Nodes.GetAllocatedSize() + CategoryEntries.GetAllocatedSize();
+	for (const TPair<FName, TSharedPtr<FFXCategoryTreeNode>>& Pair : Nodes)
+	{
+		Size += sizeof(FFXCategoryTreeNode) + Pair.Value->Label.GetAllocatedSize() + Pair.Value->Children.GetAllocatedSize();
+	}
+	return Size;
+}
+
+FString FFXCategoryTree::NormalizePath(const FString& CategoryPath)
+{
+	TArray<FString> Segments;
+	FXCategoryTreePrivate::SplitPath(CategoryPath, Segments);
+	return FString::Join(Segments, TEXT("/"));
+}
+
+TSharedPtr<FFXCategoryTreeNode> FFXCategoryTree::FindOrAddNode(const FString& NormalizedPath)
+{
+	TArray<FString> Segments;
+	FXCategoryTreePrivate::SplitPath(NormalizedPath, Segments);
+	if (Segments.Num() == 0)
+	{
+		Segments.Add(NormalizedPath);
+	}
+
+	TSharedPtr<FFXCategoryTreeNode> ParentNode;
+	FString Path;
+	for (FString& Segment : Segments)
+	{
+		if (!Path.IsEmpty())
+		{
+			Path.AppendChar(Separator);
+		}
+		Path += Segment;
+
+		const FName NodePath(*Path);
+		if (const TSharedPtr<FFXCategoryTreeNode>* Existing = Nodes.Find(NodePath))
+		{
+			ParentNode = *Existing;
+			continue;
+		}
+
+		TSharedPtr<FFXCategoryTreeNode> NewNode = MakeShared<FFXCategoryTreeNode>();
+		NewNode->Path = NodePath;
+		NewNode->Label = MoveTemp(Segment);
+		NewNode->Parent = ParentNode;
+		(ParentNode.IsValid() ? ParentNode->Children : RootNodes).Add(NewNode);
+		Nodes.Add(NodePath, NewNode);
+		ParentNode = NewNode;
+	}
+	return ParentNode;
+}
+
+void FFXCategoryTree::PruneFolderNodes(TSharedPtr<FFXCategoryTreeNode> Node)
+{
+	// 카테고리도 하위 노드도 없는 노드는 부모 방향으로 정리
+	while (Node.IsValid() && !Node->IsCategory() && Node->Children.Num() == 0)
+	{
+		TSharedPtr<FFXCategoryTreeNode> ParentNode = Node->Parent.Pin();
+		(ParentNode.IsValid() ? ParentNode->Children : RootNodes).RemoveSingle(Node);
+		Nodes.Remove(Node->Path);
+		Node = ParentNode;
+	}
+}
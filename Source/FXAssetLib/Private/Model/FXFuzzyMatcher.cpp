@@ -0,0 +1,272 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXFuzzyMatcher.h"
+
+namespace FXFuzzyMatcherPrivate
+{
+	// 비트 벡터 1개로 계산하는 최대 검색어 길이
+	static constexpr int32 MaxPatternLength = 64;
+
+	// 소문자로 바꾼 뒤 1바이트로 접음 (ASCII는 그대로, 그 외는 상위 절반으로)
+	static uint8 FoldChar(TCHAR Char)
+	{
+		Char = FChar::ToLower(Char);
+		return Char < 128 ? static_cast<uint8>(Char) : static_cast<uint8>(128 | (Char & 0x7F));
+	}
+
+	static bool IsWordDelimiter(uint8 Char)
+	{
+		return Char == '_' || Char == ' ' || Char == '-' || Char == '.' || Char == '(';
+	}
+
+	static bool IsBetterMatch(const FFXFuzzyMatch& A, const FFXFuzzyMatch& B)
+	{
+		if (A.Distance != B.Distance)
+		{
+			return A.Distance < B.Distance;
+		}
+		if (A.Boundary != B.Boundary)
+		{
+			return A.Boundary < B.Boundary;
+		}
+		if (A.Length != B.Length)
+		{
+			return A.Length < B.Length;
+		}
+		return A.CandidateIndex < B.CandidateIndex;
+	}
+
+	/**
+	 * Myers 비트 병렬 근사 매칭 (시작 위치 자유: 텍스트의 부분 문자열 기준)
+	 * @param PatternEq 글자별 검색어 위치 비트
+	 * @param MaxDistance 이 거리 안에 들 수 없으면 조기 종료
+	 * @param OutBestEnd 최소 거리가 처음 나온 텍스트 위치
+	 * @return 최소 편집 거리 (조기 종료 시 MaxDistance 초과 값)
+	 */
+	static int32 ComputeDistance(const uint64* PatternEq, int32 PatternLength, const uint8* Text, int32 TextLength, int32 MaxDistance, int32& OutBestEnd)
+	{
+		const uint64 HighBit = 1ull << (PatternLength - 1);
+		uint64 Pv = ~0ull;
+		uint64 Mv = 0;
+		int32 Score = PatternLength;
+		int32 Best = PatternLength;
+		OutBestEnd = INDEX_NONE;
+
+		for (int32 Index = 0; Index < TextLength; ++Index)
+		{
+			const uint64 Eq = PatternEq[Text[Index]];
+			const uint64 Xv = Eq | Mv;
+			const uint64 Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+			uint64 Ph = Mv | ~(Xh | Pv);
+			uint64 Mh = Pv & Xh;
+
+			if (Ph & HighBit)
+			{
+				++Score;
+			}
+			else if (Mh & HighBit)
+			{
+				--Score;
+			}
+
+			Ph <<= 1;
+			Mh <<= 1;
+			Pv = Mh | ~(Xv | Ph);
+			Mv = Ph & Xv;
+
+			if (Score < Best)
+			{
+				Best = Score;
+				OutBestEnd = Index;
+				if (Best == 0)
+				{
+					break;
+				}
+			}
+
+			// 남은 글자마다 최대 1씩만 줄어들므로 허용 거리에 닿을 수 없으면 중단
+			if (Score - (TextLength - 1 - Index) > MaxDistance && Best > MaxDistance)
+			{
+				break;
+			}
+		}
+
+		return Best;
+	}
+}
+
+void FFXFuzzyMatcher::Reset()
+{
+	NameChars.Reset();
+	NameOffsets.Reset();
+	NameLengths.Reset();
+	NameCharMasks.Reset();
+	Passes.Reset();
+	LastScannedCount = 0;
+}
+
+void FFXFuzzyMatcher::Reserve(int32 NumCandidates)
+{
+	NameOffsets.Reserve(NumCandidates);
+	NameLengths.Reserve(NumCandidates);
+	NameCharMasks.Reserve(NumCandidates);
+}
+
+int32 FFXFuzzyMatcher::AddCandidate(const FString& Name)
+{
+	// 후보가 바뀌면 이전 단계 풀은 무효
+	Passes.Reset();
+
+	uint64 CharMask = 0;
+	NameOffsets.Add(NameChars.Num());
+	NameLengths.Add(Name.Len());
+	for (TCHAR Char : Name)
+	{
+		const uint8 Folded = FXFuzzyMatcherPrivate::FoldChar(Char);
+		NameChars.Add(Folded);
+		CharMask |= 1ull << (Folded & 63);
+	}
+	return NameCharMasks.Add(CharMask);
+}
+
+int32 FFXFuzzyMatcher::GetMaxErrors(int32 PatternLength)
+{
+	if (PatternLength <= 2)
+	{
+		return 0;
+	}
+	return PatternLength <= 6 ? 1 : 2;
+}
+
+void FFXFuzzyMatcher::Match(const FString& Query, int32 MaxResults, TArray<FFXFuzzyMatch>& OutMatches)
+{
+	using namespace FXFuzzyMatcherPrivate;
+
+	OutMatches.Reset();
+	LastScannedCount = 0;
+
+	// 공백은 무시 (이름의 구분자와 맞추지 않음)
+	TArray<uint8> Pattern;
+	for (TCHAR Char : Query)
+	{
+		if (!FChar::IsWhitespace(Char) && Pattern.Num() < MaxPatternLength)
+		{
+			Pattern.Add(FoldChar(Char));
+		}
+	}
+
+	if (Pattern.Num() == 0 || MaxResults <= 0)
+	{
+		Passes.Reset();
+		return;
+	}
+
+	const int32 PatternLength = Pattern.Num();
+	const int32 MaxErrors = GetMaxErrors(PatternLength);
+
+	// 현재 검색어의 접두어이고 허용 거리까지 풀에 남아 있는 가장 최근 단계 찾기
+	while (Passes.Num() > 0)
+	{
+		const FPass& Last = Passes.Last();
+		const bool bIsPrefix = Last.Pattern.Num() <= PatternLength
+			&& FMemory::Memcmp(Last.Pattern.GetData(), Pattern.GetData(), Last.Pattern.Num()) == 0;
+		if (bIsPrefix && Last.PoolLimit >= MaxErrors)
+		{
+			break;
+		}
+		Passes.Pop(EAllowShrinking::No);
+	}
+
+	const FPass* Source = Passes.Num() > 0 ? &Passes.Last() : nullptr;
+	const bool bSameQuery = Source && Source->Pattern.Num() == PatternLength;
+
+	FPass NewPass;
+	NewPass.Pattern = Pattern;
+	NewPass.PoolLimit = Source ? FMath::Min(Source->PoolLimit, MaxErrors + 1) : MaxErrors + 1;
+
+	// 글자별 검색어 위치 비트
+	uint64 PatternEq[256] = {};
+	uint64 PatternMask = 0;
+	for (int32 Index = 0; Index < PatternLength; ++Index)
+	{
+		PatternEq[Pattern[Index]] |= 1ull << Index;
+		PatternMask |= 1ull << (Pattern[Index] & 63);
+	}
+
+	// 상위 MaxResults개만 유지 (힙의 맨 위가 가장 나쁜 결과)
+	auto IsWorse = [](const FFXFuzzyMatch& A, const FFXFuzzyMatch& B) { return IsBetterMatch(B, A); };
+	TArray<FFXFuzzyMatch> Heap;
+	Heap.Reserve(MaxResults + 1);
+
+	auto ScanCandidate = [&](int32 CandidateIndex)
+	{
+		// 이름에 없는 글자는 각각 최소 편집 1회
+		if (FMath::CountBits(PatternMask & ~NameCharMasks[CandidateIndex]) > static_cast<uint64>(NewPass.PoolLimit))
+		{
+			return;
+		}
+
+		const int32 Offset = NameOffsets[CandidateIndex];
+		const int32 Length = NameLengths[CandidateIndex];
+		int32 BestEnd = INDEX_NONE;
+		const int32 Distance = ComputeDistance(PatternEq, PatternLength, &NameChars[Offset], Length, NewPass.PoolLimit, BestEnd);
+		if (Distance > NewPass.PoolLimit)
+		{
+			return;
+		}
+
+		NewPass.Pool.Add(CandidateIndex);
+		if (Distance > MaxErrors)
+		{
+			return;
+		}
+
+		FFXFuzzyMatch Match;
+		Match.CandidateIndex = CandidateIndex;
+		Match.Distance = Distance;
+		Match.Length = Length;
+
+		const int32 Start = FMath::Max(0, BestEnd - PatternLength + 1);
+		Match.Boundary = Start == 0 ? 0 : (IsWordDelimiter(NameChars[Offset + Start - 1]) ? 1 : 2);
+
+		if (Heap.Num() < MaxResults)
+		{
+			Heap.HeapPush(Match, IsWorse);
+		}
+		else if (IsBetterMatch(Match, Heap.HeapTop()))
+		{
+			Heap.HeapPopDiscard(IsWorse, EAllowShrinking::No);
+			Heap.HeapPush(Match, IsWorse);
+		}
+	};
+
+	if (Source)
+	{
+		NewPass.Pool.Reserve(Source->Pool.Num());
+		for (int32 CandidateIndex : Source->Pool)
+		{
+			ScanCandidate(CandidateIndex);
+		}
+		LastScannedCount = Source->Pool.Num();
+	}
+	else
+	{
+		for (int32 CandidateIndex = 0; CandidateIndex < NameOffsets.Num(); ++CandidateIndex)
+		{
+			ScanCandidate(CandidateIndex);
+		}
+		LastScannedCount = NameOffsets.Num();
+	}
+
+	if (bSameQuery)
+	{
+		Passes.Last() = MoveTemp(NewPass);
+	}
+	else
+	{
+		Passes.Add(MoveTemp(NewPass));
+	}
+
+	Heap.Sort(IsBetterMatch);
+	OutMatches = MoveTemp(Heap);
+}
@@ -0,0 +1,597 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXLibraryDatabase.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace FXLibraryDatabasePrivate
+{
+	static constexpr uint32 SnapshotMagic = 0x42445846;     // 'FXDB'
+	static constexpr uint32 JournalMagic = 0x4C4A5846;      // 'FXJL'
+	static constexpr uint32 FormatVersion = 1;
+
+	static void SerializeName(FArchive& Ar, FName& Name)
+	{
+		FString NameString = Ar.IsLoading() ? FString() : Name.ToString();
+		Ar << NameString;
+		if (Ar.IsLoading())
+		{
+			Name = FName(*NameString);
+		}
+	}
+
+	static void SerializePath(FArchive& Ar, FSoftObjectPath& Path)
+	{
+		FString PathString = Ar.IsLoading() ? FString() : Path.ToString();
+		Ar << PathString;
+		if (Ar.IsLoading())
+		{
+			Path = FSoftObjectPath(PathString);
+		}
+	}
+
+	static void SerializeOverrides(FArchive& Ar, TArray<FFXUserParameterOverride>& Overrides)
+	{
+		int32 OverrideCount = Overrides.Num();
+		Ar << OverrideCount;
+		if (Ar.IsLoading())
+		{
+			Overrides.SetNum(OverrideCount);
+		}
+
+		for (FFXUserParameterOverride& Override : Overrides)
+		{
+			SerializeName(Ar, Override.ParameterName);
+			uint8 Type = static_cast<uint8>(Override.Type);
+			Ar << Type;
+			Override.Type = static_cast<EFXUserParameterType>(Type);
+			Ar << Override.FloatValue;
+			Ar << Override.IntValue;
+			Ar << Override.bBoolValue;
+			Ar << Override.VectorValue;
+			Ar << Override.ColorValue;
+		}
+	}
+
+	// 저널 레코드 페이로드
+	static void SerializeRecord(FArchive& Ar, FFXJournalRecord& Record)
+	{
+		uint8 Op = static_cast<uint8>(Record.Op);
+		Ar << Op;
+		Record.Op = static_cast<EFXJournalOp>(Op);
+		SerializeName(Ar, Record.CategoryName);
+		SerializePath(Ar, Record.Path);
+		if (Record.Op == EFXJournalOp::ReplaceAsset)
+		{
+			// 교체 레코드에만 기록 (기존 레코드 형식은 그대로)
+			SerializePath(Ar, Record.PreviousPath);
+		}
+		Ar << Record.bReferenced;
+		Ar << Record.bHasVariant;
+		if (Record.bHasVariant)
+		{
+			SerializeName(Ar, Record.Variant.VariantName);
+			SerializePath(Ar, Record.Variant.BasePath);
+			SerializeOverrides(Ar, Record.Variant.Overrides);
+		}
+	}
+
+	// 스냅샷용 경로 테이블 (같은 경로는 한 번만 기록)
+	struct FPathTable
+	{
+		TArray<FSoftObjectPath> Paths;
+		TMap<FSoftObjectPath, int32> Indices;
+
+		int32 Add(const FSoftObjectPath& Path)
+		{
+			if (const int32* Existing = Indices.Find(Path))
+			{
+				return *Existing;
+			}
+			const int32 Index = Paths.Add(Path);
+			Indices.Add(Path, Index);
+			return Index;
+		}
+	};
+}
+
+FFXLibraryDatabase::FFXLibraryDatabase(const FString& InDatabaseDirectory)
+	: DatabaseDirectory(InDatabaseDirectory)
+{
+}
+
+FFXLibraryDatabase::~FFXLibraryDatabase()
+{
+	CloseJournal();
+}
+
+FFXLibraryDatabase& FFXLibraryDatabase::Get()
+{
+	static FFXLibraryDatabase Database;
+	return Database;
+}
+
+FString FFXLibraryDatabase::GetDatabaseDirectory() const
+{
+	return DatabaseDirectory.IsEmpty() ? FPaths::ProjectSavedDir() / TEXT("FXLibrary") : DatabaseDirectory;
+}
+
+FString FFXLibraryDatabase::GetSnapshotPath() const
+{
+	return GetDatabaseDirectory() / TEXT("Library.fxdb");
+}
+
+FString FFXLibraryDatabase::GetJournalPath() const
+{
+	return GetDatabaseDirectory() / TEXT("Library.fxjournal");
+}
+
+bool FFXLibraryDatabase::Load(TArray<FFXCategoryData>& OutCategories)
+{
+	OutCategories.Reset();
+
+	if (!ReadSnapshot(OutCategories))
+	{
+		return false;
+	}
+
+	bool bFullyReplayed = true;
+	JournalRecordCount = ReplayJournal(OutCategories, bFullyReplayed);
+	bLoaded = true;
+
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Database] Loaded %d categories (%d journal records replayed)"),
+		OutCategories.Num(), JournalRecordCount);
+
+	// 손상된 꼬리를 남긴 채 추가하면 새 레코드가 재생되지 않으므로 재생된 상태로 압축
+	if (!bFullyReplayed)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FX Library Database] Journal has a damaged tail, compacting replayed state into a new snapshot"));
+		bJournalDamaged = !WriteSnapshot(OutCategories);
+	}
+
+	return true;
+}
+
+bool FFXLibraryDatabase::AppendRecord(const FFXJournalRecord& Record)
+{
+	return AppendRecords(MakeArrayView(&Record, 1));
+}
+
+bool FFXLibraryDatabase::AppendRecords(TConstArrayView<FFXJournalRecord> Records)
+{
+	using namespace FXLibraryDatabasePrivate;
+
+	if (Records.Num() == 0)
+	{
+		return true;
+	}
+
+	// 손상된 저널 뒤에 붙인 레코드는 재생되지 않으므로 스냅샷으로 압축될 때까지 거부 (호출자는 스냅샷으로 대체)
+	if (bJournalDamaged)
+	{
+		return false;
+	}
+
+	if (!JournalHandle.IsValid())
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.CreateDirectoryTree(*GetDatabaseDirectory());
+
+		const FString JournalPath = GetJournalPath();
+		const bool bIsNewJournal = !PlatformFile.FileExists(*JournalPath) || PlatformFile.FileSize(*JournalPath) <= 0;
+
+		JournalHandle.Reset(PlatformFile.OpenWrite(*JournalPath, true));
+		if (!JournalHandle.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[FX Library Database] Failed to open journal: %s"), *JournalPath);
+			return false;
+		}
+
+		if (bIsNewJournal)
+		{
+			TArray<uint8> Header;
+			FMemoryWriter HeaderWriter(Header);
+			uint32 Magic = JournalMagic;
+			uint32 Version = FormatVersion;
+			HeaderWriter << Magic << Version;
+			JournalHandle->Write(Header.GetData(), Header.Num());
+		}
+	}
+
+	// 레코드별 [크기][CRC][페이로드] 프레임을 모아 한 번에 쓰기 - 중간에 끊긴 레코드는 재생 시 무시
+	TArray<uint8> Frames;
+	TArray<uint8> Payload;
+	TArray<uint8> FrameHeader;
+	for (const FFXJournalRecord& Record : Records)
+	{
+		Payload.Reset();
+		FMemoryWriter PayloadWriter(Payload);
+		FFXJournalRecord RecordToWrite = Record;
+		SerializeRecord(PayloadWriter, RecordToWrite);
+
+		FrameHeader.Reset();
+		FMemoryWriter FrameWriter(FrameHeader);
+		int32 PayloadSize = Payload.Num();
+		uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+		FrameWriter << PayloadSize << PayloadCrc;
+		Frames.Append(FrameHeader);
+		Frames.Append(Payload);
+	}
+
+	if (!JournalHandle->Write(Frames.GetData(), Frames.Num()) || !JournalHandle->Flush())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FX Library Database] Failed to append %d journal records"), Records.Num());
+		CloseJournal();
+
+		// 일부만 기록되었을 수 있으므로 스냅샷으로 압축될 때까지 더 붙이지 않음
+		bJournalDamaged = true;
+		return false;
+	}
+
+	JournalRecordCount += Records.Num();
+	return true;
+}
+
+bool FFXLibraryDatabase::WriteSnapshot(const TArray<FFXCategoryData>& Categories)
+{
+	TArray64<uint8> Bytes;
+	SerializeSnapshot(Categories, Bytes);
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*GetDatabaseDirectory());
+
+	// 임시 파일에 쓴 뒤 교체 (쓰기 도중 실패해도 기존 스냅샷 유지)
+	const FString SnapshotPath = GetSnapshotPath();
+	const FString TempPath = SnapshotPath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FX Library Database] Failed to write snapshot: %s"), *TempPath);
+		return false;
+	}
+
+	if (!IFileManager::Get().Move(*SnapshotPath, *TempPath, true, true))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FX Library Database] Failed to replace snapshot: %s"), *SnapshotPath);
+		return false;
+	}
+
+	// 스냅샷에 반영되었으므로 저널 비우기
+	CloseJournal();
+	PlatformFile.DeleteFile(*GetJournalPath());
+	JournalRecordCount = 0;
+	bJournalDamaged = false;
+	bLoaded = true;
+
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Database] Wrote snapshot: %d categories, %lld bytes"), Categories.Num(), Bytes.Num());
+	return true;
+}
+
+void FFXLibraryDatabase::ApplyRecord(const FFXJournalRecord& Record, TArray<FFXCategoryData>& Categories, FFXCategoryIndex& CategoryIndex)
+{
+	switch (Record.Op)
+	{
+	case EFXJournalOp::AddCategory:
+		CategoryIndex.AddCategory(Categories, Record.CategoryName, Record.Path);
+		return;
+
+	case EFXJournalOp::RemoveCategory:
+		CategoryIndex.RemoveCategory(Categories, Record.CategoryName);
+		return;
+
+	case EFXJournalOp::AddAsset:
+		CategoryIndex.AddAsset(Categories, Record.CategoryName, Record.Path);
+		break;
+
+	case EFXJournalOp::RemoveAsset:
+		CategoryIndex.RemoveAsset(Categories, Record.CategoryName, Record.Path);
+		break;
+
+	case EFXJournalOp::ReplaceAsset:
+		CategoryIndex.ReplaceAsset(Categories, Record.CategoryName, Record.PreviousPath, Record.Path);
+		break;
+	}
+
+	if (FFXCategoryData* Category = CategoryIndex.FindCategory(Categories, Record.CategoryName))
+	{
+		ApplyRecordMetadata(Record, *Category);
+	}
+}
+
+void FFXLibraryDatabase::ApplyRecordMetadata(const FFXJournalRecord& Record, FFXCategoryData& Category)
+{
+	switch (Record.Op)
+	{
+	case EFXJournalOp::ReplaceAsset:
+		Category.ReferencedAssets.Remove(Record.PreviousPath);
+		Category.Variants.RemoveAll([&Record](const FFXAssetVariant& Variant)
+		{
+			return Variant.GetEntryPath() == Record.PreviousPath;
+		});
+		// 새 경로의 변형/참조 정보는 추가와 동일하게 반영
+		[[fallthrough]];
+
+	case EFXJournalOp::AddAsset:
+		if (Record.bReferenced)
+		{
+			Category.ReferencedAssets.AddUnique(Record.Path);
+		}
+		if (Record.bHasVariant)
+		{
+			Category.Variants.RemoveAll([&Record](const FFXAssetVariant& Variant)
+			{
+				return Variant.GetEntryPath() == Record.Path;
+			});
+			Category.Variants.Add(Record.Variant);
+		}
+		break;
+
+	case EFXJournalOp::RemoveAsset:
+		Category.ReferencedAssets.Remove(Record.Path);
+		Category.Variants.RemoveAll([&Record](const FFXAssetVariant& Variant)
+		{
+			return Variant.GetEntryPath() == Record.Path;
+		});
+		break;
+
+	default:
+		break;
+	}
+}
+
+void FFXLibraryDatabase::SerializeSnapshot(TConstArrayView<FFXCategoryData> Categories, TArray64<uint8>& OutBytes)
+{
+	using namespace FXLibraryDatabasePrivate;
+
+	// 1. 경로 테이블 구성 (아이콘, 항목, 참조, 변형 기본 경로)
+	FPathTable PathTable;
+	for (const FFXCategoryData& Category : Categories)
+	{
+		PathTable.Add(Category.IconPath);
+		for (const FSoftObjectPath& AssetPath : Category.Assets)
+		{
+			PathTable.Add(AssetPath);
+		}
+		for (const FSoftObjectPath& AssetPath : Category.ReferencedAssets)
+		{
+			PathTable.Add(AssetPath);
+		}
+		for (const FFXAssetVariant& Variant : Category.Variants)
+		{
+			PathTable.Add(Variant.BasePath);
+		}
+	}
+
+	FMemoryWriter64 Writer(OutBytes);
+	uint32 Magic = SnapshotMagic;
+	uint32 Version = FormatVersion;
+	Writer << Magic << Version;
+
+	int32 PathCount = PathTable.Paths.Num();
+	Writer << PathCount;
+	for (FSoftObjectPath& Path : PathTable.Paths)
+	{
+		SerializePath(Writer, Path);
+	}
+
+	// 2. 카테고리 (경로는 테이블 인덱스로 기록)
+	auto WriteIndices = [&Writer, &PathTable](const TArray<FSoftObjectPath>& Paths)
+	{
+		int32 Count = Paths.Num();
+		Writer << Count;
+		for (const FSoftObjectPath& Path : Paths)
+		{
+			int32 Index = PathTable.Indices.FindChecked(Path);
+			Writer << Index;
+		}
+	};
+
+	int32 CategoryCount = Categories.Num();
+	Writer << CategoryCount;
+	for (const FFXCategoryData& Category : Categories)
+	{
+		FName CategoryName = Category.CategoryName;
+		SerializeName(Writer, CategoryName);
+
+		int32 IconIndex = PathTable.Indices.FindChecked(Category.IconPath);
+		Writer << IconIndex;
+
+		WriteIndices(Category.Assets);
+		WriteIndices(Category.ReferencedAssets);
+
+		int32 VariantCount = Category.Variants.Num();
+		Writer << VariantCount;
+		for (FFXAssetVariant Variant : Category.Variants)
+		{
+			SerializeName(Writer, Variant.VariantName);
+			int32 BaseIndex = PathTable.Indices.FindChecked(Variant.BasePath);
+			Writer << BaseIndex;
+			SerializeOverrides(Writer, Variant.Overrides);
+		}
+	}
+}
+
+uint32 FFXLibraryDatabase::ComputeCategoryHash(const FFXCategoryData& Category)
+{
+	TArray64<uint8> Bytes;
+	SerializeSnapshot(MakeArrayView(&Category, 1), Bytes);
+	return FCrc::MemCrc32(Bytes.GetData(), Bytes.Num());
+}
+
+bool FFXLibraryDatabase::DeserializeSnapshot(TArrayView64<const uint8> Bytes, TArray<FFXCategoryData>& OutCategories)
+{
+	using namespace FXLibraryDatabasePrivate;
+
+	FMemoryReaderView Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != SnapshotMagic || Version != FormatVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FX Library Database] Unsupported snapshot format (magic %08x, version %u)"), Magic, Version);
+		return false;
+	}
+
+	// 1. 경로 테이블 (경로 문자열은 여기서 한 번만 파싱)
+	int32 PathCount = 0;
+	Reader << PathCount;
+	if (PathCount < 0 || Reader.IsError())
+	{
+		return false;
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	Paths.SetNum(PathCount);
+	for (FSoftObjectPath& Path : Paths)
+	{
+		SerializePath(Reader, Path);
+	}
+
+	auto ReadPath = [&Reader, &Paths]() -> FSoftObjectPath
+	{
+		int32 Index = INDEX_NONE;
+		Reader << Index;
+		return Paths.IsValidIndex(Index) ? Paths[Index] : FSoftObjectPath();
+	};
+
+	auto ReadPaths = [&Reader, &ReadPath](TArray<FSoftObjectPath>& OutPaths)
+	{
+		int32 Count = 0;
+		Reader << Count;
+		OutPaths.Reset(FMath::Max(Count, 0));
+		for (int32 i = 0; i < Count && !Reader.IsError(); ++i)
+		{
+			OutPaths.Add(ReadPath());
+		}
+	};
+
+	// 2. 카테고리
+	int32 CategoryCount = 0;
+	Reader << CategoryCount;
+	OutCategories.Reset(FMath::Max(CategoryCount, 0));
+	for (int32 CategoryIndex = 0; CategoryIndex < CategoryCount && !Reader.IsError(); ++CategoryIndex)
+	{
+		FFXCategoryData& Category = OutCategories.AddDefaulted_GetRef();
+		SerializeName(Reader, Category.CategoryName);
+		Category.IconPath = ReadPath();
+		ReadPaths(Category.Assets);
+		ReadPaths(Category.ReferencedAssets);
+
+		int32 VariantCount = 0;
+		Reader << VariantCount;
+		for (int32 VariantIndex = 0; VariantIndex < VariantCount && !Reader.IsError(); ++VariantIndex)
+		{
+			FFXAssetVariant& Variant = Category.Variants.AddDefaulted_GetRef();
+			SerializeName(Reader, Variant.VariantName);
+			Variant.BasePath = ReadPath();
+			SerializeOverrides(Reader, Variant.Overrides);
+		}
+	}
+
+	return !Reader.IsError();
+}
+
+bool FFXLibraryDatabase::ReadSnapshot(TArray<FFXCategoryData>& OutCategories) const
+{
+	const FString SnapshotPath = GetSnapshotPath();
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*SnapshotPath))
+	{
+		return false;
+	}
+
+	// 메모리 매핑으로 읽기 (지원하지 않는 플랫폼/파일 시스템이면 일반 읽기)
+	IPlatformFile::FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*SnapshotPath);
+	if (MappedResult.HasValue())
+	{
+		TUniquePtr<IMappedFileHandle> MappedHandle = MappedResult.StealValue();
+		TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+		if (MappedRegion.IsValid())
+		{
+			return DeserializeSnapshot(TArrayView64<const uint8>(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize()), OutCategories);
+		}
+	}
+
+	TArray64<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *SnapshotPath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FX Library Database] Failed to read snapshot: %s"), *SnapshotPath);
+		return false;
+	}
+
+	return DeserializeSnapshot(Bytes, OutCategories);
+}
+
+int32 FFXLibraryDatabase::ReplayJournal(TArray<FFXCategoryData>& Categories, bool& bOutFullyReplayed) const
+{
+	using namespace FXLibraryDatabasePrivate;
+
+	bOutFullyReplayed = true;
+
+	TArray64<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetJournalPath(), FILEREAD_Silent) || Bytes.Num() == 0)
+	{
+		return 0;
+	}
+
+	bOutFullyReplayed = false;
+
+	FMemoryReaderView Reader(Bytes);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != JournalMagic || Version != FormatVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FX Library Database] Ignoring journal with unsupported format"));
+		return 0;
+	}
+
+	// 레코드마다 카테고리를 선형 탐색하지 않도록 재생 동안 색인 유지
+	FFXCategoryIndex CategoryIndex;
+	int32 RecordCount = 0;
+	while (!Reader.AtEnd())
+	{
+		int32 PayloadSize = 0;
+		uint32 PayloadCrc = 0;
+		Reader << PayloadSize << PayloadCrc;
+
+		// 끊긴 마지막 레코드 (쓰기 도중 종료) 는 무시
+		if (Reader.IsError() || PayloadSize <= 0 || Reader.Tell() + PayloadSize > Reader.TotalSize())
+		{
+			break;
+		}
+
+		const uint8* PayloadData = Bytes.GetData() + Reader.Tell();
+		if (FCrc::MemCrc32(PayloadData, PayloadSize) != PayloadCrc)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[FX Library Database] Journal record %d failed CRC check, stopping replay"), RecordCount);
+			break;
+		}
+
+		FMemoryReaderView PayloadReader(TArrayView64<const uint8>(PayloadData, PayloadSize));
+		FFXJournalRecord Record;
+		SerializeRecord(PayloadReader, Record);
+
+		ApplyRecord(Record, Categories, CategoryIndex);
+		Reader.Seek(Reader.Tell() + PayloadSize);
+		RecordCount++;
+	}
+
+	bOutFullyReplayed = Reader.AtEnd() && !Reader.IsError();
+	return RecordCount;
+}
+
+void FFXLibraryDatabase::CloseJournal()
+{
+	if (JournalHandle.IsValid())
+	{
+		JournalHandle->Flush();
+		JournalHandle.Reset();
+	}
+}
@@ -1,15 +1,42 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Model/FXLibraryModel.h"
-#include "AssetRegistry/AssetRegistryModule.h"
-#include "AssetRegistry/IAssetRegistry.h"
+#include "Model/FXSharedLibrary.h"
+#include "Core/FXAssetLibConstants.h"
+#include "Async/Async.h"
 
 FFXLibraryModel::FFXLibraryModel()
+	: FFXLibraryModel(MakeShared<FFXSettingsLibraryStorage>(), MakeShared<FFXEngineAssetRegistryView>())
 {
 }
 
+FFXLibraryModel::FFXLibraryModel(TSharedRef<IFXLibraryStorage> InStorage, TSharedRef<IFXAssetRegistryView> InRegistry)
+	: Storage(InStorage)
+	, Registry(InRegistry)
+	, SnapshotPublisher(MakeShared<FFXLibrarySnapshotPublisher, ESPMode::ThreadSafe>())
+{
+	if (Storage->ReceivesSharedChanges())
+	{
+		SharedLibraryChangedHandle = FFXSharedLibrary::Get().OnExternalChange.AddRaw(this, &FFXLibraryModel::ApplyExternalChanges);
+	}
+}
+
 FFXLibraryModel::~FFXLibraryModel()
 {
+	// 워커가 레지스트리를 읽는 중일 수 있으므로 완료 대기
+	if (PendingCleanup.IsValid())
+	{
+		PendingCleanup.Wait();
+	}
+	if (CleanupTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(CleanupTickerHandle);
+	}
+
+	if (SharedLibraryChangedHandle.IsValid())
+	{
+		FFXSharedLibrary::Get().OnExternalChange.Remove(SharedLibraryChangedHandle);
+	}
 }
 
 void FFXLibraryModel::SetState(TSharedPtr<FFXLibraryState> InState)
@@ -24,19 +51,19 @@ void FFXLibraryModel::LoadFromSettings()
 		return;
 	}
 
-	const UFXLibrarySettings* Settings = GetSettings();
-	if (!Settings)
-	{
-		UE_LOG(LogTemp, Error, TEXT("[FX Library Model] LoadFromSettings: Settings is nullptr!"));
-		return;
-	}
+	// 백엔드에서 카테고리 읽기 (Settings 저장소: Database/Shared 백엔드는 세션 최초 1회)
+	Storage->Load();
+
+	// 카테고리별 로드 알림을 합쳐 표시 목록 재구성/알림은 로드 완료 시 1회
+	const int32 SuppressedBefore = State->GetSuppressedNotificationCount();
+	FFXLibraryState::FScopedBatch Batch(*State);
 
 	// State 초기화
 	State->Reset();
 
 	// 카테고리 데이터 로드
 	TArray<TSharedPtr<FName>> Categories;
-	for (const FFXCategoryData& CategoryData : Settings->Categories)
+	for (const FFXCategoryData& CategoryData : Storage->GetCategories())
 	{
 		// 카테고리 이름
 		Categories.Add(MakeShared<FName>(CategoryData.CategoryName));
@@ -44,6 +71,15 @@ void FFXLibraryModel::LoadFromSettings()
 		// 에셋 목록
 		State->LoadCategoryAssets(CategoryData.CategoryName, CategoryData.Assets);
 
+		// 파라미터 오버라이드 변형
+		for (const FFXAssetVariant& Variant : CategoryData.Variants)
+		{
+			State->AssetVariants.Add(Variant.GetEntryPath(), Variant);
+		}
+
+		// 참조 전용 항목
+		State->ReferencedAssets.Append(CategoryData.ReferencedAssets);
+
 		// 아이콘 경로
 		if (CategoryData.IconPath.IsValid())
 		{
@@ -53,13 +89,20 @@ void FFXLibraryModel::LoadFromSettings()
 
 	State->LoadCategories(Categories);
 
-	// 첫 번째 카테고리 선택
+	// 첫 번째 카테고리 선택 (카테고리가 없어도 표시 목록은 초기화 알림)
 	if (Categories.Num() > 0)
 	{
 		State->SetSelectedCategory(Categories[0]);
 	}
+	State->UpdateVisibleAssets();
 
-	UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Loaded %d categories"), Categories.Num());
+	const FFXLibraryStateMemoryStats MemoryStats = State->GetMemoryStats();
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Loaded %d categories (%d entries, %d unique paths, %.1f bytes/entry, %d notifications coalesced)"),
+		Categories.Num(), MemoryStats.NumEntries, MemoryStats.NumUniquePaths, MemoryStats.GetBytesPerEntry(),
+		State->GetSuppressedNotificationCount() - SuppressedBefore);
+
+	SnapshotPublisher->MarkAllDirty();
+	PublishSnapshot();
 }
 
 void FFXLibraryModel::SaveToSettings()
@@ -69,73 +112,41 @@ void FFXLibraryModel::SaveToSettings()
 		return;
 	}
 
-	UFXLibrarySettings* Settings = GetMutableSettings();
-	if (!Settings)
-	{
-		UE_LOG(LogTemp, Error, TEXT("[FX Library Model] SaveToSettings: Settings is nullptr!"));
-		return;
-	}
-
-	// State에서 Settings로 데이터 저장
-	Settings->Categories.Empty();
-
-	for (const TSharedPtr<FName>& CategoryPtr : State->Categories)
-	{
-		if (!CategoryPtr.IsValid())
-		{
-			continue;
-		}
-
-		FName CategoryName = *CategoryPtr;
-		FFXCategoryData CategoryData;
-		CategoryData.CategoryName = CategoryName;
-
-		// 아이콘 경로
-		if (const FSoftObjectPath* IconPath = State->CategoryIcons.Find(CategoryName))
-		{
-			CategoryData.IconPath = *IconPath;
-		}
-
-		// 에셋 목록
-		if (const TArray<FSoftObjectPath>* Assets = State->CategoryToAssets.Find(CategoryName))
-		{
-			CategoryData.Assets = *Assets;
-		}
-
-		Settings->Categories.Add(CategoryData);
-	}
+	// State에서 저장소(Settings)로 데이터 반영 후 전체 저장 예약
+	RebuildStorageCategories();
+	Storage->MarkFullSaveDirty();
 
-	Settings->SaveConfig();
-	Settings->TryUpdateDefaultConfigFile();
+	SnapshotPublisher->MarkAllDirty();
+	PublishSnapshot();
 
-	UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Saved %d categories"), Settings->Categories.Num());
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Rebuilt %d categories (save scheduled)"), Storage->GetCategories().Num());
 }
 
 FFXCategoryData* FFXLibraryModel::FindCategory(FName CategoryName)
 {
-	UFXLibrarySettings* Settings = GetMutableSettings();
-	return Settings ? Settings->FindCategory(CategoryName) : nullptr;
+	return Storage->FindCategory(CategoryName);
 }
 
 FFXCategoryData* FFXLibraryModel::AddCategory(FName CategoryName, const FSoftObjectPath& IconPath)
 {
-	UFXLibrarySettings* Settings = GetMutableSettings();
-	if (!Settings)
-	{
-		return nullptr;
-	}
-
-	FFXCategoryData* Category = Settings->AddCategory(CategoryName, IconPath);
+	FFXCategoryData* Category = Storage->AddCategory(CategoryName, IconPath);
 	if (Category)
 	{
-		// State에도 추가
-		TSharedPtr<FName> CategoryPtr = MakeShared<FName>(CategoryName);
-		State->Categories.AddUnique(CategoryPtr);
+		FFXLibraryState::FScopedBatch Batch(*State);
+
+		// State에도 추가 (이름 기준 중복 방지)
+		State->AddCategory(CategoryName);
 		if (IconPath.IsValid())
 		{
 			State->LoadCategoryIcon(CategoryName, IconPath);
 		}
 		State->NotifyStateChanged();
+
+		FFXJournalRecord Record;
+		Record.Op = EFXJournalOp::AddCategory;
+		Record.CategoryName = CategoryName;
+		Record.Path = IconPath;
+		CommitChange(Record);
 	}
 
 	return Category;
@@ -143,27 +154,15 @@ FFXCategoryData* FFXLibraryModel::AddCategory(FName CategoryName, const FSoftObj
 
 bool FFXLibraryModel::RemoveCategory(FName CategoryName)
 {
-	UFXLibrarySettings* Settings = GetMutableSettings();
-	if (!Settings)
-	{
-		return false;
-	}
+	// 저장소에서 제거
+	const bool bRemoved = Storage->RemoveCategory(CategoryName);
 
-	// Settings에서 제거
-	int32 RemovedCount = Settings->Categories.RemoveAll([CategoryName](const FFXCategoryData& Cat)
+	if (bRemoved)
 	{
-		return Cat.CategoryName == CategoryName;
-	});
+		FFXLibraryState::FScopedBatch Batch(*State);
 
-	if (RemovedCount > 0)
-	{
 		// State에서도 제거
-		State->Categories.RemoveAll([CategoryName](const TSharedPtr<FName>& CatPtr)
-		{
-			return CatPtr.IsValid() && *CatPtr == CategoryName;
-		});
-		State->CategoryToAssets.Remove(CategoryName);
-		State->CategoryIcons.Remove(CategoryName);
+		State->RemoveCategory(CategoryName);
 
 		// 선택된 카테고리였다면 해제
 		if (State->SelectedCategory.IsValid() && *State->SelectedCategory == CategoryName)
@@ -172,25 +171,29 @@ bool FFXLibraryModel::RemoveCategory(FName CategoryName)
 		}
 
 		State->NotifyStateChanged();
-		SaveToSettings();
+
+		FFXJournalRecord Record;
+		Record.Op = EFXJournalOp::RemoveCategory;
+		Record.CategoryName = CategoryName;
+		CommitChange(Record);
 	}
 
-	return RemovedCount > 0;
+	return bRemoved;
 }
 
 bool FFXLibraryModel::AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath)
 {
-	UFXLibrarySettings* Settings = GetMutableSettings();
-	if (!Settings)
+	// 이미 등록된 항목은 저널/저장/알림 없이 무시
+	if (Storage->IsAssetInCategory(CategoryName, AssetPath))
 	{
 		return false;
 	}
 
-	bool bSuccess = Settings->AddAssetToCategory(CategoryName, AssetPath);
+	bool bSuccess = Storage->AddAssetToCategory(CategoryName, AssetPath);
 	if (bSuccess)
 	{
 		State->AddAssetToCategory(CategoryName, AssetPath);
-		SaveToSettings();
+		CommitChange(MakeAssetRecord(EFXJournalOp::AddAsset, CategoryName, AssetPath));
 	}
 
 	return bSuccess;
@@ -198,135 +201,1026 @@ bool FFXLibraryModel::AddAssetToCategory(FName CategoryName, const FSoftObjectPa
 
 int32 FFXLibraryModel::RemoveAssetFromCategory(FName CategoryName, const FSoftObjectPath& AssetPath)
 {
-	UFXLibrarySettings* Settings = GetMutableSettings();
-	if (!Settings)
-	{
-		return 0;
-	}
-
-	int32 RemovedCount = Settings->RemoveAssetFromCategory(CategoryName, AssetPath);
+	int32 RemovedCount = Storage->RemoveAssetFromCategory(CategoryName, AssetPath);
 	if (RemovedCount > 0)
 	{
 		State->RemoveAssetFromCategory(CategoryName, AssetPath);
-		SaveToSettings();
+
+		// 다른 카테고리에서도 사용하지 않는 항목이면 변형/참조 정보 제거
+		if (!IsAssetRegistered(AssetPath))
+		{
+			State->AssetVariants.Remove(AssetPath);
+			State->ReferencedAssets.Remove(AssetPath);
+		}
+		CommitChange(MakeAssetRecord(EFXJournalOp::RemoveAsset, CategoryName, AssetPath));
 	}
 
 	return RemovedCount;
 }
 
-bool FFXLibraryModel::ValidateCategory(FName CategoryName) const
+int32 FFXLibraryModel::AddAssetsToCategory(FName CategoryName, const TArray<FSoftObjectPath>& AssetPaths, bool bCreateCategory)
 {
-	const UFXLibrarySettings* Settings = GetSettings();
-	return Settings && Settings->FindCategory(CategoryName) != nullptr;
-}
+	if (!State.IsValid() || CategoryName.IsNone())
+	{
+		return 0;
+	}
 
-bool FFXLibraryModel::ValidateAsset(const FSoftObjectPath& AssetPath) const
-{
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-	FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(*AssetPath.ToString());
-	return AssetData.IsValid();
+	if (!Storage->FindCategory(CategoryName))
+	{
+		if (!bCreateCategory)
+		{
+			return 0;
+		}
+
+		AddCategoryNoNotify(CategoryName);
+	}
+
+	int32 AddedCount = 0;
+	for (const FSoftObjectPath& AssetPath : AssetPaths)
+	{
+		if (AddAssetNoNotify(CategoryName, AssetPath))
+		{
+			AddedCount++;
+		}
+	}
+
+	FinishBatch(AddedCount);
+	return AddedCount;
 }
 
-int32 FFXLibraryModel::CleanupInvalidAssets()
+int32 FFXLibraryModel::RemoveAssetsFromCategory(FName CategoryName, const TArray<FSoftObjectPath>& AssetPaths)
 {
 	if (!State.IsValid())
 	{
 		return 0;
 	}
 
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	int32 RemovedCount = 0;
-
-	// 각 카테고리에서 유효하지 않은 에셋 제거
-	for (const TSharedPtr<FName>& CategoryPtr : State->Categories)
+	// None이면 모든 카테고리에서 제거
+	TArray<FName> TargetCategories;
+	if (CategoryName.IsNone())
 	{
-		if (!CategoryPtr.IsValid())
+		for (const TSharedPtr<FName>& CategoryPtr : State->Categories)
 		{
-			continue;
+			if (CategoryPtr.IsValid())
+			{
+				TargetCategories.Add(*CategoryPtr);
+			}
 		}
+	}
+	else
+	{
+		TargetCategories.Add(CategoryName);
+	}
 
-		FName CategoryName = *CategoryPtr;
-		if (TArray<FSoftObjectPath>* Assets = State->CategoryToAssets.Find(CategoryName))
+	int32 RemovedCount = 0;
+	for (FName TargetCategory : TargetCategories)
+	{
+		for (const FSoftObjectPath& AssetPath : AssetPaths)
 		{
-			TArray<FSoftObjectPath> ValidAssets;
-			for (const FSoftObjectPath& AssetPath : *Assets)
+			if (RemoveAssetNoNotify(TargetCategory, AssetPath))
 			{
-				FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(*AssetPath.ToString());
-				if (AssetData.IsValid())
-				{
-					ValidAssets.Add(AssetPath);
-				}
-				else
-				{
-					RemovedCount++;
-					UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Removed invalid asset: %s"), *AssetPath.ToString());
-				}
+				RemovedCount++;
 			}
-			*Assets = ValidAssets;
 		}
 	}
 
-	if (RemovedCount > 0)
+	FinishBatch(RemovedCount);
+	return RemovedCount;
+}
+
+int32 FFXLibraryModel::MoveAssetsToCategory(FName SourceCategory, FName TargetCategory, const TArray<FSoftObjectPath>& AssetPaths)
+{
+	if (!State.IsValid() || SourceCategory == TargetCategory
+		|| !Storage->FindCategory(SourceCategory) || !Storage->FindCategory(TargetCategory))
 	{
-		State->UpdateVisibleAssets();
-		State->NotifyStateChanged();
-		SaveToSettings();
+		return 0;
 	}
 
-	return RemovedCount;
+	int32 MovedCount = 0;
+	for (const FSoftObjectPath& AssetPath : AssetPaths)
+	{
+		if (!Storage->IsAssetInCategory(SourceCategory, AssetPath))
+		{
+			continue;
+		}
+
+		// 대상에 먼저 추가해야 변형/참조 정보가 유지됨
+		// 이미 대상에 있던 항목은 원래 카테고리에서만 빠지므로 이동 수에 포함하지 않음 (저장/알림은 저장소 변경 여부로 판단)
+		const bool bAddedToTarget = AddAssetNoNotify(TargetCategory, AssetPath);
+		RemoveAssetNoNotify(SourceCategory, AssetPath);
+		if (bAddedToTarget)
+		{
+			MovedCount++;
+		}
+	}
+
+	FinishBatch(MovedCount);
+	return MovedCount;
 }
 
-int32 FFXLibraryModel::CleanupEmptyCategories()
+int32 FFXLibraryModel::RebuildFromAssetRegistry(const FString& RootPath)
 {
 	if (!State.IsValid())
 	{
 		return 0;
 	}
 
-	int32 RemovedCount = 0;
-	TArray<TSharedPtr<FName>> ValidCategories;
+	FString PackagePath = RootPath;
+	PackagePath.RemoveFromEnd(TEXT("/"));
+	if (PackagePath.IsEmpty())
+	{
+		return 0;
+	}
 
-	for (const TSharedPtr<FName>& CategoryPtr : State->Categories)
+	const double StartTime = FPlatformTime::Seconds();
+
+	// 카테고리 태그가 있는 에셋만 조회 (태그만 읽으므로 로드 없음)
+	TArray<FAssetData> TaggedAssets;
+	Registry->GetAssetsWithTag(FName(*PackagePath), FFXAssetLibConstants::CategoryMetadataTag, TaggedAssets);
+
+	FFXLibraryState::FScopedBatch Batch(*State);
+
+	int32 AddedCount = 0;
+	int32 SkippedCount = 0;
+	for (const FAssetData& AssetData : TaggedAssets)
 	{
-		if (!CategoryPtr.IsValid())
+		FString CategoryString;
+		if (!AssetData.GetTagValue(FFXAssetLibConstants::CategoryMetadataTag, CategoryString) || CategoryString.IsEmpty())
 		{
 			continue;
 		}
 
-		FName CategoryName = *CategoryPtr;
-		const TArray<FSoftObjectPath>* Assets = State->CategoryToAssets.Find(CategoryName);
+		// 이미 등록된 항목은 현재 카테고리를 유지 (등록 후 사용자가 옮긴 경우)
+		const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+		if (IsAssetRegistered(AssetPath))
+		{
+			SkippedCount++;
+			continue;
+		}
+
+		const FName CategoryName(*CategoryString);
+		if (!Storage->FindCategory(CategoryName))
+		{
+			AddCategoryNoNotify(CategoryName);
+		}
+
+		if (AddAssetNoNotify(CategoryName, AssetPath))
+		{
+			AddedCount++;
+		}
+	}
+
+	FinishBatch(AddedCount);
+
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Rebuilt from registry under %s in %.1f ms: %d tagged, %d added, %d already registered"),
+		*PackagePath, (FPlatformTime::Seconds() - StartTime) * 1000.0, TaggedAssets.Num(), AddedCount, SkippedCount);
+
+	return AddedCount;
+}
+
+void FFXLibraryModel::AddCategoryNoNotify(FName CategoryName)
+{
+	Storage->AddCategory(CategoryName);
+	State->AddCategory(CategoryName);
+
+	FFXJournalRecord Record;
+	Record.Op = EFXJournalOp::AddCategory;
+	Record.CategoryName = CategoryName;
+	CommitChange(Record, false);
+}
+
+bool FFXLibraryModel::AddAssetNoNotify(FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	if (!AssetPath.IsValid() || Storage->IsAssetInCategory(CategoryName, AssetPath)
+		|| !Storage->AddAssetToCategory(CategoryName, AssetPath))
+	{
+		return false;
+	}
+
+	State->InsertCategoryAsset(CategoryName, AssetPath);
+	CommitChange(MakeAssetRecord(EFXJournalOp::AddAsset, CategoryName, AssetPath), false);
+	return true;
+}
+
+bool FFXLibraryModel::RemoveAssetNoNotify(FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	if (Storage->RemoveAssetFromCategory(CategoryName, AssetPath) == 0)
+	{
+		return false;
+	}
+
+	State->EraseCategoryAsset(CategoryName, AssetPath);
+
+	// 다른 카테고리에서도 사용하지 않는 항목이면 변형/참조 정보 제거
+	if (!IsAssetRegistered(AssetPath))
+	{
+		State->AssetVariants.Remove(AssetPath);
+		State->ReferencedAssets.Remove(AssetPath);
+	}
+	CommitChange(MakeAssetRecord(EFXJournalOp::RemoveAsset, CategoryName, AssetPath), false);
+	return true;
+}
+
+bool FFXLibraryModel::ReplaceAssetNoNotify(FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath)
+{
+	if (!NewAssetPath.IsValid() || !Storage->ReplaceAssetInCategory(CategoryName, AssetPath, NewAssetPath))
+	{
+		return false;
+	}
+
+	State->ReplaceCategoryAsset(CategoryName, AssetPath, NewAssetPath);
+
+	// 변형/참조 정보는 새 경로로 따라감 (이전 경로는 다른 카테고리에서도 사용하지 않을 때 제거)
+	if (State->IsReferencedAsset(AssetPath))
+	{
+		State->ReferencedAssets.Add(NewAssetPath);
+	}
+	if (const FFXAssetVariant* Variant = State->FindAssetVariant(AssetPath))
+	{
+		FFXAssetVariant MovedVariant = *Variant;
+		MovedVariant.BasePath = NewAssetPath.GetWithoutSubPath();
+		State->AssetVariants.Add(NewAssetPath, MovedVariant);
+	}
+	if (!IsAssetRegistered(AssetPath))
+	{
+		State->AssetVariants.Remove(AssetPath);
+		State->ReferencedAssets.Remove(AssetPath);
+	}
+
+	FFXJournalRecord Record = MakeAssetRecord(EFXJournalOp::ReplaceAsset, CategoryName, NewAssetPath);
+	Record.PreviousPath = AssetPath;
+	CommitChange(Record, false);
+	return true;
+}
+
+void FFXLibraryModel::FinishBatch(int32 ChangedCount)
+{
+	if (ChangedCount <= 0 && !Storage->IsDirty())
+	{
+		return;
+	}
+
+	State->UpdateVisibleAssets();
+	State->NotifyStateChanged();
+	PublishSnapshot();
+
+	// 스크립트 배치는 디바운스를 기다리지 않고 바로 저장
+	Storage->Flush();
+
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Batch committed: %d entries changed"), ChangedCount);
+}
+
+bool FFXLibraryModel::AddVariantToCategory(FName CategoryName, const FFXAssetVariant& Variant)
+{
+	if (!State.IsValid() || Variant.VariantName.IsNone() || !Variant.BasePath.IsValid())
+	{
+		return false;
+	}
 
-		if (Assets && Assets->Num() > 0)
+	// 변형 정보를 먼저 등록해야 저널 레코드/Settings에 함께 반영됨
+	// 실패 시 다른 카테고리가 사용 중인 기존 변형 정보를 되돌림
+	const FSoftObjectPath EntryPath = Variant.GetEntryPath();
+	TOptional<FFXAssetVariant> PreviousVariant;
+	if (const FFXAssetVariant* ExistingVariant = State->AssetVariants.Find(EntryPath))
+	{
+		PreviousVariant = *ExistingVariant;
+	}
+	State->AssetVariants.Add(EntryPath, Variant);
+
+	if (!AddAssetToCategory(CategoryName, EntryPath))
+	{
+		if (PreviousVariant.IsSet())
 		{
-			ValidCategories.Add(CategoryPtr);
+			State->AssetVariants.Add(EntryPath, PreviousVariant.GetValue());
 		}
 		else
 		{
-			RemovedCount++;
-			UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Removed empty category: %s"), *CategoryName.ToString());
+			State->AssetVariants.Remove(EntryPath);
 		}
+		return false;
 	}
 
-	if (RemovedCount > 0)
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Added variant %s (%d overrides) to %s"),
+		*EntryPath.ToString(), Variant.Overrides.Num(), *CategoryName.ToString());
+	return true;
+}
+
+bool FFXLibraryModel::AddReferencedAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	if (!State.IsValid() || !AssetPath.IsValid())
 	{
-		State->Categories = ValidCategories;
-		State->NotifyStateChanged();
-		SaveToSettings();
+		return false;
 	}
 
-	return RemovedCount;
+	// 이미 복사본으로 등록된 항목은 참조로 바꾸지 않음
+	const bool bWasRegistered = IsAssetRegistered(AssetPath);
+	if (!bWasRegistered)
+	{
+		State->ReferencedAssets.Add(AssetPath);
+	}
+
+	if (!AddAssetToCategory(CategoryName, AssetPath))
+	{
+		if (!bWasRegistered)
+		{
+			State->ReferencedAssets.Remove(AssetPath);
+		}
+		return false;
+	}
+
+	return true;
+}
+
+bool FFXLibraryModel::ValidateCategory(FName CategoryName) const
+{
+	return Storage->FindCategory(CategoryName) != nullptr;
+}
+
+bool FFXLibraryModel::ValidateAsset(const FSoftObjectPath& AssetPath) const
+{
+	// 변형 항목은 기본 에셋 존재 여부로 검증
+	FAssetData AssetData = Registry->GetAssetByObjectPath(AssetPath.GetWithoutSubPath());
+	return AssetData.IsValid();
+}
+
+int32 FFXLibraryModel::CleanupInvalidAssets()
+{
+	if (!State.IsValid())
+	{
+		return 0;
+	}
+
+	return ApplyCleanupResult(FindInvalidEntries(*GetSnapshot(), *Registry));
 }
 
-UFXLibrarySettings* FFXLibraryModel::GetMutableSettings() const
+bool FFXLibraryModel::CleanupInvalidAssetsAsync(FOnFXCleanupComplete OnComplete)
 {
-	return GetMutableDefault<UFXLibrarySettings>();
+	if (!State.IsValid() || PendingCleanup.IsValid())
+	{
+		return false;
+	}
+
+	// 워커는 불변 스냅샷과 레지스트리만 읽음 (레지스트리는 소멸자에서 작업 완료를 기다리므로 원시 포인터로 전달)
+	FFXLibrarySnapshotPtr Snapshot = GetSnapshot();
+	const IFXAssetRegistryView* RegistryView = &Registry.Get();
+	PendingCleanup = Async(EAsyncExecution::ThreadPool, [Snapshot, RegistryView]()
+	{
+		return FindInvalidEntries(*Snapshot, *RegistryView);
+	});
+	PendingCleanupComplete = MoveTemp(OnComplete);
+
+	CleanupTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FFXLibraryModel::TickPendingCleanup));
+	return true;
 }
 
-const UFXLibrarySettings* FFXLibraryModel::GetSettings() const
+bool FFXLibraryModel::TickPendingCleanup(float DeltaTime)
 {
-	return GetDefault<UFXLibrarySettings>();
+	if (!PendingCleanup.IsReady())
+	{
+		return true;
+	}
+
+	const FFXCleanupResult Result = PendingCleanup.Consume();
+	CleanupTickerHandle.Reset();
+
+	const int32 RemovedCount = ApplyCleanupResult(Result);
+	PendingCleanupComplete.ExecuteIfBound(RemovedCount);
+	PendingCleanupComplete.Unbind();
+	return false;
 }
 
+FFXCleanupResult FFXLibraryModel::FindInvalidEntries(const FFXLibrarySnapshot& Snapshot, const IFXAssetRegistryView& Registry)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FFXCleanupResult Result;
+	Result.SnapshotVersion = Snapshot.GetVersion();
+
+	// 1. 기본 에셋 경로 수집 (변형 항목은 기본 에셋으로 검증)
+	TSet<FSoftObjectPath> BasePaths;
+	BasePaths.Reserve(Snapshot.GetNumEntries());
+	for (const FFXCategorySnapshotRef& Category : Snapshot.GetCategories())
+	{
+		for (const FSoftObjectPath& AssetPath : Category->Assets)
+		{
+			BasePaths.Add(AssetPath.GetWithoutSubPath());
+		}
+	}
+
+	// 2. 레지스트리 일괄 조회 1회
+	TArray<FAssetData> FoundAssets;
+	Registry.GetAssetsByObjectPaths(BasePaths.Array(), FoundAssets);
+
+	TMap<FSoftObjectPath, bool> IsRedirectorByPath;
+	IsRedirectorByPath.Reserve(FoundAssets.Num());
+	for (const FAssetData& AssetData : FoundAssets)
+	{
+		IsRedirectorByPath.Add(AssetData.GetSoftObjectPath(), AssetData.IsRedirector());
+	}
+
+	// 3. 항목별 판정 (여러 카테고리에 등록된 참조 항목은 한 번만 해석)
+	TMap<FSoftObjectPath, FSoftObjectPath> ResolvedReferences;
+	for (const FFXCategorySnapshotRef& Category : Snapshot.GetCategories())
+	{
+		const TSet<FSoftObjectPath> ReferencedAssets(Category->ReferencedAssets);
+		for (const FSoftObjectPath& AssetPath : Category->Assets)
+		{
+			Result.NumChecked++;
+
+			const bool* bIsRedirector = IsRedirectorByPath.Find(AssetPath.GetWithoutSubPath());
+			const bool bIsReferenced = ReferencedAssets.Contains(AssetPath);
+			if (bIsRedirector && !(bIsReferenced && *bIsRedirector))
+			{
+				continue;
+			}
+
+			FFXCleanupEntry& Entry = Result.Entries.AddDefaulted_GetRef();
+			Entry.CategoryName = Category->CategoryName;
+			Entry.Path = AssetPath;
+
+			// 참조 항목은 원본 팀이 이동했을 수 있으므로 리다이렉터를 따라감 (소유 복사본은 이동되지 않음)
+			if (bIsReferenced)
+			{
+				const FSoftObjectPath* CachedPath = ResolvedReferences.Find(AssetPath);
+				Entry.RedirectedPath = CachedPath ? *CachedPath : ResolvedReferences.Add(AssetPath, ResolveRedirectedAsset(Registry, AssetPath));
+			}
+		}
+	}
+
+	Result.QuerySeconds = FPlatformTime::Seconds() - StartTime;
+	return Result;
+}
+
+int32 FFXLibraryModel::ApplyCleanupResult(const FFXCleanupResult& Result)
+{
+	if (!State.IsValid() || Result.Entries.Num() == 0)
+	{
+		return 0;
+	}
+
+	FFXLibraryState::FScopedBatch Batch(*State);
+
+	int32 RemovedCount = 0;
+	int32 RedirectedCount = 0;
+
+	// 항목마다 저널 레코드로 반영 (교체는 원래 위치 유지, 변형/참조 정보는 NoNotify 함수가 정리)
+	// 스냅샷 이후 제거/이동된 항목은 저장소에 없으므로 건너뜀
+	for (const FFXCleanupEntry& Entry : Result.Entries)
+	{
+		if (Entry.RedirectedPath.IsValid())
+		{
+			if (ReplaceAssetNoNotify(Entry.CategoryName, Entry.Path, Entry.RedirectedPath))
+			{
+				RedirectedCount++;
+				UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Followed moved referenced asset: %s -> %s"),
+					*Entry.Path.ToString(), *Entry.RedirectedPath.ToString());
+			}
+			continue;
+		}
+
+		const bool bWasReferenced = State->IsReferencedAsset(Entry.Path);
+		if (RemoveAssetNoNotify(Entry.CategoryName, Entry.Path))
+		{
+			RemovedCount++;
+			if (bWasReferenced)
+			{
+				UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Removed missing referenced asset: %s"), *Entry.Path.ToString());
+			}
+			else
+			{
+				UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Removed invalid asset: %s"), *Entry.Path.ToString());
+			}
+		}
+	}
+
+	if (RemovedCount > 0 || RedirectedCount > 0)
+	{
+		// 저장은 쓰기 지연 (CommitChange로 예약됨)
+		State->UpdateVisibleAssets();
+		State->NotifyStateChanged();
+		PublishSnapshot();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Validated %d entries (snapshot v%llu) in %.1f ms: %d removed, %d redirected"),
+		Result.NumChecked, Result.SnapshotVersion, Result.QuerySeconds * 1000.0, RemovedCount, RedirectedCount);
+
+	return RemovedCount;
+}
+
+int32 FFXLibraryModel::ApplyRegistryChanges(TConstArrayView<FFXAssetRegistryChange> Changes)
+{
+	if (!State.IsValid() || Changes.Num() == 0)
+	{
+		return 0;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	FFXLibraryState::FScopedBatch Batch(*State);
+
+	int32 RemovedCount = 0;
+	int32 RenamedCount = 0;
+	int32 RestoredCount = 0;
+
+	// 발생 순서대로 적용 (삭제 후 되돌리기, 연속 이름 변경)
+	for (const FFXAssetRegistryChange& Change : Changes)
+	{
+		switch (Change.Type)
+		{
+		case EFXAssetRegistryChange::Removed:
+			RemovedCount += RemoveDeletedAsset(Change.AssetPath);
+			break;
+
+		case EFXAssetRegistryChange::Renamed:
+			RenamedCount += FollowRenamedAsset(Change.OldAssetPath, Change.AssetPath);
+			break;
+
+		case EFXAssetRegistryChange::Added:
+			RestoredCount += RestoreRemovedAsset(Change.AssetPath);
+			break;
+		}
+	}
+
+	const int32 ChangedCount = RemovedCount + RenamedCount + RestoredCount;
+	if (ChangedCount > 0)
+	{
+		// 저장은 쓰기 지연 (CommitChange로 예약됨)
+		State->UpdateVisibleAssets();
+		State->NotifyStateChanged();
+		PublishSnapshot();
+
+		UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Applied %d registry changes in %.2f ms: %d removed, %d renamed, %d restored"),
+			Changes.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0, RemovedCount, RenamedCount, RestoredCount);
+	}
+
+	return ChangedCount;
+}
+
+bool FFXLibraryModel::IsAffectedByRegistryChange(EFXAssetRegistryChange Type, const FSoftObjectPath& AssetPath) const
+{
+	if (!State.IsValid())
+	{
+		return false;
+	}
+
+	if (Type == EFXAssetRegistryChange::Added)
+	{
+		return RecentlyRemoved.Contains(AssetPath.GetWithoutSubPath());
+	}
+	return State->HasAssetEntries(AssetPath);
+}
+
+int32 FFXLibraryModel::RemoveDeletedAsset(const FSoftObjectPath& AssetPath)
+{
+	TArray<TPair<FName, FSoftObjectPath>> Entries;
+	State->FindAssetEntries(AssetPath, Entries);
+	if (Entries.Num() == 0)
+	{
+		return 0;
+	}
+
+	// 제거하면 변형/참조 정보도 지워지므로 먼저 기록
+	TArray<FFXRemovedEntry> RemovedEntries;
+	RemovedEntries.Reserve(Entries.Num());
+	for (const TPair<FName, FSoftObjectPath>& Entry : Entries)
+	{
+		FFXRemovedEntry& RemovedEntry = RemovedEntries.AddDefaulted_GetRef();
+		RemovedEntry.CategoryName = Entry.Key;
+		RemovedEntry.Path = Entry.Value;
+		RemovedEntry.bReferenced = State->IsReferencedAsset(Entry.Value);
+		if (const FFXAssetVariant* Variant = State->FindAssetVariant(Entry.Value))
+		{
+			RemovedEntry.Variant = *Variant;
+		}
+	}
+
+	int32 RemovedCount = 0;
+	for (const FFXRemovedEntry& RemovedEntry : RemovedEntries)
+	{
+		if (RemoveAssetNoNotify(RemovedEntry.CategoryName, RemovedEntry.Path))
+		{
+			RemovedCount++;
+			UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Removed deleted asset: %s (%s)"),
+				*RemovedEntry.Path.ToString(), *RemovedEntry.CategoryName.ToString());
+		}
+	}
+
+	// 같은 경로로 다시 추가되면 복원할 수 있도록 유지 (가장 오래된 기록부터 버림)
+	const FSoftObjectPath AssetKey = AssetPath.GetWithoutSubPath();
+	if (RecentlyRemoved.Contains(AssetKey))
+	{
+		RecentlyRemovedOrder.Remove(AssetKey);
+	}
+	RecentlyRemoved.Add(AssetKey, MoveTemp(RemovedEntries));
+	RecentlyRemovedOrder.Add(AssetKey);
+	if (RecentlyRemovedOrder.Num() > MaxRecentlyRemovedAssets)
+	{
+		RecentlyRemoved.Remove(RecentlyRemovedOrder[0]);
+		RecentlyRemovedOrder.RemoveAt(0);
+	}
+
+	return RemovedCount;
+}
+
+int32 FFXLibraryModel::FollowRenamedAsset(const FSoftObjectPath& OldAssetPath, const FSoftObjectPath& NewAssetPath)
+{
+	TArray<TPair<FName, FSoftObjectPath>> Entries;
+	State->FindAssetEntries(OldAssetPath, Entries);
+
+	int32 RenamedCount = 0;
+	for (const TPair<FName, FSoftObjectPath>& Entry : Entries)
+	{
+		// 변형 SubPath 유지
+		const FSoftObjectPath NewEntryPath(NewAssetPath.GetAssetPath(), Entry.Value.GetSubPathString());
+		if (ReplaceAssetNoNotify(Entry.Key, Entry.Value, NewEntryPath))
+		{
+			RenamedCount++;
+			UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Followed renamed asset: %s -> %s"),
+				*Entry.Value.ToString(), *NewEntryPath.ToString());
+		}
+	}
+
+	return RenamedCount;
+}
+
+int32 FFXLibraryModel::RestoreRemovedAsset(const FSoftObjectPath& AssetPath)
+{
+	const FSoftObjectPath AssetKey = AssetPath.GetWithoutSubPath();
+	TArray<FFXRemovedEntry> RemovedEntries;
+	if (!RecentlyRemoved.RemoveAndCopyValue(AssetKey, RemovedEntries))
+	{
+		return 0;
+	}
+	RecentlyRemovedOrder.Remove(AssetKey);
+
+	int32 RestoredCount = 0;
+	for (const FFXRemovedEntry& RemovedEntry : RemovedEntries)
+	{
+		// 그 사이 삭제된 카테고리는 다시 만들지 않음
+		if (!Storage->FindCategory(RemovedEntry.CategoryName))
+		{
+			continue;
+		}
+
+		// 변형/참조 정보를 먼저 등록해야 저널 레코드/저장소에 함께 반영됨 (이미 다른 형태로 등록된 항목은 그대로)
+		if (!IsAssetRegistered(RemovedEntry.Path))
+		{
+			if (RemovedEntry.bReferenced)
+			{
+				State->ReferencedAssets.Add(RemovedEntry.Path);
+			}
+			if (RemovedEntry.Variant.IsSet())
+			{
+				State->AssetVariants.Add(RemovedEntry.Path, RemovedEntry.Variant.GetValue());
+			}
+		}
+
+		if (AddAssetNoNotify(RemovedEntry.CategoryName, RemovedEntry.Path))
+		{
+			RestoredCount++;
+			UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Restored re-added asset: %s (%s)"),
+				*RemovedEntry.Path.ToString(), *RemovedEntry.CategoryName.ToString());
+		}
+		else if (!IsAssetRegistered(RemovedEntry.Path))
+		{
+			State->AssetVariants.Remove(RemovedEntry.Path);
+			State->ReferencedAssets.Remove(RemovedEntry.Path);
+		}
+	}
+
+	return RestoredCount;
+}
+
+int32 FFXLibraryModel::CleanupEmptyCategories()
+{
+	if (!State.IsValid())
+	{
+		return 0;
+	}
+
+	// 순회 중 State->Categories가 바뀌지 않도록 빈 카테고리를 먼저 수집
+	TArray<FName> EmptyCategories;
+	for (const TSharedPtr<FName>& CategoryPtr : State->Categories)
+	{
+		if (CategoryPtr.IsValid() && State->GetCategoryAssetCount(*CategoryPtr) == 0)
+		{
+			EmptyCategories.Add(*CategoryPtr);
+		}
+	}
+
+	// 카테고리마다 RemoveCategory 경로로 제거 (저널 레코드 기록, 선택된 카테고리 해제), 알림은 1회로 합침
+	FFXLibraryState::FScopedBatch Batch(*State);
+
+	int32 RemovedCount = 0;
+	for (FName CategoryName : EmptyCategories)
+	{
+		if (RemoveCategory(CategoryName))
+		{
+			RemovedCount++;
+			UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Removed empty category: %s"), *CategoryName.ToString());
+		}
+	}
+
+	return RemovedCount;
+}
+
+void FFXLibraryModel::RebuildStorageCategories()
+{
+	TArray<FFXCategoryData>& StoredCategories = Storage->GetCategories();
+	StoredCategories.Empty();
+
+	for (const TSharedPtr<FName>& CategoryPtr : State->Categories)
+	{
+		if (!CategoryPtr.IsValid())
+		{
+			continue;
+		}
+
+		FName CategoryName = *CategoryPtr;
+		FFXCategoryData CategoryData;
+		CategoryData.CategoryName = CategoryName;
+
+		// 아이콘 경로
+		if (const FSoftObjectPath* IconPath = State->CategoryIcons.Find(CategoryName))
+		{
+			CategoryData.IconPath = *IconPath;
+		}
+
+		// 에셋 목록
+		CategoryData.Assets = State->GetCategoryAssets(CategoryName);
+
+		// 카테고리에 등록된 변형 정보
+		for (const FSoftObjectPath& AssetPath : CategoryData.Assets)
+		{
+			if (const FFXAssetVariant* Variant = State->FindAssetVariant(AssetPath))
+			{
+				CategoryData.Variants.Add(*Variant);
+			}
+			if (State->IsReferencedAsset(AssetPath))
+			{
+				CategoryData.ReferencedAssets.Add(AssetPath);
+			}
+		}
+
+		StoredCategories.Add(CategoryData);
+	}
+
+	Storage->InvalidateCategoryIndex();
+}
+
+void FFXLibraryModel::CommitChange(const FFXJournalRecord& Record, bool bPublishSnapshot)
+{
+	// 카테고리/에셋 목록은 저장소 변경 함수가 이미 반영했으므로 변형/참조 정보만 반영 (다른 패널의 로드가 최신 데이터를 보도록)
+	if (FFXCategoryData* Category = Storage->FindCategory(Record.CategoryName))
+	{
+		FFXLibraryDatabase::ApplyRecordMetadata(Record, *Category);
+	}
+
+	// 저장은 쓰기 지연 (Ini: config 1회, Database: 저널 일괄 추가)
+	Storage->MarkDirty(Record);
+
+	SnapshotPublisher->MarkCategoryDirty(Record.CategoryName);
+	if (bPublishSnapshot)
+	{
+		PublishSnapshot();
+	}
+}
+
+void FFXLibraryModel::PublishSnapshot()
+{
+	SnapshotPublisher->Publish(Storage->GetCategories());
+	ResolveSearchAttributes();
+}
+
+void FFXLibraryModel::ResolveSearchAttributes()
+{
+	if (!State.IsValid())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetPaths;
+	State->ConsumePendingSearchAttributeAssets(AssetPaths);
+	if (AssetPaths.Num() == 0)
+	{
+		return;
+	}
+
+	// 태그만 읽으므로 에셋 로드 없음 (레지스트리에 없는 항목은 이름/카테고리로만 검색)
+	TArray<FAssetData> Assets;
+	Registry->GetAssetsByObjectPaths(AssetPaths, Assets);
+
+	static const FName NiagaraSystemClassName(TEXT("NiagaraSystem"));
+
+	bool bChanged = false;
+	for (const FAssetData& AssetData : Assets)
+	{
+		const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+
+		FString Hashtags;
+		AssetData.GetTagValue(FFXAssetLibConstants::HashtagsMetadataTag, Hashtags);
+		bChanged |= State->SetSearchAttributes(AssetPath, AssetData.AssetClassPath.GetAssetName(), Hashtags);
+
+		// 유사 이펙트 특징: 태그에 캐시된 값 사용, 없으면 백그라운드 추출 대기열로
+		FString FeaturesText;
+		FFXEffectFeatures Features;
+		if (AssetData.GetTagValue(FFXAssetLibConstants::FeaturesMetadataTag, FeaturesText)
+			&& FFXEffectFeatures::ParseTagString(FeaturesText, Features))
+		{
+			bChanged |= State->SetEffectFeatures(AssetPath, Features);
+		}
+		else if (AssetData.AssetClassPath.GetAssetName() == NiagaraSystemClassName && !State->HasEffectFeatures(AssetPath))
+		{
+			bool bAlreadyPending = false;
+			PendingFeatureAssetSet.Add(AssetPath, &bAlreadyPending);
+			if (!bAlreadyPending)
+			{
+				PendingFeatureAssets.Add(AssetPath);
+			}
+		}
+	}
+
+	if (bChanged)
+	{
+		State->UpdateVisibleAssets();
+	}
+}
+
+void FFXLibraryModel::ConsumePendingFeatureAssets(TArray<FSoftObjectPath>& OutAssetPaths, int32 MaxCount)
+{
+	OutAssetPaths.Reset();
+	if (!State.IsValid())
+	{
+		return;
+	}
+
+	// 대기 중 제거되었거나 이미 특징이 생긴 에셋은 건너뜀 (앞에서부터 꺼내므로 추가 순서대로 처리)
+	int32 NumConsumed = 0;
+	while (NumConsumed < PendingFeatureAssets.Num() && OutAssetPaths.Num() < MaxCount)
+	{
+		const FSoftObjectPath& AssetPath = PendingFeatureAssets[NumConsumed++];
+		PendingFeatureAssetSet.Remove(AssetPath);
+		if (State->HasAssetEntries(AssetPath) && !State->HasEffectFeatures(AssetPath))
+		{
+			OutAssetPaths.Add(AssetPath);
+		}
+	}
+	PendingFeatureAssets.RemoveAt(0, NumConsumed, EAllowShrinking::No);
+}
+
+bool FFXLibraryModel::SetEffectFeatures(const FSoftObjectPath& AssetPath, const FFXEffectFeatures& Features)
+{
+	if (!State.IsValid() || !State->SetEffectFeatures(AssetPath, Features))
+	{
+		return false;
+	}
+
+	State->UpdateVisibleAssets();
+	return true;
+}
+
+FFXJournalRecord FFXLibraryModel::MakeAssetRecord(EFXJournalOp Op, FName CategoryName, const FSoftObjectPath& AssetPath) const
+{
+	FFXJournalRecord Record;
+	Record.Op = Op;
+	Record.CategoryName = CategoryName;
+	Record.Path = AssetPath;
+
+	if ((Op == EFXJournalOp::AddAsset || Op == EFXJournalOp::ReplaceAsset) && State.IsValid())
+	{
+		Record.bReferenced = State->IsReferencedAsset(AssetPath);
+		if (const FFXAssetVariant* Variant = State->FindAssetVariant(AssetPath))
+		{
+			Record.bHasVariant = true;
+			Record.Variant = *Variant;
+		}
+	}
+
+	return Record;
+}
+
+bool FFXLibraryModel::IsAssetRegistered(const FSoftObjectPath& AssetPath) const
+{
+	if (!State.IsValid())
+	{
+		return false;
+	}
+
+	return State->IsAssetInAnyCategory(AssetPath);
+}
+
+void FFXLibraryModel::ApplyExternalChanges(const TArray<FName>& ChangedCategories, const TArray<FName>& RemovedCategories)
+{
+	if (!State.IsValid())
+	{
+		return;
+	}
+
+	// 외부 동기화 1회의 카테고리 추가/제거/교체를 알림 1회로 합침
+	FFXLibraryState::FScopedBatch Batch(*State);
+
+	// 바뀐 카테고리의 기존 항목 (다른 카테고리에서 쓰지 않으면 변형/참조 정보 제거)
+	TSet<FSoftObjectPath> PreviousAssets;
+	auto CollectPreviousAssets = [this, &PreviousAssets](FName CategoryName)
+	{
+		PreviousAssets.Append(State->GetCategoryAssets(CategoryName));
+	};
+
+	for (FName CategoryName : RemovedCategories)
+	{
+		CollectPreviousAssets(CategoryName);
+		if (State->SelectedCategory.IsValid() && *State->SelectedCategory == CategoryName)
+		{
+			State->SelectedCategory.Reset();
+		}
+		State->RemoveCategory(CategoryName);
+	}
+
+	for (FName CategoryName : ChangedCategories)
+	{
+		const FFXCategoryData* CategoryData = Storage->FindCategory(CategoryName);
+		if (!CategoryData)
+		{
+			continue;
+		}
+
+		CollectPreviousAssets(CategoryName);
+		State->AddCategory(CategoryName);
+		State->SetCategoryAssets(CategoryName, CategoryData->Assets);
+
+		if (CategoryData->IconPath.IsValid())
+		{
+			State->CategoryIcons.Add(CategoryName, CategoryData->IconPath);
+		}
+		else
+		{
+			State->CategoryIcons.Remove(CategoryName);
+		}
+
+		for (const FFXAssetVariant& Variant : CategoryData->Variants)
+		{
+			State->AssetVariants.Add(Variant.GetEntryPath(), Variant);
+		}
+		State->ReferencedAssets.Append(CategoryData->ReferencedAssets);
+	}
+
+	for (const FSoftObjectPath& AssetPath : PreviousAssets)
+	{
+		if (!IsAssetRegistered(AssetPath))
+		{
+			State->AssetVariants.Remove(AssetPath);
+			State->ReferencedAssets.Remove(AssetPath);
+		}
+	}
+
+	State->UpdateVisibleAssets();
+	State->NotifyStateChanged();
+
+	for (FName CategoryName : ChangedCategories)
+	{
+		SnapshotPublisher->MarkCategoryDirty(CategoryName);
+	}
+	for (FName CategoryName : RemovedCategories)
+	{
+		SnapshotPublisher->MarkCategoryDirty(CategoryName);
+	}
+	PublishSnapshot();
+}
+
+FSoftObjectPath FFXLibraryModel::ResolveRedirectedAsset(const IFXAssetRegistryView& Registry, const FSoftObjectPath& AssetPath)
+{
+	// 이동된 에셋은 원래 경로에 ObjectRedirector를 남김
+	FSoftObjectPath CurrentPath = AssetPath.GetWithoutSubPath();
+	for (int32 Depth = 0; Depth < 8; ++Depth)
+	{
+		TArray<FAssetData> PackageAssets;
+		Registry.GetAssetsByPackageName(CurrentPath.GetLongPackageFName(), PackageAssets);
+
+		const FAssetData* Redirector = PackageAssets.FindByPredicate([](const FAssetData& Data)
+		{
+			return Data.IsRedirector();
+		});
+		if (!Redirector)
+		{
+			return FSoftObjectPath();
+		}
+
+		FString DestinationObject;
+		if (!Redirector->GetTagValue(TEXT("DestinationObject"), DestinationObject))
+		{
+			return FSoftObjectPath();
+		}
+
+		CurrentPath = FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(DestinationObject));
+
+		// 다시 이동된 에셋(A -> B -> C)은 대상도 리다이렉터이므로 계속 따라감
+		const FAssetData Destination = Registry.GetAssetByObjectPath(CurrentPath);
+		if (Destination.IsValid() && !Destination.IsRedirector())
+		{
+			// 변형 SubPath 유지
+			return FSoftObjectPath(CurrentPath.GetAssetPath(), AssetPath.GetSubPathString());
+		}
+	}
+
+	return FSoftObjectPath();
+}
@@ -0,0 +1,474 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXLibrarySearchIndex.h"
+#include "Algo/BinarySearch.h"
+
+namespace FXLibrarySearchPrivate
+{
+	// 토큰 키는 모두 소문자이므로 대소문자 구분 비교로 사전순 유지
+	struct FTokenKeyLess
+	{
+		bool operator()(const FString& A, const FString& B) const
+		{
+			return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+		}
+	};
+
+	static EFXSearchField ParseFieldName(const FString& FieldName)
+	{
+		if (FieldName == TEXT("name"))
+		{
+			return EFXSearchField::Name;
+		}
+		if (FieldName == TEXT("cat") || FieldName == TEXT("category"))
+		{
+			return EFXSearchField::Category;
+		}
+		if (FieldName == TEXT("tag") || FieldName == TEXT("hashtag"))
+		{
+			return EFXSearchField::Hashtag;
+		}
+		if (FieldName == TEXT("class") || FieldName == TEXT("type"))
+		{
+			return EFXSearchField::Class;
+		}
+		return EFXSearchField::None;
+	}
+
+	static TCHAR GetFieldKeyChar(EFXSearchField Field)
+	{
+		switch (Field)
+		{
+		case EFXSearchField::Name:     return TEXT('n');
+		case EFXSearchField::Category: return TEXT('c');
+		case EFXSearchField::Hashtag:  return TEXT('t');
+		case EFXSearchField::Class:    return TEXT('k');
+		default:                       return TEXT('?');
+		}
+	}
+
+	static const EFXSearchField SingleFields[] = { EFXSearchField::Name, EFXSearchField::Category, EFXSearchField::Hashtag, EFXSearchField::Class };
+}
+
+// ===== FFXSearchQuery =====
+
+FFXSearchQuery FFXSearchQuery::Parse(const FString& Text)
+{
+	FFXSearchQuery Query;
+
+	TArray<FString> Terms;
+	Text.ToLower().ParseIntoArrayWS(Terms);
+
+	for (FString& Term : Terms)
+	{
+		FClause Clause;
+		if (Term.StartsWith(TEXT("-")))
+		{
+			Clause.bNegated = true;
+			Term.RightChopInline(1);
+		}
+
+		TArray<FString> Parts;
+		Term.ParseIntoArray(Parts, TEXT("|"));
+		for (FString& Part : Parts)
+		{
+			FAlternative Alternative;
+
+			int32 ColonIndex = INDEX_NONE;
+			if (Part.StartsWith(TEXT("#")))
+			{
+				Alternative.Fields = EFXSearchField::Hashtag;
+			}
+			else if (Part.FindChar(TEXT(':'), ColonIndex))
+			{
+				const EFXSearchField Field = FXLibrarySearchPrivate::ParseFieldName(Part.Left(ColonIndex));
+				if (Field != EFXSearchField::None)
+				{
+					Alternative.Fields = Field;
+					Part.RightChopInline(ColonIndex + 1);
+				}
+			}
+
+			Part.TrimCharInline(TEXT('#'), nullptr);
+			Alternative.Prefix = MoveTemp(Part);
+
+			// 필드만 지정한 빈 접두어("#", "cat:")는 해당 필드가 있는 항목 전체, 필드 없는 빈 값은 무시
+			if (!Alternative.Prefix.IsEmpty() || Alternative.Fields != EFXSearchField::All)
+			{
+				Clause.Alternatives.Add(MoveTemp(Alternative));
+			}
+		}
+
+		if (Clause.Alternatives.Num() > 0)
+		{
+			Query.Clauses.Add(MoveTemp(Clause));
+		}
+	}
+
+	return Query;
+}
+
+// ===== FFXLibrarySearchIndex =====
+
+void FFXLibrarySearchIndex::AddEntry(FFXPathId PathId, const FSoftObjectPath& Path, FName CategoryName)
+{
+	if (PathId >= static_cast<uint32>(Documents.Num()))
+	{
+		Documents.SetNum(PathId + 1);
+		LiveDocuments.SetNum(PathId + 1, false);
+	}
+
+	FDocument& Document = Documents[PathId];
+	if (Document.Categories.Contains(CategoryName))
+	{
+		return;
+	}
+
+	if (Document.Categories.Num() == 0)
+	{
+		// 첫 카테고리: 이름 토큰 색인 (변형 항목은 변형 이름도 포함), 속성은 모델이 조회할 때까지 대기
+		TArray<FString> Tokens;
+		TokenizeName(Path.GetAssetName(), Tokens);
+		if (!Path.GetSubPathString().IsEmpty())
+		{
+			TokenizeName(Path.GetSubPathString(), Tokens);
+		}
+
+		Document.NameTokens.Reset();
+		for (const FString& Token : Tokens)
+		{
+			Document.NameTokens.Add(FindOrAddToken(MakeTokenKey(EFXSearchField::Name, Token)));
+		}
+		AddPostings(PathId, Document.NameTokens);
+
+		if (!Document.bAttributesPending)
+		{
+			Document.bAttributesPending = true;
+			PendingAttributeIds.Add(PathId);
+		}
+
+		LiveDocuments[PathId] = true;
+		NumLiveDocuments++;
+	}
+
+	Document.Categories.Add(CategoryName);
+	const int32 CategoryToken = FindOrAddToken(MakeTokenKey(EFXSearchField::Category, CategoryName.ToString().ToLower()));
+	Postings[CategoryToken].Add(PathId);
+}
+
+void FFXLibrarySearchIndex::RemoveEntry(FFXPathId PathId, FName CategoryName)
+{
+	if (PathId >= static_cast<uint32>(Documents.Num()))
+	{
+		return;
+	}
+
+	FDocument& Document = Documents[PathId];
+	if (Document.Categories.RemoveSingleSwap(CategoryName) == 0)
+	{
+		return;
+	}
+
+	if (const int32* CategoryToken = TokenLookup.Find(MakeTokenKey(EFXSearchField::Category, CategoryName.ToString().ToLower())))
+	{
+		Postings[*CategoryToken].Remove(PathId);
+	}
+
+	if (Document.Categories.Num() == 0)
+	{
+		// 라이브러리에서 빠진 항목: 다시 추가되면 속성도 다시 조회
+		RemovePostings(PathId, Document.NameTokens);
+		RemovePostings(PathId, Document.AttributeTokens);
+		Document.NameTokens.Reset();
+		Document.AttributeTokens.Reset();
+
+		LiveDocuments[PathId] = false;
+		NumLiveDocuments--;
+	}
+}
+
+TConstArrayView<FName> FFXLibrarySearchIndex::GetEntryCategories(FFXPathId PathId) const
+{
+	if (PathId >= static_cast<uint32>(Documents.Num()))
+	{
+		return TConstArrayView<FName>();
+	}
+	return Documents[PathId].Categories;
+}
+
+void FFXLibrarySearchIndex::RemoveCategory(FName CategoryName)
+{
+	const int32* CategoryToken = TokenLookup.Find(MakeTokenKey(EFXSearchField::Category, CategoryName.ToString().ToLower()));
+	if (!CategoryToken)
+	{
+		return;
+	}
+
+	// 제거 중 포스팅이 바뀌므로 복사 후 순회
+	const TArray<FFXPathId> PathIds = Postings[*CategoryToken].ToArray();
+	for (FFXPathId PathId : PathIds)
+	{
+		RemoveEntry(PathId, CategoryName);
+	}
+}
+
+bool FFXLibrarySearchIndex::SetAttributes(FFXPathId PathId, FName ClassName, const FString& Hashtags)
+{
+	if (PathId >= static_cast<uint32>(Documents.Num()) || !LiveDocuments[PathId])
+	{
+		return false;
+	}
+
+	FDocument& Document = Documents[PathId];
+	Document.bAttributesPending = false;
+
+	TArray<int32, TInlineAllocator<4>> NewTokens;
+	if (!ClassName.IsNone())
+	{
+		NewTokens.Add(FindOrAddToken(MakeTokenKey(EFXSearchField::Class, ClassName.ToString().ToLower())));
+	}
+
+	static const TCHAR* Delimiters[] = { TEXT(","), TEXT(" "), TEXT(";"), TEXT("\t") };
+	TArray<FString> Tags;
+	Hashtags.ParseIntoArray(Tags, Delimiters, UE_ARRAY_COUNT(Delimiters));
+	for (FString& Tag : Tags)
+	{
+		Tag.TrimCharInline(TEXT('#'), nullptr);
+		if (!Tag.IsEmpty())
+		{
+			NewTokens.AddUnique(FindOrAddToken(MakeTokenKey(EFXSearchField::Hashtag, Tag.ToLower())));
+		}
+	}
+
+	if (NewTokens == Document.AttributeTokens)
+	{
+		return false;
+	}
+
+	RemovePostings(PathId, Document.AttributeTokens);
+	Document.AttributeTokens = MoveTemp(NewTokens);
+	AddPostings(PathId, Document.AttributeTokens);
+	return true;
+}
+
+void FFXLibrarySearchIndex::ConsumePendingAttributeIds(TArray<FFXPathId>& OutIds)
+{
+	OutIds.Reset();
+	OutIds.Reserve(PendingAttributeIds.Num());
+
+	// 대기 중 제거된 항목은 건너뜀 (다시 추가되면 새로 대기)
+	for (FFXPathId PathId : PendingAttributeIds)
+	{
+		FDocument& Document = Documents[PathId];
+		if (Document.bAttributesPending)
+		{
+			Document.bAttributesPending = false;
+			if (LiveDocuments[PathId])
+			{
+				OutIds.Add(PathId);
+			}
+		}
+	}
+	PendingAttributeIds.Reset();
+}
+
+void FFXLibrarySearchIndex::Search(const FFXSearchQuery& Query, TArray<FFXPathId>& OutIds) const
+{
+	using namespace FXLibrarySearchPrivate;
+
+	OutIds.Reset();
+	if (NumLiveDocuments == 0)
+	{
+		return;
+	}
+
+	TBitArray<> Result = LiveDocuments;
+	TBitArray<> ClauseMatches;
+
+	// 포함 절을 먼저 적용하고 결과가 비면 중단 (제외 절은 남은 결과에만)
+	for (const bool bNegatedPass : { false, true })
+	{
+		for (const FFXSearchQuery::FClause& Clause : Query.Clauses)
+		{
+			if (Clause.bNegated != bNegatedPass)
+			{
+				continue;
+			}
+
+			ClauseMatches.Init(false, Documents.Num());
+			for (const FFXSearchQuery::FAlternative& Alternative : Clause.Alternatives)
+			{
+				for (EFXSearchField Field : SingleFields)
+				{
+					if (EnumHasAnyFlags(Alternative.Fields, Field))
+					{
+						CollectPrefix(MakeTokenKey(Field, Alternative.Prefix), ClauseMatches);
+					}
+				}
+			}
+
+			if (Clause.bNegated)
+			{
+				ClauseMatches.BitwiseNOT();
+			}
+			Result.CombineWithBitwiseAND(ClauseMatches, EBitwiseOperatorFlags::MaintainSize);
+
+			if (Result.Find(true) == INDEX_NONE)
+			{
+				return;
+			}
+		}
+	}
+
+	OutIds.Reserve(Result.CountSetBits());
+	for (TConstSetBitIterator<> It(Result); It; ++It)
+	{
+		OutIds.Add(static_cast<FFXPathId>(It.GetIndex()));
+	}
+}
+
+void FFXLibrarySearchIndex::Reset()
+{
+	Documents.Reset();
+	LiveDocuments.Reset();
+	NumLiveDocuments = 0;
+	TokenKeys.Reset();
+	TokenLookup.Reset();
+	SortedTokens.Reset();
+	Postings.Reset();
+	PendingAttributeIds.Reset();
+}
+
+SIZE_T FFXLibrarySearchIndex::GetAllocatedSize() const
+{
+	SIZE_T Size = Documents.GetAllocatedSize() + LiveDocuments.GetAllocatedSize()
+		+ TokenKeys.GetAllocatedSize() + TokenLookup.GetAllocatedSize() + SortedTokens.GetAllocatedSize()
+		+ Postings.GetAllocatedSize() + PendingAttributeIds.GetAllocatedSize();
+
+	for (const FDocument& Document : Documents)
+	{
+		Size += Document.NameTokens.GetAllocatedSize() + Document.AttributeTokens.GetAllocatedSize() + Document.Categories.GetAllocatedSize();
+	}
+	for (const FString& Key : TokenKeys)
+	{
+		Size += Key.GetAllocatedSize();
+	}
+	for (const TFXOrderedIndexSet<FFXPathId>& Posting : Postings)
+	{
+		Size += Posting.GetAllocatedSize();
+	}
+	return Size;
+}
+
+void FFXLibrarySearchIndex::TokenizeName(const FString& Name, TArray<FString>& OutTokens)
+{
+	FString Current;
+	auto FlushToken = [&OutTokens, &Current]()
+	{
+		if (!Current.IsEmpty())
+		{
+			OutTokens.AddUnique(Current);
+			Current.Reset();
+		}
+	};
+
+	// 전체 이름 (구분자 포함 접두어 검색용, 예: "ns_fire")
+	const FString LowerName = Name.ToLower();
+	if (!LowerName.IsEmpty())
+	{
+		OutTokens.AddUnique(LowerName);
+	}
+
+	for (int32 Index = 0; Index < Name.Len(); ++Index)
+	{
+		const TCHAR Char = Name[Index];
+		if (!FChar::IsAlnum(Char))
+		{
+			FlushToken();
+			continue;
+		}
+
+		if (!Current.IsEmpty())
+		{
+			// FireBall -> fire, ball / FXSmoke -> fx, smoke / Smoke01 -> smoke, 01
+			const TCHAR Prev = Name[Index - 1];
+			const bool bCaseBoundary = FChar::IsUpper(Char)
+				&& (FChar::IsLower(Prev) || (FChar::IsUpper(Prev) && Index + 1 < Name.Len() && FChar::IsLower(Name[Index + 1])));
+			const bool bDigitBoundary = FChar::IsDigit(Char) != FChar::IsDigit(Prev);
+			if (bCaseBoundary || bDigitBoundary)
+			{
+				FlushToken();
+			}
+		}
+
+		Current.AppendChar(FChar::ToLower(Char));
+	}
+	FlushToken();
+}
+
+FString FFXLibrarySearchIndex::MakeTokenKey(EFXSearchField Field, const FString& Token)
+{
+	FString Key;
+	Key.Reserve(Token.Len() + 2);
+	Key.AppendChar(FXLibrarySearchPrivate::GetFieldKeyChar(Field));
+	Key.AppendChar(TEXT(':'));
+	Key += Token;
+	return Key;
+}
+
+int32 FFXLibrarySearchIndex::FindOrAddToken(const FString& Key)
+{
+	if (const int32* Existing = TokenLookup.Find(Key))
+	{
+		return *Existing;
+	}
+
+	// 토큰은 포스팅이 비어도 유지 (같은 이름이 다시 등록되는 경우가 많고 사전 크기는 고유 토큰 수로 제한)
+	const int32 TokenId = TokenKeys.Add(Key);
+	TokenLookup.Add(Key, TokenId);
+	Postings.AddDefaulted();
+
+	const int32 InsertIndex = Algo::LowerBoundBy(SortedTokens, Key,
+		[this](int32 Id) -> const FString& { return TokenKeys[Id]; },
+		FXLibrarySearchPrivate::FTokenKeyLess());
+	SortedTokens.Insert(TokenId, InsertIndex);
+	return TokenId;
+}
+
+void FFXLibrarySearchIndex::AddPostings(FFXPathId PathId, TConstArrayView<int32> TokenIds)
+{
+	for (int32 TokenId : TokenIds)
+	{
+		Postings[TokenId].Add(PathId);
+	}
+}
+
+void FFXLibrarySearchIndex::RemovePostings(FFXPathId PathId, TConstArrayView<int32> TokenIds)
+{
+	for (int32 TokenId : TokenIds)
+	{
+		Postings[TokenId].Remove(PathId);
+	}
+}
+
+void FFXLibrarySearchIndex::CollectPrefix(const FString& KeyPrefix, TBitArray<>& InOutMatches) const
+{
+	// 접두어로 시작하는 키는 사전순으로 연속
+	int32 Index = Algo::LowerBoundBy(SortedTokens, KeyPrefix,
+		[this](int32 Id) -> const FString& { return TokenKeys[Id]; },
+		FXLibrarySearchPrivate::FTokenKeyLess());
+
+	for (; Index < SortedTokens.Num(); ++Index)
+	{
+		const int32 TokenId = SortedTokens[Index];
+		if (!TokenKeys[TokenId].StartsWith(KeyPrefix, ESearchCase::CaseSensitive))
+		{
+			break;
+		}
+
+		for (FFXPathId PathId : Postings[TokenId])
+		{
+			InOutMatches[PathId] = true;
+		}
+	}
+}
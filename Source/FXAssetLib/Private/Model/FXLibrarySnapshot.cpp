@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXLibrarySnapshot.h"
+
+const FFXCategoryData* FFXLibrarySnapshot::FindCategory(FName CategoryName) const
+{
+	const int32* Index = CategoryIndex.Find(CategoryName);
+	return Index ? &Categories[*Index].Get() : nullptr;
+}
+
+FFXLibrarySnapshotPublisher::FFXLibrarySnapshotPublisher()
+	: CurrentSnapshot(MakeShared<const FFXLibrarySnapshot, ESPMode::ThreadSafe>())
+{
+}
+
+FFXLibrarySnapshotPtr FFXLibrarySnapshotPublisher::GetSnapshot() const
+{
+	FReadScopeLock ReadLock(SnapshotLock);
+	return CurrentSnapshot;
+}
+
+void FFXLibrarySnapshotPublisher::MarkCategoryDirty(FName CategoryName)
+{
+	check(IsInGameThread());
+	if (!bAllDirty)
+	{
+		DirtyCategories.Add(CategoryName);
+	}
+}
+
+void FFXLibrarySnapshotPublisher::MarkAllDirty()
+{
+	check(IsInGameThread());
+	bAllDirty = true;
+	DirtyCategories.Reset();
+}
+
+void FFXLibrarySnapshotPublisher::Publish(const TArray<FFXCategoryData>& CommittedCategories)
+{
+	check(IsInGameThread());
+	if (!IsDirty())
+	{
+		return;
+	}
+
+	// 게시는 게임 스레드에서만 하므로 현재 스냅샷은 잠금 없이 읽어도 됨
+	const FFXLibrarySnapshot& Previous = *CurrentSnapshot;
+
+	TSharedRef<FFXLibrarySnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FFXLibrarySnapshot, ESPMode::ThreadSafe>();
+	Snapshot->Version = Previous.Version + 1;
+	Snapshot->Categories.Reserve(CommittedCategories.Num());
+	Snapshot->CategoryIndex.Reserve(CommittedCategories.Num());
+
+	for (const FFXCategoryData& Category : CommittedCategories)
+	{
+		if (Snapshot->CategoryIndex.Contains(Category.CategoryName))
+		{
+			continue;
+		}
+
+		const int32* PreviousIndex = bAllDirty || DirtyCategories.Contains(Category.CategoryName)
+			? nullptr
+			: Previous.CategoryIndex.Find(Category.CategoryName);
+
+		if (PreviousIndex)
+		{
+			Snapshot->Categories.Add(Previous.Categories[*PreviousIndex]);
+			Stats.CategoriesShared++;
+		}
+		else
+		{
+			Snapshot->Categories.Add(MakeShared<const FFXCategoryData, ESPMode::ThreadSafe>(Category));
+			Stats.CategoriesCopied++;
+		}
+
+		Snapshot->CategoryIndex.Add(Category.CategoryName, Snapshot->Categories.Num() - 1);
+		Snapshot->NumEntries += Category.Assets.Num();
+	}
+
+	// 포인터 교체만 잠금 (이전 스냅샷은 마지막 참조가 해제될 때 소멸)
+	{
+		FWriteScopeLock WriteLock(SnapshotLock);
+		CurrentSnapshot = Snapshot;
+	}
+
+	DirtyCategories.Reset();
+	bAllDirty = false;
+	Stats.Published++;
+}
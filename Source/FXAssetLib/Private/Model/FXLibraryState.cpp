@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Model/FXLibraryState.h"
+#include "Core/FXAssetLibConstants.h"
 
 FFXLibraryState::FFXLibraryState()
 {
@@ -14,6 +15,8 @@ FFXLibraryState::~FFXLibraryState()
 void FFXLibraryState::SetSelectedCategory(TSharedPtr<FName> Category)
 {
 	SelectedCategory = Category;
+	SimilarSourceId = FXInvalidPathId;
+	PendingVisibleDelta.bReset = true;
 	UpdateVisibleAssets();
 	NotifyStateChanged();
 }
@@ -24,6 +27,60 @@ void FFXLibraryState::SetHoveredCategory(TSharedPtr<FName> Category)
 	NotifyStateChanged();
 }
 
+void FFXLibraryState::SetSearchText(const FString& InSearchText)
+{
+	const FString TrimmedText = InSearchText.TrimStartAndEnd();
+	if (TrimmedText.Equals(SearchText, ESearchCase::CaseSensitive))
+	{
+		return;
+	}
+
+	SearchText = TrimmedText;
+	SearchQuery = FFXSearchQuery::Parse(SearchText);
+	if (IsSearchActive())
+	{
+		SimilarSourceId = FXInvalidPathId;
+	}
+	PendingVisibleDelta.bReset = true;
+	UpdateVisibleAssets();
+	NotifyStateChanged();
+}
+
+void FFXLibraryState::SetSimilarSource(const FSoftObjectPath& EntryPath)
+{
+	const FFXPathId PathId = PathTable.Find(EntryPath);
+	if (PathId == FXInvalidPathId || PathId == SimilarSourceId || !SearchIndex.ContainsEntry(PathId))
+	{
+		return;
+	}
+
+	// 검색어는 유지하지 않음 (기준 항목과 가까운 순서가 검색 결과 순서와 섞이지 않도록)
+	SearchText.Reset();
+	SearchQuery = FFXSearchQuery();
+	SimilarSourceId = PathId;
+	PendingVisibleDelta.bReset = true;
+	UpdateVisibleAssets();
+	NotifyStateChanged();
+}
+
+void FFXLibraryState::ClearSimilarSource()
+{
+	if (!IsSimilarityActive())
+	{
+		return;
+	}
+
+	SimilarSourceId = FXInvalidPathId;
+	PendingVisibleDelta.bReset = true;
+	UpdateVisibleAssets();
+	NotifyStateChanged();
+}
+
+FSoftObjectPath FFXLibraryState::GetSimilarSource() const
+{
+	return IsSimilarityActive() ? PathTable.Get(SimilarSourceId) : FSoftObjectPath();
+}
+
 void FFXLibraryState::OpenCategoryModal()
 {
 	bIsCategoryModalOpen = true;
@@ -39,12 +96,66 @@ void FFXLibraryState::CloseCategoryModal()
 void FFXLibraryState::LoadCategories(const TArray<TSharedPtr<FName>>& InCategories)
 {
 	Categories = InCategories;
+	RebuildCategoryLookup();
+	CategoryTree.Rebuild(Categories, [this](FName CategoryName)
+		{
+			return GetCategoryAssetCount(CategoryName);
+		});
 	NotifyStateChanged();
 }
 
+TSharedPtr<FName> FFXLibraryState::AddCategory(FName CategoryName)
+{
+	if (TSharedPtr<FName>* Existing = CategoryLookup.Find(CategoryName))
+	{
+		return *Existing;
+	}
+
+	TSharedPtr<FName> CategoryPtr = MakeShared<FName>(CategoryName);
+	Categories.Add(CategoryPtr);
+	CategoryLookup.Add(CategoryName, CategoryPtr);
+	CategoryTree.AddCategory(CategoryPtr, GetCategoryAssetCount(CategoryName));
+	return CategoryPtr;
+}
+
+bool FFXLibraryState::RemoveCategory(FName CategoryName)
+{
+	TSharedPtr<FName> CategoryPtr;
+	if (!CategoryLookup.RemoveAndCopyValue(CategoryName, CategoryPtr))
+	{
+		return false;
+	}
+
+	if (IsSelectedCategory(CategoryName) || IsQueryViewActive())
+	{
+		PendingVisibleDelta.bReset = true;
+	}
+
+	SearchIndex.RemoveCategory(CategoryName);
+	CategoryTree.RemoveCategory(CategoryName);
+	Categories.Remove(CategoryPtr);
+	CategoryIcons.Remove(CategoryName);
+
+	TFXOrderedIndexSet<FFXPathId> RemovedAssets;
+	if (CategoryToAssets.RemoveAndCopyValue(CategoryName, RemovedAssets))
+	{
+		for (FFXPathId PathId : RemovedAssets)
+		{
+			ReleasePathId(PathId);
+		}
+	}
+	return true;
+}
+
+TSharedPtr<FName> FFXLibraryState::FindCategory(FName CategoryName) const
+{
+	const TSharedPtr<FName>* Existing = CategoryLookup.Find(CategoryName);
+	return Existing ? *Existing : nullptr;
+}
+
 void FFXLibraryState::LoadCategoryAssets(FName CategoryName, const TArray<FSoftObjectPath>& Assets)
 {
-	CategoryToAssets.Add(CategoryName, Assets);
+	SetCategoryAssets(CategoryName, Assets);
 	UpdateVisibleAssets();
 	NotifyStateChanged();
 }
@@ -57,58 +168,539 @@ void FFXLibraryState::LoadCategoryIcon(FName CategoryName, const FSoftObjectPath
 
 void FFXLibraryState::UpdateVisibleAssets()
 {
-	VisibleAssets.Empty();
+	if (BatchDepth > 0)
+	{
+		bVisibleAssetsDirty = true;
+		return;
+	}
+
+	if (PendingVisibleDelta.bReset || !PatchVisibleAssets())
+	{
+		PendingVisibleDelta.bReset = true;
+		RebuildVisibleAssets();
+	}
+
+	if (!PendingVisibleDelta.IsEmpty())
+	{
+		OnVisibleAssetsChanged.Broadcast(PendingVisibleDelta);
+		PendingVisibleDelta.Reset();
+	}
+}
+
+void FFXLibraryState::RebuildVisibleAssets()
+{
+	// 배열 용량은 유지하여 카테고리 전환 시 재할당 방지
+	VisibleAssets.Reset();
+
+	// 기준 항목이 모든 카테고리에서 빠졌으면 유사 이펙트 표시 종료
+	if (IsSimilarityActive() && !SearchIndex.ContainsEntry(SimilarSourceId))
+	{
+		SimilarSourceId = FXInvalidPathId;
+	}
 
-	if (SelectedCategory.IsValid())
+	if (IsSimilarityActive())
 	{
-		if (const TArray<FSoftObjectPath>* Assets = CategoryToAssets.Find(*SelectedCategory))
+		// 기준 항목을 맨 앞에, 나머지는 특징 벡터가 가까운 순 (특징이 아직 없으면 기준 항목만)
+		VisibleAssets.Add(PathTable.GetViewItem(SimilarSourceId));
+
+		FFXEffectFeatures SourceFeatures;
+		if (SimilarityIndex.GetFeatures(SimilarSourceId, SourceFeatures))
 		{
-			for (const FSoftObjectPath& Path : *Assets)
+			SimilarityIndex.FindNearest(SourceFeatures, FFXAssetLibConstants::SimilarEffectsMaxResults,
+				[this](FFXPathId PathId)
+				{
+					return PathId != SimilarSourceId && SearchIndex.ContainsEntry(PathId);
+				},
+				SimilarResults);
+
+			VisibleAssets.Reserve(SimilarResults.Num() + 1);
+			for (const FFXSimilarEffect& Result : SimilarResults)
 			{
-				VisibleAssets.Add(MakeShared<FSoftObjectPath>(Path));
+				VisibleAssets.Add(PathTable.GetViewItem(Result.PathId));
+			}
+		}
+		else
+		{
+			SimilarResults.Reset();
+		}
+	}
+	else if (IsSearchActive())
+	{
+		// 검색 결과는 카테고리와 무관하게 경로 ID 순 (같은 항목은 한 번만)
+		SearchIndex.Search(SearchQuery, SearchResults);
+		VisibleAssets.Reserve(SearchResults.Num());
+		for (FFXPathId PathId : SearchResults)
+		{
+			VisibleAssets.Add(PathTable.GetViewItem(PathId));
+		}
+	}
+	else if (SelectedCategory.IsValid())
+	{
+		if (const TFXOrderedIndexSet<FFXPathId>* Assets = CategoryToAssets.Find(*SelectedCategory))
+		{
+			VisibleAssets.Reserve(Assets->Num());
+			for (FFXPathId PathId : *Assets)
+			{
+				VisibleAssets.Add(PathTable.GetViewItem(PathId));
 			}
 		}
 	}
 }
 
-void FFXLibraryState::AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath)
+bool FFXLibraryState::PatchVisibleAssets()
 {
-	if (TArray<FSoftObjectPath>* Assets = CategoryToAssets.Find(CategoryName))
+	// 검색/유사 이펙트 표시 중의 항목 변경은 재검색(bReset)으로 처리하므로 패치할 내용 없음
+	if (IsQueryViewActive())
+	{
+		return true;
+	}
+
+	if (PendingVisibleDelta.Removed.Num() == 1)
 	{
-		Assets->AddUnique(AssetPath);
+		VisibleAssets.RemoveSingle(PendingVisibleDelta.Removed[0]);
 	}
-	else
+	else if (PendingVisibleDelta.Removed.Num() > 1)
 	{
-		CategoryToAssets.Add(CategoryName, { AssetPath });
+		const TSet<TSharedPtr<FSoftObjectPath>> RemovedItems(PendingVisibleDelta.Removed);
+		VisibleAssets.RemoveAll([&RemovedItems](const TSharedPtr<FSoftObjectPath>& Item)
+		{
+			return RemovedItems.Contains(Item);
+		});
 	}
+
+	// 순서 유지 집합은 새 항목을 끝에 추가하므로 표시 목록도 끝에 추가
+	VisibleAssets.Append(PendingVisibleDelta.Added);
+
+	// 추적되지 않은 변경이 있었으면 전체 재구성
+	return VisibleAssets.Num() == GetCategoryAssetCount(SelectedCategory.IsValid() ? *SelectedCategory : NAME_None);
+}
+
+void FFXLibraryState::AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	InsertCategoryAsset(CategoryName, AssetPath);
 	UpdateVisibleAssets();
 	NotifyStateChanged();
 }
 
 void FFXLibraryState::RemoveAssetFromCategory(FName CategoryName, const FSoftObjectPath& AssetPath)
 {
-	if (TArray<FSoftObjectPath>* Assets = CategoryToAssets.Find(CategoryName))
+	if (EraseCategoryAsset(CategoryName, AssetPath))
 	{
-		Assets->Remove(AssetPath);
 		UpdateVisibleAssets();
 		NotifyStateChanged();
 	}
 }
 
+bool FFXLibraryState::InsertCategoryAsset(FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	const FFXPathId PathId = PathTable.Intern(AssetPath);
+	if (!CategoryToAssets.FindOrAdd(CategoryName).Add(PathId))
+	{
+		return false;
+	}
+
+	PathTable.AddRef(PathId);
+	SearchIndex.AddEntry(PathId, AssetPath, CategoryName);
+	CategoryTree.AdjustAssetCount(CategoryName, 1);
+	if (IsQueryViewActive())
+	{
+		PendingVisibleDelta.bReset = true;
+	}
+	else if (IsSelectedCategory(CategoryName) && !PendingVisibleDelta.bReset)
+	{
+		// 같은 배치에서 제거 후 다시 추가되면 위치가 바뀌므로 전체 재구성
+		const TSharedPtr<FSoftObjectPath>& Item = PathTable.GetViewItem(PathId);
+		if (PendingVisibleDelta.Removed.Contains(Item))
+		{
+			PendingVisibleDelta.bReset = true;
+		}
+		else
+		{
+			PendingVisibleDelta.Added.Add(Item);
+		}
+	}
+	return true;
+}
+
+bool FFXLibraryState::EraseCategoryAsset(FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	const FFXPathId PathId = PathTable.Find(AssetPath);
+	TFXOrderedIndexSet<FFXPathId>* Assets = CategoryToAssets.Find(CategoryName);
+	if (PathId == FXInvalidPathId || !Assets || !Assets->Remove(PathId))
+	{
+		return false;
+	}
+
+	SearchIndex.RemoveEntry(PathId, CategoryName);
+	CategoryTree.AdjustAssetCount(CategoryName, -1);
+	if (IsQueryViewActive())
+	{
+		PendingVisibleDelta.bReset = true;
+	}
+	else if (IsSelectedCategory(CategoryName) && !PendingVisibleDelta.bReset)
+	{
+		// 아직 표시 목록에 반영되지 않은 추가는 상쇄
+		const TSharedPtr<FSoftObjectPath>& Item = PathTable.GetViewItem(PathId);
+		if (PendingVisibleDelta.Added.RemoveSingle(Item) == 0)
+		{
+			PendingVisibleDelta.Removed.Add(Item);
+		}
+	}
+
+	// 표시 목록 패치에 뷰 항목을 쓴 뒤 해제
+	ReleasePathId(PathId);
+	return true;
+}
+
+void FFXLibraryState::SetCategoryAssets(FName CategoryName, const TArray<FSoftObjectPath>& Assets)
+{
+	if (IsSelectedCategory(CategoryName) || IsQueryViewActive())
+	{
+		PendingVisibleDelta.bReset = true;
+	}
+
+	SearchIndex.RemoveCategory(CategoryName);
+
+	TFXOrderedIndexSet<FFXPathId>& AssetIds = CategoryToAssets.FindOrAdd(CategoryName);
+	TFXOrderedIndexSet<FFXPathId> PreviousAssetIds = MoveTemp(AssetIds);
+	AssetIds.Reset();
+	for (const FSoftObjectPath& AssetPath : Assets)
+	{
+		const FFXPathId PathId = PathTable.Intern(AssetPath);
+		if (AssetIds.Add(PathId))
+		{
+			PathTable.AddRef(PathId);
+			SearchIndex.AddEntry(PathId, AssetPath, CategoryName);
+		}
+	}
+	CategoryTree.AdjustAssetCount(CategoryName, AssetIds.Num() - PreviousAssetIds.Num());
+
+	// 새 목록의 참조를 먼저 추가하여 남아 있는 항목의 ID/뷰 항목은 유지
+	for (FFXPathId PathId : PreviousAssetIds)
+	{
+		ReleasePathId(PathId);
+	}
+}
+
+bool FFXLibraryState::ReplaceCategoryAsset(FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath)
+{
+	const FFXPathId PathId = PathTable.Find(AssetPath);
+	TFXOrderedIndexSet<FFXPathId>* Assets = CategoryToAssets.Find(CategoryName);
+	if (PathId == FXInvalidPathId || !Assets || !Assets->Contains(PathId) || AssetPath == NewAssetPath)
+	{
+		return false;
+	}
+
+	const FFXPathId NewPathId = PathTable.Intern(NewAssetPath);
+	const int32 PreviousCount = Assets->Num();
+	Assets->Replace(PathId, NewPathId);
+
+	SearchIndex.RemoveEntry(PathId, CategoryName);
+	SearchIndex.AddEntry(NewPathId, NewAssetPath, CategoryName);
+
+	// 새 경로가 이미 있던 카테고리는 기존 항목만 빠짐
+	const int32 CountDelta = Assets->Num() - PreviousCount;
+	CategoryTree.AdjustAssetCount(CategoryName, CountDelta);
+	if (CountDelta == 0)
+	{
+		PathTable.AddRef(NewPathId);
+	}
+	ReleasePathId(PathId);
+
+	// 위치를 유지한 교체는 추가/제거 패치로 표현할 수 없으므로 전체 재구성
+	if (IsSelectedCategory(CategoryName) || IsQueryViewActive())
+	{
+		PendingVisibleDelta.bReset = true;
+	}
+	return true;
+}
+
+TArray<FSoftObjectPath> FFXLibraryState::GetCategoryAssets(FName CategoryName) const
+{
+	TArray<FSoftObjectPath> Assets;
+	if (const TFXOrderedIndexSet<FFXPathId>* AssetIds = CategoryToAssets.Find(CategoryName))
+	{
+		Assets.Reserve(AssetIds->Num());
+		for (FFXPathId PathId : *AssetIds)
+		{
+			Assets.Add(PathTable.Get(PathId));
+		}
+	}
+	return Assets;
+}
+
+int32 FFXLibraryState::GetCategoryAssetCount(FName CategoryName) const
+{
+	const TFXOrderedIndexSet<FFXPathId>* AssetIds = CategoryToAssets.Find(CategoryName);
+	return AssetIds ? AssetIds->Num() : 0;
+}
+
+bool FFXLibraryState::IsAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath) const
+{
+	const FFXPathId PathId = PathTable.Find(AssetPath);
+	const TFXOrderedIndexSet<FFXPathId>* AssetIds = CategoryToAssets.Find(CategoryName);
+	return PathId != FXInvalidPathId && AssetIds && AssetIds->Contains(PathId);
+}
+
+bool FFXLibraryState::IsAssetInAnyCategory(const FSoftObjectPath& AssetPath) const
+{
+	const FFXPathId PathId = PathTable.Find(AssetPath);
+	return PathId != FXInvalidPathId && SearchIndex.ContainsEntry(PathId);
+}
+
+void FFXLibraryState::FindAssetEntries(const FSoftObjectPath& AssetPath, TArray<TPair<FName, FSoftObjectPath>>& OutEntries) const
+{
+	TArray<FFXPathId> PathIds;
+	PathTable.FindByAssetPath(AssetPath, PathIds);
+
+	// 항목별 카테고리 목록은 검색 색인 문서가 카테고리 항목 변경마다 함께 유지 (항목이 속한 카테고리만 조회)
+	for (FFXPathId PathId : PathIds)
+	{
+		for (FName CategoryName : SearchIndex.GetEntryCategories(PathId))
+		{
+			OutEntries.Emplace(CategoryName, PathTable.Get(PathId));
+		}
+	}
+}
+
+bool FFXLibraryState::HasAssetEntries(const FSoftObjectPath& AssetPath) const
+{
+	TArray<FFXPathId> PathIds;
+	PathTable.FindByAssetPath(AssetPath, PathIds);
+	for (FFXPathId PathId : PathIds)
+	{
+		if (SearchIndex.ContainsEntry(PathId))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FFXLibraryState::ConsumePendingSearchAttributeAssets(TArray<FSoftObjectPath>& OutAssetPaths)
+{
+	TArray<FFXPathId> PathIds;
+	SearchIndex.ConsumePendingAttributeIds(PathIds);
+
+	// 변형 항목은 기본 에셋의 속성을 사용
+	TSet<FSoftObjectPath> AssetPaths;
+	AssetPaths.Reserve(PathIds.Num());
+	for (FFXPathId PathId : PathIds)
+	{
+		AssetPaths.Add(PathTable.Get(PathId).GetWithoutSubPath());
+	}
+	OutAssetPaths = AssetPaths.Array();
+}
+
+bool FFXLibraryState::SetSearchAttributes(const FSoftObjectPath& AssetPath, FName ClassName, const FString& Hashtags)
+{
+	TArray<FFXPathId> PathIds;
+	PathTable.FindByAssetPath(AssetPath, PathIds);
+
+	bool bChanged = false;
+	for (FFXPathId PathId : PathIds)
+	{
+		bChanged |= SearchIndex.SetAttributes(PathId, ClassName, Hashtags);
+	}
+
+	if (bChanged && IsSearchActive())
+	{
+		PendingVisibleDelta.bReset = true;
+	}
+	return bChanged;
+}
+
+bool FFXLibraryState::SetEffectFeatures(const FSoftObjectPath& AssetPath, const FFXEffectFeatures& Features)
+{
+	// 변형 항목도 기본 에셋의 특징을 사용
+	TArray<FFXPathId> PathIds;
+	PathTable.FindByAssetPath(AssetPath, PathIds);
+
+	bool bChanged = false;
+	for (FFXPathId PathId : PathIds)
+	{
+		bChanged |= SimilarityIndex.SetFeatures(PathId, Features);
+	}
+
+	if (bChanged && IsSimilarityActive())
+	{
+		PendingVisibleDelta.bReset = true;
+	}
+	return bChanged;
+}
+
+bool FFXLibraryState::HasEffectFeatures(const FSoftObjectPath& AssetPath) const
+{
+	TArray<FFXPathId> PathIds;
+	PathTable.FindByAssetPath(AssetPath, PathIds);
+	for (FFXPathId PathId : PathIds)
+	{
+		if (!SimilarityIndex.Contains(PathId))
+		{
+			return false;
+		}
+	}
+	return PathIds.Num() > 0;
+}
+
+FFXLibraryStateMemoryStats FFXLibraryState::GetMemoryStats() const
+{
+	FFXLibraryStateMemoryStats Stats;
+	Stats.NumUniquePaths = PathTable.Num();
+	Stats.NumViewItems = PathTable.NumViewItems();
+	Stats.PathTableBytes = PathTable.GetAllocatedSize();
+	Stats.CategoryBytes = CategoryToAssets.GetAllocatedSize();
+	for (const TPair<FName, TFXOrderedIndexSet<FFXPathId>>& Pair : CategoryToAssets)
+	{
+		Stats.NumEntries += Pair.Value.Num();
+		Stats.CategoryBytes += Pair.Value.GetAllocatedSize();
+	}
+	Stats.CategoryBytes += CategoryTree.GetAllocatedSize();
+	Stats.VisibleBytes = VisibleAssets.GetAllocatedSize();
+	Stats.SearchIndexBytes = SearchIndex.GetAllocatedSize() + SearchResults.GetAllocatedSize();
+	Stats.SimilarityIndexBytes = SimilarityIndex.GetAllocatedSize() + SimilarResults.GetAllocatedSize();
+	return Stats;
+}
+
+const FFXAssetVariant* FFXLibraryState::FindAssetVariant(const FSoftObjectPath& EntryPath) const
+{
+	if (!FFXAssetVariant::IsVariantEntry(EntryPath))
+	{
+		return nullptr;
+	}
+	return AssetVariants.Find(EntryPath);
+}
+
+bool FFXLibraryState::IsReferencedAsset(const FSoftObjectPath& EntryPath) const
+{
+	return ReferencedAssets.Contains(EntryPath);
+}
+
 void FFXLibraryState::Reset()
 {
 	Categories.Empty();
+	CategoryLookup.Empty();
+	CategoryTree.Reset();
 	CategoryToAssets.Empty();
 	CategoryIcons.Empty();
+	AssetVariants.Empty();
+	// 경로 테이블은 유지 (다시 로드해도 같은 경로는 같은 뷰 항목이므로 타일 위젯 재사용)
+	// 참조 카운트만 비우고 로드가 끝난 뒤(배치 종료) 다시 참조되지 않은 ID 정리
+	// 검색어는 패널 입력 상태이므로 유지하고 색인만 비움 (로드된 항목으로 다시 색인)
+	// 카테고리 트리 펼침 상태도 패널 상태이므로 유지 (경로 기준이라 다시 만든 노드에 적용됨)
+	// 유사 이펙트 색인은 경로 ID별 특징 캐시이므로 유지하고 기준 항목만 해제
+	SearchIndex.Reset();
+	SimilarSourceId = FXInvalidPathId;
+	ReferencedAssets.Empty();
 	SelectedCategory.Reset();
 	HoveredCategory.Reset();
 	VisibleAssets.Empty();
+	PendingVisibleDelta.Reset();
+	PendingVisibleDelta.bReset = true;
 	bIsCategoryModalOpen = false;
 	bIsLoading = false;
+
+	PathTable.ClearRefCounts();
+	bPathTableCompactPending = true;
+	if (BatchDepth == 0)
+	{
+		CompactPathTable();
+	}
 }
 
 void FFXLibraryState::NotifyStateChanged()
 {
+	if (BatchDepth > 0)
+	{
+		// 보류 중인 알림이 있으면 이번 알림은 합쳐짐
+		if (bNotifyPending)
+		{
+			SuppressedNotifications++;
+		}
+		bNotifyPending = true;
+		return;
+	}
+
 	OnStateChanged.Broadcast();
 }
 
+void FFXLibraryState::BeginBatch()
+{
+	BatchDepth++;
+}
+
+void FFXLibraryState::EndBatch()
+{
+	check(BatchDepth > 0);
+	if (--BatchDepth > 0)
+	{
+		return;
+	}
+
+	if (bPathTableCompactPending)
+	{
+		CompactPathTable();
+	}
+
+	if (bVisibleAssetsDirty)
+	{
+		bVisibleAssetsDirty = false;
+		UpdateVisibleAssets();
+	}
+
+	if (bNotifyPending)
+	{
+		bNotifyPending = false;
+		OnStateChanged.Broadcast();
+	}
+}
+
+void FFXLibraryState::RebuildCategoryLookup()
+{
+	CategoryLookup.Reset();
+	CategoryLookup.Reserve(Categories.Num());
+
+	// 중복 이름은 첫 항목만 유지
+	TArray<TSharedPtr<FName>> UniqueCategories;
+	UniqueCategories.Reserve(Categories.Num());
+	for (const TSharedPtr<FName>& CategoryPtr : Categories)
+	{
+		if (CategoryPtr.IsValid() && !CategoryLookup.Contains(*CategoryPtr))
+		{
+			CategoryLookup.Add(*CategoryPtr, CategoryPtr);
+			UniqueCategories.Add(CategoryPtr);
+		}
+	}
+	Categories = MoveTemp(UniqueCategories);
+}
+
+void FFXLibraryState::ReleasePathId(FFXPathId PathId)
+{
+	if (PathTable.Release(PathId))
+	{
+		HandlePathIdFreed(PathId);
+	}
+}
+
+void FFXLibraryState::HandlePathIdFreed(FFXPathId PathId)
+{
+	// 해제된 ID는 다른 경로에 재사용되므로 ID별 특징/기준 항목도 정리 (검색 색인은 카테고리 제거 시 이미 빠짐)
+	SimilarityIndex.Remove(PathId);
+	if (SimilarSourceId == PathId)
+	{
+		SimilarSourceId = FXInvalidPathId;
+		PendingVisibleDelta.bReset = true;
+	}
+}
+
+void FFXLibraryState::CompactPathTable()
+{
+	bPathTableCompactPending = false;
+
+	TArray<FFXPathId> FreedIds;
+	PathTable.Compact(FreedIds);
+	for (FFXPathId PathId : FreedIds)
+	{
+		HandlePathIdFreed(PathId);
+	}
+}
@@ -0,0 +1,200 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXLibraryStorage.h"
+#include "Model/FXLibraryWriteBehind.h"
+#include "Model/FXSharedLibrary.h"
+
+// ===== FFXSettingsLibraryStorage =====
+
+void FFXSettingsLibraryStorage::Load()
+{
+	UFXLibrarySettings* Settings = GetSettings();
+
+	// Database 백엔드: 세션 최초 로드 시 스냅샷 + 저널을 Settings로 읽음 (이후엔 메모리 데이터 사용)
+	if (Settings->UsesDatabaseBackend())
+	{
+		FFXLibraryDatabase& Database = FFXLibraryDatabase::Get();
+		if (!Database.IsLoaded())
+		{
+			TArray<FFXCategoryData> StoredCategories;
+			if (Database.Load(StoredCategories))
+			{
+				Settings->Categories = MoveTemp(StoredCategories);
+			}
+			else
+			{
+				// 데이터베이스가 없으면 현재 ini 데이터를 이전
+				Database.WriteSnapshot(Settings->Categories);
+				UE_LOG(LogTemp, Log, TEXT("[FX Library Model] Migrated %d categories from config to database"), Settings->Categories.Num());
+			}
+		}
+	}
+	// Shared 백엔드: 세션 최초 로드 시 공유 파일을 Settings로 읽고 감시 시작 (이후 외부 변경은 모델의 ApplyExternalChanges로 반영)
+	else if (Settings->UsesSharedBackend())
+	{
+		FFXSharedLibrary& SharedLibrary = FFXSharedLibrary::Get();
+		if (!SharedLibrary.IsLoaded())
+		{
+			SharedLibrary.Load();
+		}
+	}
+
+	// 백엔드 로드가 Categories를 교체했을 수 있으므로 이름/멤버십 인덱스를 다시 만듦
+	Settings->InvalidateCategoryIndex();
+}
+
+TArray<FFXCategoryData>& FFXSettingsLibraryStorage::GetCategories()
+{
+	return GetSettings()->Categories;
+}
+
+const TArray<FFXCategoryData>& FFXSettingsLibraryStorage::GetCategories() const
+{
+	return GetSettings()->Categories;
+}
+
+FFXCategoryData* FFXSettingsLibraryStorage::FindCategory(FName CategoryName)
+{
+	return GetSettings()->FindCategory(CategoryName);
+}
+
+const FFXCategoryData* FFXSettingsLibraryStorage::FindCategory(FName CategoryName) const
+{
+	return static_cast<const UFXLibrarySettings*>(GetSettings())->FindCategory(CategoryName);
+}
+
+FFXCategoryData* FFXSettingsLibraryStorage::AddCategory(FName CategoryName, const FSoftObjectPath& IconPath)
+{
+	return GetSettings()->AddCategory(CategoryName, IconPath);
+}
+
+bool FFXSettingsLibraryStorage::RemoveCategory(FName CategoryName)
+{
+	return GetSettings()->RemoveCategory(CategoryName);
+}
+
+bool FFXSettingsLibraryStorage::AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	return GetSettings()->AddAssetToCategory(CategoryName, AssetPath);
+}
+
+int32 FFXSettingsLibraryStorage::RemoveAssetFromCategory(FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	return GetSettings()->RemoveAssetFromCategory(CategoryName, AssetPath);
+}
+
+bool FFXSettingsLibraryStorage::ReplaceAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath)
+{
+	return GetSettings()->ReplaceAssetInCategory(CategoryName, AssetPath, NewAssetPath);
+}
+
+bool FFXSettingsLibraryStorage::IsAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath) const
+{
+	return GetSettings()->IsAssetInCategory(CategoryName, AssetPath);
+}
+
+void FFXSettingsLibraryStorage::InvalidateCategoryIndex()
+{
+	GetSettings()->InvalidateCategoryIndex();
+}
+
+void FFXSettingsLibraryStorage::MarkDirty(const FFXJournalRecord& Record)
+{
+	FFXLibraryWriteBehind::Get().MarkDirty(Record);
+}
+
+void FFXSettingsLibraryStorage::MarkFullSaveDirty()
+{
+	FFXLibraryWriteBehind::Get().MarkFullSaveDirty();
+}
+
+bool FFXSettingsLibraryStorage::IsDirty() const
+{
+	return FFXLibraryWriteBehind::Get().IsDirty();
+}
+
+bool FFXSettingsLibraryStorage::Flush()
+{
+	return FFXLibraryWriteBehind::Get().Flush();
+}
+
+UFXLibrarySettings* FFXSettingsLibraryStorage::GetSettings() const
+{
+	return GetMutableDefault<UFXLibrarySettings>();
+}
+
+// ===== FFXInMemoryLibraryStorage =====
+
+FFXInMemoryLibraryStorage::FFXInMemoryLibraryStorage(TArray<FFXCategoryData> InCategories)
+	: Categories(MoveTemp(InCategories))
+{
+}
+
+FFXCategoryData* FFXInMemoryLibraryStorage::FindCategory(FName CategoryName)
+{
+	return CategoryIndex.FindCategory(Categories, CategoryName);
+}
+
+const FFXCategoryData* FFXInMemoryLibraryStorage::FindCategory(FName CategoryName) const
+{
+	return CategoryIndex.FindCategory(Categories, CategoryName);
+}
+
+FFXCategoryData* FFXInMemoryLibraryStorage::AddCategory(FName CategoryName, const FSoftObjectPath& IconPath)
+{
+	return &CategoryIndex.AddCategory(Categories, CategoryName, IconPath);
+}
+
+bool FFXInMemoryLibraryStorage::RemoveCategory(FName CategoryName)
+{
+	return CategoryIndex.RemoveCategory(Categories, CategoryName);
+}
+
+bool FFXInMemoryLibraryStorage::AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	return CategoryIndex.AddAsset(Categories, CategoryName, AssetPath);
+}
+
+int32 FFXInMemoryLibraryStorage::RemoveAssetFromCategory(FName CategoryName, const FSoftObjectPath& AssetPath)
+{
+	// 변형/참조 정보는 모델이 저널 레코드로 반영 (FFXLibraryDatabase::ApplyRecordMetadata)
+	return CategoryIndex.RemoveAsset(Categories, CategoryName, AssetPath);
+}
+
+bool FFXInMemoryLibraryStorage::ReplaceAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath)
+{
+	return CategoryIndex.ReplaceAsset(Categories, CategoryName, AssetPath, NewAssetPath);
+}
+
+bool FFXInMemoryLibraryStorage::IsAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath) const
+{
+	return CategoryIndex.ContainsAsset(Categories, CategoryName, AssetPath);
+}
+
+void FFXInMemoryLibraryStorage::InvalidateCategoryIndex()
+{
+	CategoryIndex.Invalidate();
+}
+
+void FFXInMemoryLibraryStorage::MarkDirty(const FFXJournalRecord& Record)
+{
+	MarkedRecords.Add(Record);
+	bDirty = true;
+	NumMarkedDirty++;
+}
+
+void FFXInMemoryLibraryStorage::MarkFullSaveDirty()
+{
+	bDirty = true;
+	NumMarkedDirty++;
+}
+
+bool FFXInMemoryLibraryStorage::Flush()
+{
+	if (bDirty)
+	{
+		bDirty = false;
+		NumFlushes++;
+	}
+	return true;
+}
@@ -0,0 +1,238 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXLibrarySubsystem.h"
+#include "Model/FXLibraryState.h"
+#include "Model/FXLibraryModel.h"
+#include "Model/FXLibraryWriteBehind.h"
+#include "Utils/FXEffectFeatureExtractor.h"
+#include "Utils/FXMaterialDeduplicator.h"
+#include "Core/FXAssetLibConstants.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "NiagaraSystem.h"
+#include "Editor.h"
+
+void UFXLibrarySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	State = MakeShared<FFXLibraryState>();
+	Model = MakeShared<FFXLibraryModel>();
+	Model->SetState(State);
+	Model->LoadFromSettings();
+
+	// 항목 유효성/경로는 레지스트리 이벤트로 증분 유지 (초기 스캔의 추가 이벤트는 해시 조회 1회로 걸러짐)
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	AssetRegistry.OnAssetAdded().AddUObject(this, &UFXLibrarySubsystem::HandleAssetAdded);
+	AssetRegistry.OnAssetRemoved().AddUObject(this, &UFXLibrarySubsystem::HandleAssetRemoved);
+	AssetRegistry.OnAssetRenamed().AddUObject(this, &UFXLibrarySubsystem::HandleAssetRenamed);
+
+	// 특징 벡터 태그가 없는 항목은 에디터가 도는 동안 조금씩 추출
+	FeatureExtractionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UFXLibrarySubsystem::TickFeatureExtraction), 0.25f);
+
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Subsystem] Library service initialized"));
+}
+
+void UFXLibrarySubsystem::Deinitialize()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().RemoveAll(this);
+		AssetRegistry->OnAssetRemoved().RemoveAll(this);
+		AssetRegistry->OnAssetRenamed().RemoveAll(this);
+	}
+
+	// 진행 중인 특징 추출 로드 취소 (완료 콜백이 해제된 모델에 접근하지 않도록)
+	FTSTicker::GetCoreTicker().RemoveTicker(FeatureExtractionTickerHandle);
+	if (FeatureLoadHandle.IsValid())
+	{
+		FeatureLoadHandle->CancelHandle();
+		FeatureLoadHandle.Reset();
+	}
+	bFeatureLoadInProgress = false;
+
+	// 대기 중인 레지스트리 변경은 반영 후 저장
+	if (RegistryChangesTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RegistryChangesTickerHandle);
+		FlushRegistryChanges(0.0f);
+	}
+
+	// 남은 변경 저장 후 해제 (뷰가 아직 바인딩되어 있어도 AddSP라 안전)
+	FFXLibraryWriteBehind::Get().Flush();
+
+	Model.Reset();
+	State.Reset();
+
+	Super::Deinitialize();
+}
+
+UFXLibrarySubsystem* UFXLibrarySubsystem::Get()
+{
+	return GEditor ? GEditor->GetEditorSubsystem<UFXLibrarySubsystem>() : nullptr;
+}
+
+void UFXLibrarySubsystem::Reload()
+{
+	if (Model.IsValid())
+	{
+		Model->LoadFromSettings();
+	}
+}
+
+bool UFXLibrarySubsystem::ExtractEffectFeatures(const FSoftObjectPath& AssetPath)
+{
+	if (!Model.IsValid() || !State.IsValid())
+	{
+		return false;
+	}
+
+	const FSoftObjectPath BaseAssetPath = AssetPath.GetWithoutSubPath();
+	if (State->HasEffectFeatures(BaseAssetPath))
+	{
+		return true;
+	}
+
+	FFXEffectFeatures Features;
+	if (!FXEffectFeatureExtractor::ExtractFeatures(Cast<UNiagaraSystem>(BaseAssetPath.TryLoad()), Features))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FX Library Subsystem] Failed to extract effect features: %s"), *BaseAssetPath.ToString());
+		return false;
+	}
+
+	Model->SetEffectFeatures(BaseAssetPath, Features);
+	return true;
+}
+
+bool UFXLibrarySubsystem::TickFeatureExtraction(float DeltaTime)
+{
+	if (bFeatureLoadInProgress)
+	{
+		return true;
+	}
+
+	// 추출이 끝난 배치의 핸들을 놓아 로드된 에셋이 GC 대상이 되도록 함
+	// (이미 로드된 에셋이면 완료 콜백이 요청 중에 호출될 수 있으므로 다음 틱에 해제)
+	if (FeatureLoadHandle.IsValid())
+	{
+		FeatureLoadHandle->ReleaseHandle();
+		FeatureLoadHandle.Reset();
+	}
+
+	if (!Model.IsValid() || !Model->HasPendingFeatureAssets())
+	{
+		return true;
+	}
+
+	TArray<FSoftObjectPath> AssetPaths;
+	Model->ConsumePendingFeatureAssets(AssetPaths, FFXAssetLibConstants::FeatureExtractionBatchSize);
+	if (AssetPaths.Num() == 0)
+	{
+		return true;
+	}
+
+	bFeatureLoadInProgress = true;
+	FeatureLoadHandle = FeatureStreamable.RequestAsyncLoad(AssetPaths,
+		FStreamableDelegate::CreateUObject(this, &UFXLibrarySubsystem::HandleFeatureAssetsLoaded, AssetPaths),
+		FStreamableManager::AsyncLoadLowPriority);
+	return true;
+}
+
+void UFXLibrarySubsystem::HandleFeatureAssetsLoaded(TArray<FSoftObjectPath> AssetPaths)
+{
+	int32 NumExtracted = 0;
+	for (const FSoftObjectPath& AssetPath : AssetPaths)
+	{
+		FFXEffectFeatures Features;
+		if (Model.IsValid() && FXEffectFeatureExtractor::ExtractFeatures(Cast<UNiagaraSystem>(AssetPath.ResolveObject()), Features))
+		{
+			Model->SetEffectFeatures(AssetPath, Features);
+			NumExtracted++;
+		}
+	}
+
+	bFeatureLoadInProgress = false;
+
+	UE_LOG(LogTemp, Verbose, TEXT("[FX Library Subsystem] Extracted effect features for %d/%d assets"), NumExtracted, AssetPaths.Num());
+}
+
+void UFXLibrarySubsystem::HandleAssetAdded(const FAssetData& AssetData)
+{
+	// 이름 변경 시 이전 경로에 남는 리다이렉터는 항목과 무관
+	if (AssetData.IsRedirector())
+	{
+		return;
+	}
+
+	const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+	QueueRegistryChange(EFXAssetRegistryChange::Added, AssetPath, AssetPath);
+}
+
+void UFXLibrarySubsystem::HandleAssetRemoved(const FAssetData& AssetData)
+{
+	// 라이브러리 마스터가 사라졌으면 중복 제거 인덱스를 다음 검색 때 태그로 다시 만듦
+	FXMaterialDeduplicator::InvalidateIndexForPath(AssetData.GetSoftObjectPath());
+
+	if (AssetData.IsRedirector())
+	{
+		return;
+	}
+
+	const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+	QueueRegistryChange(EFXAssetRegistryChange::Removed, AssetPath, AssetPath);
+}
+
+void UFXLibrarySubsystem::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	const FSoftObjectPath OldAssetPath(OldObjectPath);
+	FXMaterialDeduplicator::InvalidateIndexForPath(OldAssetPath);
+	FXMaterialDeduplicator::InvalidateIndexForPath(AssetData.GetSoftObjectPath());
+
+	QueueRegistryChange(EFXAssetRegistryChange::Renamed, OldAssetPath, AssetData.GetSoftObjectPath(), OldAssetPath);
+}
+
+void UFXLibrarySubsystem::QueueRegistryChange(EFXAssetRegistryChange Type, const FSoftObjectPath& AffectedPath, const FSoftObjectPath& AssetPath, const FSoftObjectPath& OldAssetPath)
+{
+	if (!Model.IsValid())
+	{
+		return;
+	}
+
+	// 반영 전인 변경이 만든 경로는 모델이 아직 모르므로 대기열에서 확인
+	if (!Model->IsAffectedByRegistryChange(Type, AffectedPath) && !IsPendingResultPath(AffectedPath))
+	{
+		return;
+	}
+
+	FFXAssetRegistryChange& Change = PendingRegistryChanges.AddDefaulted_GetRef();
+	Change.Type = Type;
+	Change.AssetPath = AssetPath;
+	Change.OldAssetPath = OldAssetPath;
+
+	if (!RegistryChangesTickerHandle.IsValid())
+	{
+		RegistryChangesTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UFXLibrarySubsystem::FlushRegistryChanges));
+	}
+}
+
+bool UFXLibrarySubsystem::IsPendingResultPath(const FSoftObjectPath& AssetPath) const
+{
+	return PendingRegistryChanges.ContainsByPredicate([&AssetPath](const FFXAssetRegistryChange& Change)
+	{
+		return Change.AssetPath == AssetPath;
+	});
+}
+
+bool UFXLibrarySubsystem::FlushRegistryChanges(float DeltaTime)
+{
+	RegistryChangesTickerHandle.Reset();
+
+	const TArray<FFXAssetRegistryChange> Changes = MoveTemp(PendingRegistryChanges);
+	PendingRegistryChanges.Reset();
+	if (Model.IsValid())
+	{
+		Model->ApplyRegistryChanges(Changes);
+	}
+	return false;
+}
@@ -0,0 +1,224 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXLibraryWriteBehind.h"
+#include "Model/FXSharedLibrary.h"
+#include "FXLibrarySettings.h"
+#include "Misc/CoreDelegates.h"
+#include "Framework/Application/SlateApplication.h"
+
+namespace FXLibraryWriteBehindPrivate
+{
+	// 변경이 계속 들어와도 이 시간 이상 저장을 미루지 않음
+	static constexpr double MaxFlushDelaySeconds = 10.0;
+
+	// 사용자 입력이 이 시간 이상 없으면 디바운스를 기다리지 않고 저장
+	static constexpr double IdleFlushSeconds = 0.5;
+
+	static constexpr float TickIntervalSeconds = 0.25f;
+}
+
+FFXLibraryWriteBehind& FFXLibraryWriteBehind::Get()
+{
+	static FFXLibraryWriteBehind Instance;
+	return Instance;
+}
+
+void FFXLibraryWriteBehind::Startup()
+{
+	if (!PreExitHandle.IsValid())
+	{
+		PreExitHandle = FCoreDelegates::OnEnginePreExit.AddRaw(this, &FFXLibraryWriteBehind::Shutdown);
+	}
+}
+
+void FFXLibraryWriteBehind::Shutdown()
+{
+	// 종료 전 남은 변경 저장 (UObject 시스템이 내려간 뒤에는 Settings에 접근할 수 없음)
+	if (bDirty && UObjectInitialized())
+	{
+		Flush();
+	}
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	if (PreExitHandle.IsValid())
+	{
+		FCoreDelegates::OnEnginePreExit.Remove(PreExitHandle);
+		PreExitHandle.Reset();
+
+		UE_LOG(LogTemp, Log, TEXT("[FX Library Persistence] Session: %d mutations, %d flushes (%d config, %d journal, %d snapshot, %d shared), %d writes avoided"),
+			Stats.MutationsMarked, Stats.Flushes, Stats.ConfigWrites, Stats.JournalBatches, Stats.SnapshotWrites, Stats.SharedWrites, Stats.WritesAvoided);
+	}
+}
+
+void FFXLibraryWriteBehind::MarkDirty(const FFXJournalRecord& Record)
+{
+	const UFXLibrarySettings* Settings = GetDefault<UFXLibrarySettings>();
+	if (Settings->UsesDatabaseBackend() && !bFullSaveRequired)
+	{
+		PendingRecords.Add(Record);
+	}
+
+	MarkDirtyInternal();
+}
+
+void FFXLibraryWriteBehind::MarkFullSaveDirty()
+{
+	// 스냅샷에 대기 중인 레코드가 모두 포함됨
+	bFullSaveRequired = true;
+	PendingRecords.Reset();
+
+	MarkDirtyInternal();
+}
+
+bool FFXLibraryWriteBehind::Flush()
+{
+	if (!bDirty)
+	{
+		return true;
+	}
+
+	UFXLibrarySettings* Settings = GetMutableDefault<UFXLibrarySettings>();
+	bool bSuccess = true;
+
+	if (Settings->UsesDatabaseBackend())
+	{
+		// 저널 일괄 추가 (실패하거나 임계치를 넘으면 스냅샷으로 압축)
+		FFXLibraryDatabase& Database = FFXLibraryDatabase::Get();
+		bool bNeedsSnapshot = bFullSaveRequired
+			|| Database.GetJournalRecordCount() + PendingRecords.Num() >= Settings->JournalCompactionThreshold;
+
+		if (!bNeedsSnapshot && PendingRecords.Num() > 0)
+		{
+			bNeedsSnapshot = !Database.AppendRecords(PendingRecords);
+			Stats.JournalBatches++;
+		}
+
+		if (bNeedsSnapshot)
+		{
+			bSuccess = Database.WriteSnapshot(Settings->Categories);
+			Stats.SnapshotWrites++;
+		}
+	}
+	else if (Settings->UsesSharedBackend())
+	{
+		// 다른 사용자가 잠금 중이면 실패
+		bSuccess = FFXSharedLibrary::Get().Write();
+		if (bSuccess)
+		{
+			Stats.SharedWrites++;
+		}
+	}
+	else
+	{
+		Settings->SaveConfig();
+		bSuccess = Settings->TryUpdateDefaultConfigFile();
+		Stats.ConfigWrites++;
+	}
+
+	if (!bSuccess)
+	{
+		// 대기 중인 레코드/전체 저장 요청과 더티 상태를 유지하고 디바운스 시간 뒤 재시도
+		RearmAfterFailedFlush();
+		return false;
+	}
+
+	Stats.Flushes++;
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Persistence] Flushed %d mutations (%d writes avoided this session)"),
+		PendingMutations, Stats.WritesAvoided);
+
+	PendingRecords.Reset();
+	PendingMutations = 0;
+	bFullSaveRequired = false;
+	bDirty = false;
+	return true;
+}
+
+void FFXLibraryWriteBehind::RearmAfterFailedFlush()
+{
+	LastDirtyTime = FPlatformTime::Seconds();
+	FirstDirtyTime = LastDirtyTime;
+	EnsureTicker();
+
+	UE_LOG(LogTemp, Warning, TEXT("[FX Library Persistence] Flush failed, keeping %d pending mutations for retry"), PendingMutations);
+}
+
+bool FFXLibraryWriteBehind::Tick(float DeltaTime)
+{
+	if (bDirty && ShouldFlush(FPlatformTime::Seconds()))
+	{
+		Flush();
+	}
+
+	// 더티가 아니면 틱 해제 (다음 변경 시 다시 등록)
+	if (!bDirty)
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool FFXLibraryWriteBehind::ShouldFlush(double Now) const
+{
+	using namespace FXLibraryWriteBehindPrivate;
+
+	const UFXLibrarySettings* Settings = GetDefault<UFXLibrarySettings>();
+	if (Now - LastDirtyTime >= Settings->WriteBehindDelaySeconds)
+	{
+		return true;
+	}
+
+	if (Now - FirstDirtyTime >= MaxFlushDelaySeconds)
+	{
+		return true;
+	}
+
+	// 에디터 유휴 (드래그/연속 등록 중에는 입력이 계속 들어옴)
+	if (FSlateApplication::IsInitialized())
+	{
+		const FSlateApplication& SlateApp = FSlateApplication::Get();
+		const double IdleTime = SlateApp.GetCurrentTime() - SlateApp.GetLastUserInteractionTime();
+		if (IdleTime >= IdleFlushSeconds && Now - LastDirtyTime >= IdleFlushSeconds)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FFXLibraryWriteBehind::MarkDirtyInternal()
+{
+	const double Now = FPlatformTime::Seconds();
+	if (bDirty)
+	{
+		// 이미 대기 중인 저장에 병합
+		Stats.WritesAvoided++;
+	}
+	else
+	{
+		FirstDirtyTime = Now;
+	}
+
+	bDirty = true;
+	LastDirtyTime = Now;
+	PendingMutations++;
+	Stats.MutationsMarked++;
+
+	EnsureTicker();
+}
+
+void FFXLibraryWriteBehind::EnsureTicker()
+{
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FFXLibraryWriteBehind::Tick),
+			FXLibraryWriteBehindPrivate::TickIntervalSeconds);
+	}
+}
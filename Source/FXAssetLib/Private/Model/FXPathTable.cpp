@@ -0,0 +1,144 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXPathTable.h"
+
+FFXPathId FFXPathTable::Intern(const FSoftObjectPath& Path)
+{
+	if (const FFXPathId* Existing = Ids.Find(Path))
+	{
+		return *Existing;
+	}
+
+	FFXPathId NewId;
+	if (FreeIds.Num() > 0)
+	{
+		NewId = FreeIds.Pop(EAllowShrinking::No);
+		Paths[NewId] = Path;
+		RefCounts[NewId] = 0;
+	}
+	else
+	{
+		NewId = static_cast<FFXPathId>(Paths.Add(Path));
+		RefCounts.Add(0);
+	}
+	Ids.Add(Path, NewId);
+	IdsByAssetPath.FindOrAdd(Path.GetWithoutSubPath()).Add(NewId);
+	return NewId;
+}
+
+void FFXPathTable::AddRef(FFXPathId Id)
+{
+	RefCounts[Id]++;
+}
+
+bool FFXPathTable::Release(FFXPathId Id)
+{
+	check(RefCounts[Id] > 0);
+	if (--RefCounts[Id] > 0)
+	{
+		return false;
+	}
+
+	Free(Id);
+	return true;
+}
+
+void FFXPathTable::ClearRefCounts()
+{
+	for (int32& RefCount : RefCounts)
+	{
+		RefCount = 0;
+	}
+}
+
+void FFXPathTable::Compact(TArray<FFXPathId>& OutFreedIds)
+{
+	// 해제된 ID는 Ids에 없으므로 Ids 기준으로 참조 없는 ID 수집
+	for (const TPair<FSoftObjectPath, FFXPathId>& Pair : Ids)
+	{
+		if (RefCounts[Pair.Value] == 0)
+		{
+			OutFreedIds.Add(Pair.Value);
+		}
+	}
+
+	for (FFXPathId Id : OutFreedIds)
+	{
+		Free(Id);
+	}
+}
+
+void FFXPathTable::Free(FFXPathId Id)
+{
+	FSoftObjectPath& Path = Paths[Id];
+	Ids.Remove(Path);
+
+	const FSoftObjectPath AssetPath = Path.GetWithoutSubPath();
+	if (TArray<FFXPathId, TInlineAllocator<1>>* AssetIds = IdsByAssetPath.Find(AssetPath))
+	{
+		AssetIds->RemoveSingleSwap(Id);
+		if (AssetIds->Num() == 0)
+		{
+			IdsByAssetPath.Remove(AssetPath);
+		}
+	}
+
+	// 표시 중인 뷰 항목은 목록이 공유 포인터로 유지하므로 테이블 쪽 참조만 해제
+	if (ViewItems.IsValidIndex(static_cast<int32>(Id)) && ViewItems[Id].IsValid())
+	{
+		ViewItems[Id].Reset();
+		NumCreatedViewItems--;
+	}
+
+	Path.Reset();
+	FreeIds.Add(Id);
+}
+
+FFXPathId FFXPathTable::Find(const FSoftObjectPath& Path) const
+{
+	const FFXPathId* Existing = Ids.Find(Path);
+	return Existing ? *Existing : FXInvalidPathId;
+}
+
+void FFXPathTable::FindByAssetPath(const FSoftObjectPath& AssetPath, TArray<FFXPathId>& OutIds) const
+{
+	if (const TArray<FFXPathId, TInlineAllocator<1>>* AssetIds = IdsByAssetPath.Find(AssetPath.GetWithoutSubPath()))
+	{
+		OutIds.Append(*AssetIds);
+	}
+}
+
+const TSharedPtr<FSoftObjectPath>& FFXPathTable::GetViewItem(FFXPathId Id)
+{
+	if (ViewItems.Num() <= static_cast<int32>(Id))
+	{
+		ViewItems.SetNum(Paths.Num());
+	}
+
+	TSharedPtr<FSoftObjectPath>& ViewItem = ViewItems[Id];
+	if (!ViewItem.IsValid())
+	{
+		ViewItem = MakeShared<FSoftObjectPath>(Paths[Id]);
+		NumCreatedViewItems++;
+	}
+	return ViewItem;
+}
+
+void FFXPathTable::Reset()
+{
+	Paths.Reset();
+	Ids.Reset();
+	IdsByAssetPath.Reset();
+	ViewItems.Reset();
+	NumCreatedViewItems = 0;
+	RefCounts.Reset();
+	FreeIds.Reset();
+}
+
+SIZE_T FFXPathTable::GetAllocatedSize() const
+{
+	// 뷰 항목은 MakeShared 블록 (참조 카운트 + 경로 복사본), 역색인 배열은 대부분 인라인
+	const SIZE_T ViewItemBytes = NumCreatedViewItems * sizeof(SharedPointerInternals::TIntrusiveReferenceController<FSoftObjectPath, ESPMode::ThreadSafe>);
+	return Paths.GetAllocatedSize() + Ids.GetAllocatedSize() + IdsByAssetPath.GetAllocatedSize() + ViewItems.GetAllocatedSize() + ViewItemBytes
+		+ RefCounts.GetAllocatedSize() + FreeIds.GetAllocatedSize();
+}
@@ -0,0 +1,459 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXSharedLibrary.h"
+#include "Model/FXLibraryDatabase.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Crc.h"
+#include "Misc/Guid.h"
+#include "Algo/AnyOf.h"
+
+namespace FXSharedLibraryPrivate
+{
+	// 이 시간보다 오래된 잠금은 비정상 종료로 남은 것으로 간주
+	static constexpr double StaleLockSeconds = 30.0;
+
+	static TMap<FName, const FFXCategoryData*> IndexByName(const TArray<FFXCategoryData>& Categories)
+	{
+		TMap<FName, const FFXCategoryData*> Index;
+		Index.Reserve(Categories.Num());
+		for (const FFXCategoryData& Category : Categories)
+		{
+			Index.Add(Category.CategoryName, &Category);
+		}
+		return Index;
+	}
+
+	static bool IsUnchanged(const FFXCategoryData* Base, const FFXCategoryData& Current)
+	{
+		return Base && FFXLibraryDatabase::ComputeCategoryHash(*Base) == FFXLibraryDatabase::ComputeCategoryHash(Current);
+	}
+
+	// 카테고리의 항목별 변형/참조 정보
+	struct FEntryMetadataIndex
+	{
+		TSet<FSoftObjectPath> ReferencedAssets;
+		TMap<FSoftObjectPath, const FFXAssetVariant*> Variants;
+
+		explicit FEntryMetadataIndex(const FFXCategoryData* Category)
+		{
+			if (!Category)
+			{
+				return;
+			}
+			ReferencedAssets.Append(Category->ReferencedAssets);
+			for (const FFXAssetVariant& Variant : Category->Variants)
+			{
+				Variants.Add(Variant.GetEntryPath(), &Variant);
+			}
+		}
+
+		bool IsSameEntry(const FEntryMetadataIndex& Other, const FSoftObjectPath& AssetPath) const
+		{
+			if (ReferencedAssets.Contains(AssetPath) != Other.ReferencedAssets.Contains(AssetPath))
+			{
+				return false;
+			}
+
+			const FFXAssetVariant* const* Variant = Variants.Find(AssetPath);
+			const FFXAssetVariant* const* OtherVariant = Other.Variants.Find(AssetPath);
+			if (!Variant || !OtherVariant)
+			{
+				return !Variant && !OtherVariant;
+			}
+			return FFXAssetVariant::StaticStruct()->CompareScriptStruct(*Variant, *OtherVariant, PPF_None);
+		}
+
+		void CopyEntryTo(const FSoftObjectPath& AssetPath, FFXCategoryData& Target) const
+		{
+			if (ReferencedAssets.Contains(AssetPath))
+			{
+				Target.ReferencedAssets.Add(AssetPath);
+			}
+			if (const FFXAssetVariant* const* Variant = Variants.Find(AssetPath))
+			{
+				Target.Variants.Add(**Variant);
+			}
+		}
+	};
+
+	// 카테고리 내용 병합 (항목 단위 3-way)
+	static FFXCategoryData MergeCategory(const FFXCategoryData* Base, const FFXCategoryData& Ours, const FFXCategoryData& Theirs)
+	{
+		FFXCategoryData Merged(Ours.CategoryName);
+		Merged.IconPath = (Base && Ours.IconPath == Base->IconPath) ? Theirs.IconPath : Ours.IconPath;
+
+		TSet<FSoftObjectPath> BaseAssets;
+		if (Base)
+		{
+			BaseAssets.Append(Base->Assets);
+		}
+		TSet<FSoftObjectPath> OurAssets;
+		OurAssets.Append(Ours.Assets);
+		TSet<FSoftObjectPath> TheirAssets;
+		TheirAssets.Append(Theirs.Assets);
+
+		// 우리 순서 유지: 양쪽에 있거나 우리가 추가한 항목 (상대가 삭제한 항목은 제외)
+		for (const FSoftObjectPath& AssetPath : Ours.Assets)
+		{
+			if (TheirAssets.Contains(AssetPath) || !BaseAssets.Contains(AssetPath))
+			{
+				Merged.Assets.Add(AssetPath);
+			}
+		}
+		// 상대가 추가한 항목은 뒤에 추가
+		for (const FSoftObjectPath& AssetPath : Theirs.Assets)
+		{
+			if (!OurAssets.Contains(AssetPath) && !BaseAssets.Contains(AssetPath))
+			{
+				Merged.Assets.Add(AssetPath);
+			}
+		}
+
+		// 변형/참조 정보는 항목을 가진 쪽에서 가져옴
+		// 양쪽 모두 있으면 아이콘과 같은 규칙 (우리가 기준에서 바꾸지 않았으면 상대 쪽, 아니면 우리 쪽)
+		const FEntryMetadataIndex BaseMetadata(Base);
+		const FEntryMetadataIndex OurMetadata(&Ours);
+		const FEntryMetadataIndex TheirMetadata(&Theirs);
+		for (const FSoftObjectPath& AssetPath : Merged.Assets)
+		{
+			const bool bInOurs = OurAssets.Contains(AssetPath);
+			const bool bInTheirs = TheirAssets.Contains(AssetPath);
+			const bool bOursUnchanged = BaseAssets.Contains(AssetPath) && OurMetadata.IsSameEntry(BaseMetadata, AssetPath);
+
+			const FEntryMetadataIndex& Source = (!bInOurs || (bInTheirs && bOursUnchanged)) ? TheirMetadata : OurMetadata;
+			Source.CopyEntryTo(AssetPath, Merged);
+		}
+
+		return Merged;
+	}
+}
+
+FFXSharedLibrary& FFXSharedLibrary::Get()
+{
+	static FFXSharedLibrary SharedLibrary;
+	return SharedLibrary;
+}
+
+FString FFXSharedLibrary::GetLibraryPath() const
+{
+	const UFXLibrarySettings* Settings = GetDefault<UFXLibrarySettings>();
+	return FPaths::ConvertRelativePathToFull(Settings->SharedLibraryDirectory.Path) / TEXT("FXLibrary.fxdb");
+}
+
+FString FFXSharedLibrary::GetLockPath() const
+{
+	return GetLibraryPath() + TEXT(".lock");
+}
+
+bool FFXSharedLibrary::Load()
+{
+	UFXLibrarySettings* Settings = GetMutableDefault<UFXLibrarySettings>();
+
+	TArray<FFXCategoryData> SharedCategories;
+	uint32 SharedCrc = 0;
+	const bool bLoadedFromShare = ReadSharedFile(SharedCategories, SharedCrc);
+	if (bLoadedFromShare)
+	{
+		Settings->Categories = SharedCategories;
+		Settings->InvalidateCategoryIndex();
+		BaseCategories = MoveTemp(SharedCategories);
+		LastKnownCrc = SharedCrc;
+		UE_LOG(LogTemp, Log, TEXT("[FX Library Shared] Loaded %d categories from %s"), BaseCategories.Num(), *GetLibraryPath());
+	}
+	else
+	{
+		// 공유 파일이 없으면 현재 로컬 라이브러리로 생성
+		BaseCategories.Reset();
+		if (Write())
+		{
+			UE_LOG(LogTemp, Log, TEXT("[FX Library Shared] Created shared library with %d categories: %s"), Settings->Categories.Num(), *GetLibraryPath());
+		}
+	}
+
+	bLoaded = true;
+	StartWatching();
+	return bLoadedFromShare;
+}
+
+bool FFXSharedLibrary::Write()
+{
+	if (!AcquireLock())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FX Library Shared] Library is locked by another user, will retry: %s"), *GetLockPath());
+		return false;
+	}
+
+	UFXLibrarySettings* Settings = GetMutableDefault<UFXLibrarySettings>();
+
+	// 마지막 동기화 이후 다른 사용자가 쓴 내용과 병합
+	TArray<FFXCategoryData> Theirs;
+	uint32 TheirCrc = 0;
+	if (ReadSharedFile(Theirs, TheirCrc) && TheirCrc != LastKnownCrc)
+	{
+		TArray<FFXCategoryData> Merged;
+		MergeCategories(BaseCategories, Settings->Categories, Theirs, Merged);
+		ApplyMerged(MoveTemp(Merged));
+	}
+
+	const bool bSuccess = WriteSharedFile(Settings->Categories);
+	if (bSuccess)
+	{
+		BaseCategories = Settings->Categories;
+	}
+
+	ReleaseLock();
+	return bSuccess;
+}
+
+void FFXSharedLibrary::Shutdown()
+{
+	if (WatcherHandle.IsValid())
+	{
+		if (FDirectoryWatcherModule* WatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+		{
+			if (IDirectoryWatcher* DirectoryWatcher = WatcherModule->Get())
+			{
+				DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(WatchedDirectory, WatcherHandle);
+			}
+		}
+		WatcherHandle.Reset();
+	}
+}
+
+void FFXSharedLibrary::MergeCategories(
+	const TArray<FFXCategoryData>& Base,
+	const TArray<FFXCategoryData>& Ours,
+	const TArray<FFXCategoryData>& Theirs,
+	TArray<FFXCategoryData>& OutMerged)
+{
+	using namespace FXSharedLibraryPrivate;
+
+	const TMap<FName, const FFXCategoryData*> BaseIndex = IndexByName(Base);
+	const TMap<FName, const FFXCategoryData*> OurIndex = IndexByName(Ours);
+	const TMap<FName, const FFXCategoryData*> TheirIndex = IndexByName(Theirs);
+
+	OutMerged.Reset();
+	OutMerged.Reserve(FMath::Max(Ours.Num(), Theirs.Num()));
+
+	for (const FFXCategoryData& OurCategory : Ours)
+	{
+		const FFXCategoryData* BaseCategory = BaseIndex.FindRef(OurCategory.CategoryName);
+		const FFXCategoryData* TheirCategory = TheirIndex.FindRef(OurCategory.CategoryName);
+
+		if (!TheirCategory)
+		{
+			// 상대가 삭제: 우리가 수정하지 않았으면 삭제 반영
+			if (!IsUnchanged(BaseCategory, OurCategory))
+			{
+				OutMerged.Add(OurCategory);
+			}
+			continue;
+		}
+
+		OutMerged.Add(MergeCategory(BaseCategory, OurCategory, *TheirCategory));
+	}
+
+	for (const FFXCategoryData& TheirCategory : Theirs)
+	{
+		if (OurIndex.Contains(TheirCategory.CategoryName))
+		{
+			continue;
+		}
+
+		// 우리가 삭제: 상대가 수정하지 않았으면 삭제 유지
+		if (!IsUnchanged(BaseIndex.FindRef(TheirCategory.CategoryName), TheirCategory))
+		{
+			OutMerged.Add(TheirCategory);
+		}
+	}
+}
+
+bool FFXSharedLibrary::ReadSharedFile(TArray<FFXCategoryData>& OutCategories, uint32& OutCrc) const
+{
+	TArray64<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetLibraryPath(), FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	if (!FFXLibraryDatabase::DeserializeSnapshot(Bytes, OutCategories))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FX Library Shared] Invalid shared library file: %s"), *GetLibraryPath());
+		return false;
+	}
+
+	OutCrc = FCrc::MemCrc32(Bytes.GetData(), Bytes.Num());
+	return true;
+}
+
+bool FFXSharedLibrary::WriteSharedFile(const TArray<FFXCategoryData>& Categories)
+{
+	TArray64<uint8> Bytes;
+	FFXLibraryDatabase::SerializeSnapshot(Categories, Bytes);
+
+	// 같은 디렉터리의 임시 파일에 쓴 뒤 교체 (다른 사용자가 반쯤 쓴 파일을 읽지 않도록)
+	const FString LibraryPath = GetLibraryPath();
+	const FString TempPath = FString::Printf(TEXT("%s.%s.tmp"), *LibraryPath, *FGuid::NewGuid().ToString());
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FX Library Shared] Failed to write: %s"), *TempPath);
+		return false;
+	}
+
+	if (!IFileManager::Get().Move(*LibraryPath, *TempPath, true, true))
+	{
+		IFileManager::Get().Delete(*TempPath);
+		UE_LOG(LogTemp, Error, TEXT("[FX Library Shared] Failed to replace: %s"), *LibraryPath);
+		return false;
+	}
+
+	// 자신의 쓰기로 발생한 변경 알림은 무시
+	LastKnownCrc = FCrc::MemCrc32(Bytes.GetData(), Bytes.Num());
+	UE_LOG(LogTemp, Log, TEXT("[FX Library Shared] Wrote %d categories (%lld bytes)"), Categories.Num(), Bytes.Num());
+	return true;
+}
+
+bool FFXSharedLibrary::AcquireLock()
+{
+	using namespace FXSharedLibraryPrivate;
+
+	IFileManager& FileManager = IFileManager::Get();
+	const FString LockPath = GetLockPath();
+	FileManager.MakeDirectory(*FPaths::GetPath(LockPath), true);
+
+	LockOwner = FString::Printf(TEXT("%s@%s %s"), FPlatformProcess::UserName(), FPlatformProcess::ComputerName(), *FGuid::NewGuid().ToString());
+
+	// 게임 스레드에서 기다리지 않고 한 번만 시도 (실패하면 쓰기 지연 저장기가 더티를 유지하고 다음 디바운스에 재시도)
+	if (FileManager.FileExists(*LockPath))
+	{
+		const FDateTime LockTime = FileManager.GetTimeStamp(*LockPath);
+		if (LockTime == FDateTime::MinValue() || (FDateTime::UtcNow() - LockTime).GetTotalSeconds() <= StaleLockSeconds)
+		{
+			LockOwner.Reset();
+			return false;
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("[FX Library Shared] Removing stale lock: %s"), *LockPath);
+		FileManager.Delete(*LockPath, false, false, true);
+	}
+
+	if (FFileHelper::SaveStringToFile(LockOwner, *LockPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &FileManager, FILEWRITE_NoReplaceExisting))
+	{
+		// 동시에 생성한 경우 마지막 쓰기만 남으므로 내용을 다시 읽어 소유 확인
+		FString CurrentOwner;
+		if (FFileHelper::LoadFileToString(CurrentOwner, *LockPath) && CurrentOwner == LockOwner)
+		{
+			return true;
+		}
+	}
+
+	LockOwner.Reset();
+	return false;
+}
+
+void FFXSharedLibrary::ReleaseLock()
+{
+	// 오래된 잠금으로 판단되어 다른 사용자가 가져간 경우 지우지 않음
+	const FString LockPath = GetLockPath();
+	FString CurrentOwner;
+	if (!LockOwner.IsEmpty() && FFileHelper::LoadFileToString(CurrentOwner, *LockPath) && CurrentOwner == LockOwner)
+	{
+		IFileManager::Get().Delete(*LockPath, false, false, true);
+	}
+	LockOwner.Reset();
+}
+
+void FFXSharedLibrary::StartWatching()
+{
+	const FString Directory = FPaths::GetPath(GetLibraryPath());
+	if (WatcherHandle.IsValid() && WatchedDirectory == Directory)
+	{
+		return;
+	}
+	Shutdown();
+
+	FDirectoryWatcherModule& WatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	if (IDirectoryWatcher* DirectoryWatcher = WatcherModule.Get())
+	{
+		WatchedDirectory = Directory;
+		DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+			WatchedDirectory,
+			IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FFXSharedLibrary::OnDirectoryChanged),
+			WatcherHandle);
+	}
+}
+
+void FFXSharedLibrary::OnDirectoryChanged(const TArray<FFileChangeData>& FileChanges)
+{
+	// 잠금/임시 파일 변경은 무시하고 라이브러리 파일만 확인
+	const FString LibraryPath = GetLibraryPath();
+	const bool bLibraryChanged = Algo::AnyOf(FileChanges, [&LibraryPath](const FFileChangeData& Change)
+	{
+		return FPaths::IsSamePath(Change.Filename, LibraryPath);
+	});
+
+	if (bLibraryChanged)
+	{
+		SyncFromDisk();
+	}
+}
+
+void FFXSharedLibrary::SyncFromDisk()
+{
+	TArray<FFXCategoryData> Theirs;
+	uint32 TheirCrc = 0;
+	if (!ReadSharedFile(Theirs, TheirCrc) || TheirCrc == LastKnownCrc)
+	{
+		return;
+	}
+
+	// 아직 저장되지 않은 로컬 변경은 병합 결과에 남고, 쓰기 지연 저장이 다시 기록함
+	const UFXLibrarySettings* Settings = GetDefault<UFXLibrarySettings>();
+	TArray<FFXCategoryData> Merged;
+	MergeCategories(BaseCategories, Settings->Categories, Theirs, Merged);
+
+	BaseCategories = MoveTemp(Theirs);
+	LastKnownCrc = TheirCrc;
+	ApplyMerged(MoveTemp(Merged));
+}
+
+void FFXSharedLibrary::ApplyMerged(TArray<FFXCategoryData>&& Merged)
+{
+	UFXLibrarySettings* Settings = GetMutableDefault<UFXLibrarySettings>();
+
+	// 카테고리 해시를 비교하여 바뀐 카테고리만 추림
+	TMap<FName, uint32> CurrentHashes;
+	CurrentHashes.Reserve(Settings->Categories.Num());
+	for (const FFXCategoryData& Category : Settings->Categories)
+	{
+		CurrentHashes.Add(Category.CategoryName, FFXLibraryDatabase::ComputeCategoryHash(Category));
+	}
+
+	TArray<FName> ChangedCategories;
+	for (const FFXCategoryData& Category : Merged)
+	{
+		const uint32* CurrentHash = CurrentHashes.Find(Category.CategoryName);
+		if (!CurrentHash || *CurrentHash != FFXLibraryDatabase::ComputeCategoryHash(Category))
+		{
+			ChangedCategories.Add(Category.CategoryName);
+		}
+		CurrentHashes.Remove(Category.CategoryName);
+	}
+
+	TArray<FName> RemovedCategories;
+	CurrentHashes.GenerateKeyArray(RemovedCategories);
+
+	Settings->Categories = MoveTemp(Merged);
+	Settings->InvalidateCategoryIndex();
+
+	if (ChangedCategories.Num() > 0 || RemovedCategories.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[FX Library Shared] Applied external changes: %d changed, %d removed categories"),
+			ChangedCategories.Num(), RemovedCategories.Num());
+		OnExternalChange.Broadcast(ChangedCategories, RemovedCategories);
+	}
+}
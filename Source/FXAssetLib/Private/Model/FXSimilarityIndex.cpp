@@ -0,0 +1,238 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXSimilarityIndex.h"
+#include "Math/VectorRegister.h"
+
+// ===== FFXEffectFeatures =====
+
+FString FFXEffectFeatures::ToTagString() const
+{
+	FString Text;
+	Text.Reserve(NumDimensions * 8);
+	for (int32 Dimension = 0; Dimension < NumDimensions; ++Dimension)
+	{
+		if (Dimension > 0)
+		{
+			Text += TEXT(",");
+		}
+		Text += FString::Printf(TEXT("%.4f"), Values[Dimension]);
+	}
+	return Text;
+}
+
+bool FFXEffectFeatures::ParseTagString(const FString& Text, FFXEffectFeatures& OutFeatures)
+{
+	TArray<FString> Parts;
+	Text.ParseIntoArray(Parts, TEXT(","), false);
+
+	// 차원 수가 다른 값은 이전 형식이므로 다시 추출
+	if (Parts.Num() != NumDimensions)
+	{
+		return false;
+	}
+
+	FFXEffectFeatures Features;
+	for (int32 Dimension = 0; Dimension < NumDimensions; ++Dimension)
+	{
+		if (!LexTryParseString(Features.Values[Dimension], *Parts[Dimension].TrimStartAndEnd()))
+		{
+			return false;
+		}
+	}
+
+	OutFeatures = Features;
+	return true;
+}
+
+// ===== FFXSimilarityIndex =====
+
+bool FFXSimilarityIndex::SetFeatures(FFXPathId PathId, const FFXEffectFeatures& Features)
+{
+	if (PathId == FXInvalidPathId)
+	{
+		return false;
+	}
+
+	if (PathId >= static_cast<uint32>(PathRows.Num()))
+	{
+		const int32 OldNum = PathRows.Num();
+		PathRows.SetNumUninitialized(PathId + 1);
+		for (int32 Index = OldNum; Index < PathRows.Num(); ++Index)
+		{
+			PathRows[Index] = INDEX_NONE;
+		}
+	}
+
+	int32& Row = PathRows[PathId];
+	if (Row != INDEX_NONE)
+	{
+		FFXEffectFeatures Existing;
+		ReadRow(Row, Existing);
+		if (Existing == Features)
+		{
+			return false;
+		}
+	}
+	else
+	{
+		Row = RowPathIds.Add(PathId);
+		if (Row / LanesPerBlock >= Blocks.Num())
+		{
+			Blocks.AddZeroed();
+		}
+	}
+
+	WriteRow(Row, Features);
+	return true;
+}
+
+bool FFXSimilarityIndex::Contains(FFXPathId PathId) const
+{
+	return PathId < static_cast<uint32>(PathRows.Num()) && PathRows[PathId] != INDEX_NONE;
+}
+
+bool FFXSimilarityIndex::GetFeatures(FFXPathId PathId, FFXEffectFeatures& OutFeatures) const
+{
+	if (!Contains(PathId))
+	{
+		return false;
+	}
+
+	ReadRow(PathRows[PathId], OutFeatures);
+	return true;
+}
+
+bool FFXSimilarityIndex::Remove(FFXPathId PathId)
+{
+	if (!Contains(PathId))
+	{
+		return false;
+	}
+
+	// 마지막 행을 빈 자리로 옮겨 행을 연속으로 유지
+	const int32 Row = PathRows[PathId];
+	const int32 LastRow = RowPathIds.Num() - 1;
+	if (Row != LastRow)
+	{
+		FFXEffectFeatures LastFeatures;
+		ReadRow(LastRow, LastFeatures);
+		WriteRow(Row, LastFeatures);
+
+		const FFXPathId MovedPathId = RowPathIds[LastRow];
+		RowPathIds[Row] = MovedPathId;
+		PathRows[MovedPathId] = Row;
+	}
+
+	WriteRow(LastRow, FFXEffectFeatures());
+	RowPathIds.Pop(EAllowShrinking::No);
+	PathRows[PathId] = INDEX_NONE;
+
+	if (RowPathIds.Num() <= (Blocks.Num() - 1) * LanesPerBlock)
+	{
+		Blocks.Pop(EAllowShrinking::No);
+	}
+	return true;
+}
+
+void FFXSimilarityIndex::FindNearest(const FFXEffectFeatures& Query, int32 MaxResults, TFunctionRef<bool(FFXPathId)> Filter, TArray<FFXSimilarEffect>& OutResults) const
+{
+	OutResults.Reset();
+	if (MaxResults <= 0 || RowPathIds.Num() == 0)
+	{
+		return;
+	}
+
+	// 차원별 질의 값을 4열에 복제
+	VectorRegister4Float QueryLanes[FFXEffectFeatures::NumDimensions];
+	for (int32 Dimension = 0; Dimension < FFXEffectFeatures::NumDimensions; ++Dimension)
+	{
+		QueryLanes[Dimension] = VectorSetFloat1(Query.Values[Dimension]);
+	}
+
+	// 상위 MaxResults개만 유지 (힙의 맨 위가 가장 먼 결과)
+	auto IsNearer = [](const FFXSimilarEffect& A, const FFXSimilarEffect& B)
+	{
+		return A.Distance != B.Distance ? A.Distance < B.Distance : A.PathId < B.PathId;
+	};
+	auto IsFarther = [&IsNearer](const FFXSimilarEffect& A, const FFXSimilarEffect& B) { return IsNearer(B, A); };
+
+	TArray<FFXSimilarEffect> Heap;
+	Heap.Reserve(MaxResults + 1);
+
+	const int32 NumRows = RowPathIds.Num();
+	for (int32 BlockIndex = 0; BlockIndex < Blocks.Num(); ++BlockIndex)
+	{
+		const FBlock& Block = Blocks[BlockIndex];
+
+		// 4개 행의 제곱 거리를 동시에 누적
+		VectorRegister4Float Sum = VectorZeroFloat();
+		for (int32 Dimension = 0; Dimension < FFXEffectFeatures::NumDimensions; ++Dimension)
+		{
+			const VectorRegister4Float Diff = VectorSubtract(VectorLoadAligned(Block.Values[Dimension]), QueryLanes[Dimension]);
+			Sum = VectorMultiplyAdd(Diff, Diff, Sum);
+		}
+
+		alignas(16) float SquaredDistances[LanesPerBlock];
+		VectorStoreAligned(Sum, SquaredDistances);
+
+		const int32 FirstRow = BlockIndex * LanesPerBlock;
+		const int32 NumLanes = FMath::Min(LanesPerBlock, NumRows - FirstRow);
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			const FFXSimilarEffect Candidate{ RowPathIds[FirstRow + Lane], SquaredDistances[Lane] };
+			if (Heap.Num() == MaxResults && !IsNearer(Candidate, Heap.HeapTop()))
+			{
+				continue;
+			}
+			if (!Filter(Candidate.PathId))
+			{
+				continue;
+			}
+
+			if (Heap.Num() == MaxResults)
+			{
+				Heap.HeapPopDiscard(IsFarther, EAllowShrinking::No);
+			}
+			Heap.HeapPush(Candidate, IsFarther);
+		}
+	}
+
+	Heap.Sort(IsNearer);
+	for (FFXSimilarEffect& Result : Heap)
+	{
+		Result.Distance = FMath::Sqrt(Result.Distance);
+	}
+	OutResults = MoveTemp(Heap);
+}
+
+void FFXSimilarityIndex::Reset()
+{
+	Blocks.Reset();
+	RowPathIds.Reset();
+	PathRows.Reset();
+}
+
+SIZE_T FFXSimilarityIndex::GetAllocatedSize() const
+{
+	return Blocks.GetAllocatedSize() + RowPathIds.GetAllocatedSize() + PathRows.GetAllocatedSize();
+}
+
+void FFXSimilarityIndex::WriteRow(int32 Row, const FFXEffectFeatures& Features)
+{
+	FBlock& Block = Blocks[Row / LanesPerBlock];
+	const int32 Lane = Row % LanesPerBlock;
+	for (int32 Dimension = 0; Dimension < FFXEffectFeatures::NumDimensions; ++Dimension)
+	{
+		Block.Values[Dimension][Lane] = Features.Values[Dimension];
+	}
+}
+
+void FFXSimilarityIndex::ReadRow(int32 Row, FFXEffectFeatures& OutFeatures) const
+{
+	const FBlock& Block = Blocks[Row / LanesPerBlock];
+	const int32 Lane = Row % LanesPerBlock;
+	for (int32 Dimension = 0; Dimension < FFXEffectFeatures::NumDimensions; ++Dimension)
+	{
+		OutFeatures.Values[Dimension] = Block.Values[Dimension][Lane];
+	}
+}
@@ -0,0 +1,114 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXLibraryDatabase.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FXLibraryDatabaseTestsPrivate
+{
+	static FFXJournalRecord MakeAddAssetRecord(FName CategoryName, const TCHAR* AssetPath)
+	{
+		FFXJournalRecord Record;
+		Record.Op = EFXJournalOp::AddAsset;
+		Record.CategoryName = CategoryName;
+		Record.Path = FSoftObjectPath(AssetPath);
+		return Record;
+	}
+
+	// 쓰기 도중 종료된 레코드 흉내 (프레임 헤더는 있지만 페이로드가 모자람)
+	static bool AppendTornFrame(const FString& JournalPath)
+	{
+		TArray<uint8> TornFrame;
+		FMemoryWriter Writer(TornFrame);
+		int32 PayloadSize = 64;
+		uint32 PayloadCrc = 0xDEADBEEF;
+		Writer << PayloadSize << PayloadCrc;
+		TornFrame.Append({ 1, 2, 3 });
+		return FFileHelper::SaveArrayToFile(TornFrame, *JournalPath, &IFileManager::Get(), FILEWRITE_Append);
+	}
+
+	// 크기는 맞지만 CRC가 다른 레코드 흉내 (부분 기록된 섹터)
+	static bool AppendBadCrcFrame(const FString& JournalPath)
+	{
+		TArray<uint8> BadFrame;
+		FMemoryWriter Writer(BadFrame);
+		int32 PayloadSize = 4;
+		uint32 PayloadCrc = 0xDEADBEEF;
+		uint32 Payload = 0;
+		Writer << PayloadSize << PayloadCrc << Payload;
+		return FFileHelper::SaveArrayToFile(BadFrame, *JournalPath, &IFileManager::Get(), FILEWRITE_Append);
+	}
+
+	static bool HasAsset(const TArray<FFXCategoryData>& Categories, FName CategoryName, const TCHAR* AssetPath)
+	{
+		const FFXCategoryData* Category = Categories.FindByPredicate([CategoryName](const FFXCategoryData& Data)
+		{
+			return Data.CategoryName == CategoryName;
+		});
+		return Category && Category->Assets.Contains(FSoftObjectPath(AssetPath));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFXLibraryDatabaseDamagedJournalTest, "FXAssetLib.Database.DamagedJournalRecovery",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFXLibraryDatabaseDamagedJournalTest::RunTest(const FString& Parameters)
+{
+	using namespace FXLibraryDatabaseTestsPrivate;
+
+	const FName CategoryName(TEXT("Fire"));
+	const TCHAR* AssetA = TEXT("/Game/FXLib/Fire/NS_A.NS_A");
+	const TCHAR* AssetB = TEXT("/Game/FXLib/Fire/NS_B.NS_B");
+	const TCHAR* AssetC = TEXT("/Game/FXLib/Fire/NS_C.NS_C");
+
+	// 끊긴 레코드 / CRC 불일치 레코드 두 경우 모두 확인
+	for (int32 DamageKind = 0; DamageKind < 2; ++DamageKind)
+	{
+		const FString DatabaseDirectory = FPaths::AutomationTransientDir() / TEXT("FXLibraryDatabase") / FString::FromInt(DamageKind);
+		IFileManager::Get().DeleteDirectory(*DatabaseDirectory, false, true);
+
+		// 1. 스냅샷 + 저널 1건 기록 후 비정상 종료
+		{
+			FFXLibraryDatabase Database(DatabaseDirectory);
+			TArray<FFXCategoryData> Categories;
+			Categories.Emplace(CategoryName);
+			TestTrue(TEXT("Initial snapshot written"), Database.WriteSnapshot(Categories));
+			TestTrue(TEXT("First record appended"), Database.AppendRecord(MakeAddAssetRecord(CategoryName, AssetA)));
+		}
+
+		const FString JournalPath = FFXLibraryDatabase(DatabaseDirectory).GetJournalPath();
+		TestTrue(TEXT("Damaged frame appended"), DamageKind == 0 ? AppendTornFrame(JournalPath) : AppendBadCrcFrame(JournalPath));
+
+		// 2. 재시작: 손상 전까지 재생 후 새 레코드 추가
+		{
+			FFXLibraryDatabase Database(DatabaseDirectory);
+			TArray<FFXCategoryData> Categories;
+			TestTrue(TEXT("Load after crash"), Database.Load(Categories));
+			TestTrue(TEXT("Record before damage replayed"), HasAsset(Categories, CategoryName, AssetA));
+			TestTrue(TEXT("Append after crash"), Database.AppendRecord(MakeAddAssetRecord(CategoryName, AssetB)));
+			TestTrue(TEXT("Second append after crash"), Database.AppendRecord(MakeAddAssetRecord(CategoryName, AssetC)));
+		}
+
+		// 3. 다시 로드: 손상 이후 추가한 레코드도 모두 재생되어야 함
+		{
+			FFXLibraryDatabase Database(DatabaseDirectory);
+			TArray<FFXCategoryData> Categories;
+			TestTrue(TEXT("Reload"), Database.Load(Categories));
+			TestTrue(TEXT("Record before damage kept"), HasAsset(Categories, CategoryName, AssetA));
+			TestTrue(TEXT("Record appended after crash replayed"), HasAsset(Categories, CategoryName, AssetB));
+			TestTrue(TEXT("Second record appended after crash replayed"), HasAsset(Categories, CategoryName, AssetC));
+			TestEqual(TEXT("Journal holds only records appended after recovery"), Database.GetJournalRecordCount(), 2);
+		}
+
+		IFileManager::Get().DeleteDirectory(*DatabaseDirectory, false, true);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
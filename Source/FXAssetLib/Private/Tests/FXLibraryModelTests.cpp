@@ -0,0 +1,191 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXLibraryModel.h"
+#include "Model/FXLibraryState.h"
+#include "Model/FXLibraryStorage.h"
+#include "Model/FXLibraryDatabase.h"
+#include "Model/FXAssetRegistryView.h"
+#include "Model/FXCategoryIndex.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FXLibraryModelTestsPrivate
+{
+	static const FTopLevelAssetPath SystemClassPath(TEXT("/Script/Niagara"), TEXT("NiagaraSystem"));
+
+	static const FFXCategoryData* FindCategoryData(const TArray<FFXCategoryData>& Categories, FName CategoryName)
+	{
+		return Categories.FindByPredicate([CategoryName](const FFXCategoryData& Data)
+		{
+			return Data.CategoryName == CategoryName;
+		});
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFXLibraryModelJournalReplayTest, "FXAssetLib.Model.JournalReplay",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFXLibraryModelJournalReplayTest::RunTest(const FString& Parameters)
+{
+	using namespace FXLibraryModelTestsPrivate;
+
+	const FName Fire(TEXT("Fire"));
+	const FName Smoke(TEXT("Smoke"));
+	const FName Water(TEXT("Water"));
+	const FSoftObjectPath AssetA(TEXT("/Game/FXLib/Fire/NS_A.NS_A"));
+	const FSoftObjectPath AssetB(TEXT("/Game/FXLib/Fire/NS_B.NS_B"));
+	const FSoftObjectPath AssetC(TEXT("/Game/FXLib/Smoke/NS_C.NS_C"));
+	const FSoftObjectPath MovedA(TEXT("/Game/FXLib/Moved/NS_A.NS_A"));
+
+	// 저널 재생의 시작점 (스냅샷 역할)
+	TArray<FFXCategoryData> InitialCategories;
+	InitialCategories.Emplace(Fire).Assets.Add(AssetA);
+	InitialCategories.Emplace(Smoke);
+
+	TSharedRef<FFXInMemoryLibraryStorage> Storage = MakeShared<FFXInMemoryLibraryStorage>(InitialCategories);
+	TSharedRef<FFXInMemoryAssetRegistryView> Registry = MakeShared<FFXInMemoryAssetRegistryView>();
+	Registry->AddAsset(AssetA, SystemClassPath);
+	Registry->AddAsset(AssetB, SystemClassPath);
+	Registry->AddAsset(AssetC, SystemClassPath);
+
+	FFXLibraryModel Model(Storage, Registry);
+	Model.SetState(MakeShared<FFXLibraryState>());
+	Model.LoadFromSettings();
+
+	// 추가, 변형, 카테고리 추가/제거, 이름 변경 따라가기, 삭제
+	TestTrue(TEXT("Add single"), Model.AddAssetToCategory(Fire, AssetB));
+	const int32 NumRecordsBeforeDuplicate = Storage->GetMarkedRecords().Num();
+	TestFalse(TEXT("Add duplicate"), Model.AddAssetToCategory(Fire, AssetB));
+	TestEqual(TEXT("Duplicate add is not journaled"), Storage->GetMarkedRecords().Num(), NumRecordsBeforeDuplicate);
+	TestEqual(TEXT("Add batch"), Model.AddAssetsToCategory(Smoke, { AssetA, AssetC }), 2);
+
+	FFXAssetVariant Variant;
+	Variant.VariantName = TEXT("Blue");
+	Variant.BasePath = AssetA;
+	FFXUserParameterOverride& Override = Variant.Overrides.AddDefaulted_GetRef();
+	Override.ParameterName = TEXT("Color");
+	Override.Type = EFXUserParameterType::Color;
+	Override.ColorValue = FLinearColor::Blue;
+	TestTrue(TEXT("Add variant"), Model.AddVariantToCategory(Fire, Variant));
+
+	Model.AddCategory(Water);
+	TestTrue(TEXT("Add to new category"), Model.AddAssetToCategory(Water, AssetC));
+	TestTrue(TEXT("Remove category"), Model.RemoveCategory(Water));
+
+	Registry->RemoveAsset(AssetA);
+	Registry->AddAsset(MovedA, SystemClassPath);
+	Registry->RemoveAsset(AssetC);
+	TArray<FFXAssetRegistryChange> Changes;
+	Changes.Add({ EFXAssetRegistryChange::Renamed, MovedA, AssetA });
+	Changes.Add({ EFXAssetRegistryChange::Removed, AssetC, FSoftObjectPath() });
+	TestEqual(TEXT("Registry changes applied"), Model.ApplyRegistryChanges(Changes), 4);
+
+	TestTrue(TEXT("Renamed variant followed"), Model.IsAssetRegistered(FSoftObjectPath(MovedA.GetAssetPath(), TEXT("Blue"))));
+	TestFalse(TEXT("Old path no longer registered"), Model.IsAssetRegistered(AssetA));
+
+	// 저장소에 전달된 레코드만으로 같은 결과가 재생되어야 함
+	TArray<FFXCategoryData> Replayed = InitialCategories;
+	FFXCategoryIndex ReplayIndex;
+	for (const FFXJournalRecord& Record : Storage->GetMarkedRecords())
+	{
+		FFXLibraryDatabase::ApplyRecord(Record, Replayed, ReplayIndex);
+	}
+
+	const TArray<FFXCategoryData>& Expected = Storage->GetCategories();
+	TestEqual(TEXT("Replayed category count"), Replayed.Num(), Expected.Num());
+	for (const FFXCategoryData& ExpectedCategory : Expected)
+	{
+		const FFXCategoryData* ReplayedCategory = FindCategoryData(Replayed, ExpectedCategory.CategoryName);
+		if (!TestNotNull(*FString::Printf(TEXT("Replayed category %s"), *ExpectedCategory.CategoryName.ToString()), ReplayedCategory))
+		{
+			continue;
+		}
+
+		TestEqual(*FString::Printf(TEXT("Replayed assets in %s (order kept)"), *ExpectedCategory.CategoryName.ToString()),
+			ReplayedCategory->Assets, ExpectedCategory.Assets);
+		TestEqual(*FString::Printf(TEXT("Replayed hash of %s (variants/references)"), *ExpectedCategory.CategoryName.ToString()),
+			FFXLibraryDatabase::ComputeCategoryHash(*ReplayedCategory), FFXLibraryDatabase::ComputeCategoryHash(ExpectedCategory));
+	}
+
+	const FFXCategoryData* ReplayedFire = FindCategoryData(Replayed, Fire);
+	if (TestNotNull(TEXT("Fire replayed"), ReplayedFire))
+	{
+		TestEqual(TEXT("Renamed asset replaced in place"), ReplayedFire->Assets.IndexOfByKey(MovedA), 0);
+		TestEqual(TEXT("Variant follows renamed base"), ReplayedFire->Variants.Num() == 1 ? ReplayedFire->Variants[0].BasePath : FSoftObjectPath(), MovedA);
+	}
+	TestNull(TEXT("Removed category not replayed"), FindCategoryData(Replayed, Water));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFXLibraryModelCleanupTest, "FXAssetLib.Model.CleanupRedirectorChain",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFXLibraryModelCleanupTest::RunTest(const FString& Parameters)
+{
+	using namespace FXLibraryModelTestsPrivate;
+
+	const FName Fire(TEXT("Fire"));
+	const FSoftObjectPath SourceA(TEXT("/Game/Source/NS_A.NS_A"));
+	const FSoftObjectPath SourceB(TEXT("/Game/Moved/NS_A.NS_A"));
+	const FSoftObjectPath SourceC(TEXT("/Game/MovedAgain/NS_A.NS_A"));
+	const FSoftObjectPath MissingCopy(TEXT("/Game/FXLib/NS_Missing.NS_Missing"));
+
+	// 참조 원본이 두 번 이동 (A -> B -> C), 소유 복사본은 삭제됨
+	TSharedRef<FFXInMemoryLibraryStorage> Storage = MakeShared<FFXInMemoryLibraryStorage>();
+	TSharedRef<FFXInMemoryAssetRegistryView> Registry = MakeShared<FFXInMemoryAssetRegistryView>();
+	Registry->AddRedirector(SourceA, SourceB);
+	Registry->AddRedirector(SourceB, SourceC);
+	Registry->AddAsset(SourceC, SystemClassPath);
+
+	TSharedRef<FFXLibraryState> State = MakeShared<FFXLibraryState>();
+	FFXLibraryModel Model(Storage, Registry);
+	Model.SetState(State);
+	Model.LoadFromSettings();
+	Model.AddCategory(Fire);
+	TestTrue(TEXT("Add reference"), Model.AddReferencedAssetToCategory(Fire, SourceA));
+	TestTrue(TEXT("Add copy"), Model.AddAssetToCategory(Fire, MissingCopy));
+
+	const int32 NumRecordsBefore = Storage->GetMarkedRecords().Num();
+	TestEqual(TEXT("Missing copy removed"), Model.CleanupInvalidAssets(), 1);
+
+	const FFXCategoryData* FireCategory = Storage->FindCategory(Fire);
+	if (TestNotNull(TEXT("Fire kept"), FireCategory))
+	{
+		TestEqual(TEXT("Reference follows to final destination"), FireCategory->Assets, TArray<FSoftObjectPath>({ SourceC }));
+		TestEqual(TEXT("Reference flag follows"), FireCategory->ReferencedAssets, TArray<FSoftObjectPath>({ SourceC }));
+	}
+
+	// 전체 저장이 아닌 항목별 저널 레코드로 기록
+	const TArray<FFXJournalRecord>& Records = Storage->GetMarkedRecords();
+	if (TestEqual(TEXT("One record per cleaned entry"), Records.Num() - NumRecordsBefore, 2))
+	{
+		TestTrue(TEXT("Redirect recorded as replace"), Records[NumRecordsBefore].Op == EFXJournalOp::ReplaceAsset
+			&& Records[NumRecordsBefore].PreviousPath == SourceA && Records[NumRecordsBefore].Path == SourceC);
+		TestTrue(TEXT("Missing copy recorded as remove"), Records[NumRecordsBefore + 1].Op == EFXJournalOp::RemoveAsset
+			&& Records[NumRecordsBefore + 1].Path == MissingCopy);
+	}
+	TestEqual(TEXT("No full save requested"), Storage->GetNumMarkedDirty(), Records.Num());
+
+	// 빈 카테고리 정리도 카테고리별 저널 레코드로 기록하고 선택을 해제
+	const FName Smoke(TEXT("Smoke"));
+	Model.AddCategory(Smoke);
+	State->SetSelectedCategory(State->FindCategory(Smoke));
+
+	const int32 NumRecordsBeforeEmpty = Records.Num();
+	TestEqual(TEXT("Empty category removed"), Model.CleanupEmptyCategories(), 1);
+	TestNull(TEXT("Empty category removed from storage"), Storage->FindCategory(Smoke));
+	TestNotNull(TEXT("Non-empty category kept"), Storage->FindCategory(Fire));
+	TestFalse(TEXT("Removed category deselected"), State->SelectedCategory.IsValid());
+	if (TestEqual(TEXT("One record per removed category"), Records.Num() - NumRecordsBeforeEmpty, 1))
+	{
+		TestTrue(TEXT("Removal recorded"), Records[NumRecordsBeforeEmpty].Op == EFXJournalOp::RemoveCategory
+			&& Records[NumRecordsBeforeEmpty].CategoryName == Smoke);
+	}
+	TestEqual(TEXT("Still no full save requested"), Storage->GetNumMarkedDirty(), Records.Num());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,185 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXLibrarySearchIndex.h"
+#include "Model/FXFuzzyMatcher.h"
+#include "Model/FXLibraryModel.h"
+#include "Model/FXLibraryState.h"
+#include "Model/FXLibraryStorage.h"
+#include "Model/FXAssetRegistryView.h"
+#include "Core/FXAssetLibConstants.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FXLibrarySearchTestsPrivate
+{
+	static TArray<FString> GetVisibleAssetNames(const FFXLibraryState& State)
+	{
+		TArray<FString> Names;
+		for (const TSharedPtr<FSoftObjectPath>& Item : State.VisibleAssets)
+		{
+			Names.Add(Item->GetAssetName());
+		}
+		Names.Sort();
+		return Names;
+	}
+
+	static FAssetDataTagMap MakeHashtagTags(const TCHAR* Hashtags)
+	{
+		FAssetDataTagMap Tags;
+		Tags.Add(FFXAssetLibConstants::HashtagsMetadataTag, Hashtags);
+		return Tags;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFXSearchQueryParseTest, "FXAssetLib.Search.QueryParsing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFXSearchQueryParseTest::RunTest(const FString& Parameters)
+{
+	const FFXSearchQuery Query = FFXSearchQuery::Parse(TEXT("  Fire #Smoke|cat:Explosion -#wip name: foo:bar - "));
+	if (!TestEqual(TEXT("Clause count (lone '-' ignored)"), Query.Clauses.Num(), 5))
+	{
+		return false;
+	}
+
+	// 필드 없는 값은 모든 필드, 소문자로 비교
+	const FFXSearchQuery::FClause& Plain = Query.Clauses[0];
+	TestFalse(TEXT("Plain not negated"), Plain.bNegated);
+	TestEqual(TEXT("Plain alternatives"), Plain.Alternatives.Num(), 1);
+	TestTrue(TEXT("Plain searches all fields"), Plain.Alternatives[0].Fields == EFXSearchField::All);
+	TestEqual(TEXT("Plain prefix lowercased"), Plain.Alternatives[0].Prefix, FString(TEXT("fire")));
+
+	// | 는 절 안의 OR
+	const FFXSearchQuery::FClause& Either = Query.Clauses[1];
+	if (TestEqual(TEXT("OR alternatives"), Either.Alternatives.Num(), 2))
+	{
+		TestTrue(TEXT("Hashtag field"), Either.Alternatives[0].Fields == EFXSearchField::Hashtag);
+		TestEqual(TEXT("Hashtag prefix without #"), Either.Alternatives[0].Prefix, FString(TEXT("smoke")));
+		TestTrue(TEXT("Category field"), Either.Alternatives[1].Fields == EFXSearchField::Category);
+		TestEqual(TEXT("Category prefix"), Either.Alternatives[1].Prefix, FString(TEXT("explosion")));
+	}
+
+	const FFXSearchQuery::FClause& Excluded = Query.Clauses[2];
+	TestTrue(TEXT("Negated clause"), Excluded.bNegated);
+	TestTrue(TEXT("Negated hashtag field"), Excluded.Alternatives[0].Fields == EFXSearchField::Hashtag);
+	TestEqual(TEXT("Negated prefix"), Excluded.Alternatives[0].Prefix, FString(TEXT("wip")));
+
+	// 필드만 지정하면 해당 필드가 있는 항목 전체
+	TestTrue(TEXT("Field-only clause keeps field"), Query.Clauses[3].Alternatives[0].Fields == EFXSearchField::Name);
+	TestTrue(TEXT("Field-only clause has empty prefix"), Query.Clauses[3].Alternatives[0].Prefix.IsEmpty());
+
+	// 알 수 없는 필드 이름은 일반 검색어
+	TestTrue(TEXT("Unknown field searches all fields"), Query.Clauses[4].Alternatives[0].Fields == EFXSearchField::All);
+	TestEqual(TEXT("Unknown field kept in prefix"), Query.Clauses[4].Alternatives[0].Prefix, FString(TEXT("foo:bar")));
+
+	TestEqual(TEXT("Lone '#' matches any hashtag"), FFXSearchQuery::Parse(TEXT("  - # ")).Clauses.Num(), 1);
+	TestTrue(TEXT("Whitespace query is empty"), FFXSearchQuery::Parse(TEXT("   ")).IsEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFXLibrarySearchResultsTest, "FXAssetLib.Search.Results",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFXLibrarySearchResultsTest::RunTest(const FString& Parameters)
+{
+	using namespace FXLibrarySearchTestsPrivate;
+
+	const FName Fire(TEXT("Fire"));
+	const FName Smoke(TEXT("Smoke"));
+	const FSoftObjectPath FireBall(TEXT("/Game/FXLib/NS_FireBall.NS_FireBall"));
+	const FSoftObjectPath Torch(TEXT("/Game/FXLib/NS_Torch.NS_Torch"));
+	const FSoftObjectPath SmokeFire(TEXT("/Game/FXLib/NS_SmokeFire.NS_SmokeFire"));
+	const FTopLevelAssetPath SystemClassPath(TEXT("/Script/Niagara"), TEXT("NiagaraSystem"));
+
+	// 해시태그/클래스는 레지스트리 태그에서 조회
+	TSharedRef<FFXInMemoryAssetRegistryView> Registry = MakeShared<FFXInMemoryAssetRegistryView>();
+	Registry->AddAsset(FireBall, SystemClassPath, MakeHashtagTags(TEXT("big,explosion")));
+	Registry->AddAsset(Torch, SystemClassPath, MakeHashtagTags(TEXT("wip")));
+	Registry->AddAsset(SmokeFire, SystemClassPath);
+
+	TSharedRef<FFXLibraryState> State = MakeShared<FFXLibraryState>();
+	FFXLibraryModel Model(MakeShared<FFXInMemoryLibraryStorage>(), Registry);
+	Model.SetState(State);
+	Model.LoadFromSettings();
+	Model.AddAssetsToCategory(Fire, { FireBall, Torch });
+	Model.AddAssetsToCategory(Smoke, { SmokeFire });
+
+	State->SetSearchText(TEXT("fire"));
+	TestEqual(TEXT("Name/category prefix"), GetVisibleAssetNames(*State), TArray<FString>({ TEXT("NS_FireBall"), TEXT("NS_SmokeFire"), TEXT("NS_Torch") }));
+
+	State->SetSearchText(TEXT("fire -#wip"));
+	TestEqual(TEXT("Excluded hashtag"), GetVisibleAssetNames(*State), TArray<FString>({ TEXT("NS_FireBall"), TEXT("NS_SmokeFire") }));
+
+	State->SetSearchText(TEXT("cat:smo"));
+	TestEqual(TEXT("Category prefix"), GetVisibleAssetNames(*State), TArray<FString>({ TEXT("NS_SmokeFire") }));
+
+	State->SetSearchText(TEXT("#big|#wip class:niagara"));
+	TestEqual(TEXT("Hashtag OR with class"), GetVisibleAssetNames(*State), TArray<FString>({ TEXT("NS_FireBall"), TEXT("NS_Torch") }));
+
+	// 항목이 빠지면 검색 결과에서도 빠짐
+	Model.RemoveAssetFromCategory(Fire, Torch);
+	TestEqual(TEXT("Removed entry drops out"), GetVisibleAssetNames(*State), TArray<FString>({ TEXT("NS_FireBall") }));
+
+	State->SetSearchText(FString());
+	TestFalse(TEXT("Cleared search"), State->IsSearchActive());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFXFuzzyMatcherTest, "FXAssetLib.Search.FuzzyMatching",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFXFuzzyMatcherTest::RunTest(const FString& Parameters)
+{
+	FFXFuzzyMatcher Matcher;
+	const int32 FireBall = Matcher.AddCandidate(TEXT("NS_FireBall"));
+	const int32 FireBallLarge = Matcher.AddCandidate(TEXT("NS_FireBall_Large"));
+	const int32 SmokePuff = Matcher.AddCandidate(TEXT("NS_SmokePuff"));
+	Matcher.AddCandidate(TEXT("NS_Sparks"));
+	Matcher.AddCandidate(TEXT("NS_Waterfall"));
+	Matcher.AddCandidate(TEXT("NS_Lightning"));
+	Matcher.AddCandidate(TEXT("NS_Dust"));
+
+	// 허용 오타 수는 검색어 길이에 따라 증가
+	TestEqual(TEXT("Short query is exact"), FFXFuzzyMatcher::GetMaxErrors(2), 0);
+	TestEqual(TEXT("Medium query allows 1"), FFXFuzzyMatcher::GetMaxErrors(5), 1);
+	TestEqual(TEXT("Long query allows 2"), FFXFuzzyMatcher::GetMaxErrors(8), 2);
+
+	TArray<FFXFuzzyMatch> Matches;
+
+	// 정확히 일치하면 거리 0, 같은 조건이면 짧은 이름 우선
+	Matcher.Match(TEXT("fireball"), 10, Matches);
+	if (TestEqual(TEXT("Exact matches"), Matches.Num(), 2))
+	{
+		TestEqual(TEXT("Shorter name first"), Matches[0].CandidateIndex, FireBall);
+		TestEqual(TEXT("Exact distance"), Matches[0].Distance, 0);
+		TestEqual(TEXT("Longer name second"), Matches[1].CandidateIndex, FireBallLarge);
+	}
+
+	// 오타 (글자 바뀜/빠짐) 허용, 대소문자 무시
+	Matcher.Match(TEXT("FIERBALL"), 10, Matches);
+	TestTrue(TEXT("Transposition within tolerance"), Matches.Num() > 0 && Matches[0].CandidateIndex == FireBall && Matches[0].Distance <= 2);
+	Matcher.Match(TEXT("smokpuff"), 10, Matches);
+	TestTrue(TEXT("Missing letter within tolerance"), Matches.Num() == 1 && Matches[0].CandidateIndex == SmokePuff && Matches[0].Distance == 1);
+
+	// 짧은 검색어는 오타를 허용하지 않음
+	Matcher.Match(TEXT("zq"), 10, Matches);
+	TestEqual(TEXT("No match for unrelated short query"), Matches.Num(), 0);
+
+	// 이어 쓴 검색어는 이전 후보 풀만 다시 검사
+	Matcher.Match(TEXT("smok"), 10, Matches);
+	TestEqual(TEXT("New query scans all candidates"), Matcher.GetLastScannedCount(), Matcher.NumCandidates());
+	Matcher.Match(TEXT("smoke"), 10, Matches);
+	TestTrue(TEXT("Typed-ahead query rescans only the previous pool"), Matcher.GetLastScannedCount() < Matcher.NumCandidates());
+	TestTrue(TEXT("Typed-ahead result"), Matches.Num() > 0 && Matches[0].CandidateIndex == SmokePuff);
+
+	// 최대 개수 제한
+	Matcher.Match(TEXT("ns"), 1, Matches);
+	TestEqual(TEXT("MaxResults respected"), Matches.Num(), 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,114 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Model/FXSharedLibrary.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FXSharedLibraryTestsPrivate
+{
+	static FFXCategoryData MakeCategory(FName CategoryName, std::initializer_list<const TCHAR*> AssetPaths)
+	{
+		FFXCategoryData Category(CategoryName);
+		for (const TCHAR* AssetPath : AssetPaths)
+		{
+			Category.Assets.Emplace(AssetPath);
+		}
+		return Category;
+	}
+
+	static const FFXCategoryData* FindCategoryData(const TArray<FFXCategoryData>& Categories, FName CategoryName)
+	{
+		return Categories.FindByPredicate([CategoryName](const FFXCategoryData& Data)
+		{
+			return Data.CategoryName == CategoryName;
+		});
+	}
+
+	static FFXAssetVariant MakeVariant(const TCHAR* BasePath, float Intensity)
+	{
+		FFXAssetVariant Variant;
+		Variant.VariantName = TEXT("Bright");
+		Variant.BasePath = FSoftObjectPath(BasePath);
+		FFXUserParameterOverride& Override = Variant.Overrides.AddDefaulted_GetRef();
+		Override.ParameterName = TEXT("Intensity");
+		Override.FloatValue = Intensity;
+		return Variant;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFXSharedLibraryMergeTest, "FXAssetLib.SharedLibrary.Merge",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFXSharedLibraryMergeTest::RunTest(const FString& Parameters)
+{
+	using namespace FXSharedLibraryTestsPrivate;
+
+	const FName Fire(TEXT("Fire"));
+	const FName Smoke(TEXT("Smoke"));
+	const FName Water(TEXT("Water"));
+	const FName Spark(TEXT("Spark"));
+	const FName Ice(TEXT("Ice"));
+	const TCHAR* AssetA = TEXT("/Game/FXLib/NS_A.NS_A");
+	const TCHAR* AssetB = TEXT("/Game/FXLib/NS_B.NS_B");
+	const TCHAR* AssetC = TEXT("/Game/FXLib/NS_C.NS_C");
+	const TCHAR* AssetD = TEXT("/Game/FXLib/NS_D.NS_D");
+	const TCHAR* AssetE = TEXT("/Game/FXLib/NS_E.NS_E");
+
+	TArray<FFXCategoryData> Base;
+	Base.Add(MakeCategory(Fire, { AssetA, AssetB, AssetC }));
+	Base.Add(MakeCategory(Smoke, { AssetA }));
+	Base.Add(MakeCategory(Water, { AssetA }));
+	Base.Add(MakeCategory(Spark, { AssetA }));
+	Base[0].Variants.Add(MakeVariant(AssetA, 1.0f));
+	Base[0].Assets.Add(Base[0].Variants[0].GetEntryPath());
+
+	// 우리: Fire에서 B 제거 + D 추가, Smoke 삭제(상대 수정 없음), Water 삭제(상대가 수정)
+	TArray<FFXCategoryData> Ours;
+	Ours.Add(MakeCategory(Fire, { AssetA, AssetC, AssetD }));
+	Ours[0].Variants = Base[0].Variants;
+	Ours[0].Assets.Add(Base[0].Variants[0].GetEntryPath());
+	Ours.Add(MakeCategory(Spark, { AssetA }));
+
+	// 상대: Fire에서 C 제거 + E 추가 + 변형 값 변경, Water에 항목 추가, Spark 삭제(우리 수정 없음), Ice 추가
+	TArray<FFXCategoryData> Theirs;
+	Theirs.Add(MakeCategory(Fire, { AssetA, AssetB, AssetE }));
+	Theirs[0].Variants.Add(MakeVariant(AssetA, 2.0f));
+	Theirs[0].Assets.Add(Theirs[0].Variants[0].GetEntryPath());
+	Theirs.Add(MakeCategory(Smoke, { AssetA }));
+	Theirs.Add(MakeCategory(Water, { AssetA, AssetB }));
+	Theirs.Add(MakeCategory(Ice, { AssetE }));
+
+	TArray<FFXCategoryData> Merged;
+	FFXSharedLibrary::MergeCategories(Base, Ours, Theirs, Merged);
+
+	const FFXCategoryData* MergedFire = FindCategoryData(Merged, Fire);
+	if (TestNotNull(TEXT("Fire kept"), MergedFire))
+	{
+		// 양쪽 삭제는 모두 반영, 양쪽 추가는 모두 유지 (우리 순서 뒤에 상대 추가분)
+		TArray<FSoftObjectPath> ExpectedAssets = { FSoftObjectPath(AssetA), FSoftObjectPath(AssetD), Base[0].Variants[0].GetEntryPath(), FSoftObjectPath(AssetE) };
+		TestEqual(TEXT("Fire assets merged per entry"), MergedFire->Assets, ExpectedAssets);
+
+		// 우리가 바꾸지 않은 변형은 상대 값
+		TestEqual(TEXT("Fire variant count"), MergedFire->Variants.Num(), 1);
+		if (MergedFire->Variants.Num() == 1 && MergedFire->Variants[0].Overrides.Num() == 1)
+		{
+			TestEqual(TEXT("Their variant change merged"), MergedFire->Variants[0].Overrides[0].FloatValue, 2.0f);
+		}
+	}
+
+	TestNull(TEXT("Our unopposed category delete applied"), FindCategoryData(Merged, Smoke));
+	TestNull(TEXT("Their unopposed category delete applied"), FindCategoryData(Merged, Spark));
+
+	const FFXCategoryData* MergedWater = FindCategoryData(Merged, Water);
+	if (TestNotNull(TEXT("Category deleted by us but modified by them is kept"), MergedWater))
+	{
+		TestEqual(TEXT("Their modification kept"), MergedWater->Assets.Num(), 2);
+	}
+	TestNotNull(TEXT("Their new category added"), FindCategoryData(Merged, Ice));
+	TestEqual(TEXT("Merged category count"), Merged.Num(), 3);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
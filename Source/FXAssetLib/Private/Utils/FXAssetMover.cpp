@@ -9,8 +9,14 @@
 #include "ObjectTools.h"
 #include "Utils/FXAssetOrganizer.h"
 #include "Utils/FXAssetReferenceCollector.h"
+#include "Utils/FXMaterialDeduplicator.h"
+#include "Utils/FXEffectFeatureExtractor.h"
+#include "Model/FXSimilarityIndex.h"
+#include "FXLibrarySettings.h"
+#include "Core/FXAssetLibConstants.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Package.h"
+#include "UObject/MetaData.h"
 #include "Engine/Engine.h"
 #include "Serialization/ArchiveReplaceObjectRef.h"
 #include "UObject/SavePackage.h"
@@ -52,14 +58,6 @@ FSoftObjectPath FXAssetMover::CopyAssetWithNewName(
 		return FSoftObjectPath();
 	}
 
-	// 대상 경로 생성
-	FString DestinationPath = DestinationFolderPath;
-	if (!DestinationPath.EndsWith(TEXT("/")))
-	{
-		DestinationPath += TEXT("/");
-	}
-	DestinationPath += NewAssetName;
-
 	// 폴더 생성
 	if (!FXAssetOrganizer::CreateFolderPath(DestinationFolderPath))
 	{
@@ -72,12 +70,16 @@ FSoftObjectPath FXAssetMover::CopyAssetWithNewName(
 	if (DuplicatedAsset)
 	{
 		FSoftObjectPath CopiedPath(DuplicatedAsset);
+		GetMutableRegistrationStats().CopiedPackages++;
+
+		// 복사 원본 기록 (같은 원본 재사용 판단용, 패키지 저장 시 레지스트리 태그로 기록됨)
+		DuplicatedAsset->GetPackage()->GetMetaData()->SetValue(DuplicatedAsset, FFXAssetLibConstants::SourceMetadataTag, *SourceAssetPath.ToString());
 		UE_LOG(LogTemp, Log, TEXT("Successfully copied asset: %s -> %s"), 
 			*SourceAssetPath.ToString(), *CopiedPath.ToString());
 		return CopiedPath;
 	}
 
-	UE_LOG(LogTemp, Error, TEXT("Failed to copy asset: %s to %s"), *SourceAssetPath.ToString(), *DestinationPath);
+	UE_LOG(LogTemp, Error, TEXT("Failed to copy asset: %s to %s/%s"), *SourceAssetPath.ToString(), *DestinationFolderPath, *NewAssetName);
 	return FSoftObjectPath();
 }
 
@@ -112,10 +114,15 @@ FSoftObjectPath FXAssetMover::CopyAssetWithReferences(
 	const FSoftObjectPath& SourceAssetPath,
 	const FString& DestinationFolderPath,
 	const FString& NewAssetName,
-	const FString& RootPath)
+	const FString& RootPath,
+	TMap<FSoftObjectPath, FSoftObjectPath>* OutReferenceMap)
 {
+	// 등록 단위 통계 초기화
+	FFXRegistrationStats& Stats = GetMutableRegistrationStats();
+	Stats.Reset();
+
 	// 1. 먼저 참조된 에셋들을 수집
-	TArray<FReferencedAsset> ReferencedAssets = FFXAssetReferenceCollector::CollectAllReferences(SourceAssetPath);
+	FReferencedAssetArray ReferencedAssets = FFXAssetReferenceCollector::CollectAllReferences(SourceAssetPath, &Stats);
 	
 	// 2. 참조된 에셋들을 재귀적으로 복사
 	TSet<FSoftObjectPath> ProcessedAssets;
@@ -137,32 +144,48 @@ FSoftObjectPath FXAssetMover::CopyAssetWithReferences(
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Failed to update references for copied asset: %s"), *CopiedAssetPath.ToString());
 	}
+
+	if (OutReferenceMap)
+	{
+		*OutReferenceMap = MoveTemp(ReferenceMap);
+	}
 	
 	return CopiedAssetPath;
 }
 
 FSoftObjectPath FXAssetMover::FindExistingAsset(
-	const FString& DestinationFolder,
-	const FString& AssetName)
+	FName DestinationFolder,
+	FName AssetName)
 {
-	// Asset Registry 모듈 가져오기
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+	if (DestinationFolder.IsNone() || AssetName.IsNone())
+	{
+		return FSoftObjectPath();
+	}
 
-	// 대상 폴더의 모든 에셋 검색
-	TArray<FAssetData> AssetsInFolder;
-	AssetRegistry.GetAssetsByPath(*DestinationFolder, AssetsInFolder, true);
+	// 패키지 이름을 스택 버퍼로 구성 (예: /Game/FXLib/Textures/T_Smoke)
+	FNameBuilder PackageNameBuilder(DestinationFolder);
+	if (!PackageNameBuilder.ToView().EndsWith(TEXT('/')))
+	{
+		PackageNameBuilder << TEXT('/');
+	}
+	PackageNameBuilder << AssetName;
 
-	// 같은 이름의 에셋 찾기
-	for (const FAssetData& AssetData : AssetsInFolder)
+	// 이름 테이블에 없는 패키지 이름이면 에셋도 존재하지 않음
+	const FName PackageName(PackageNameBuilder.ToView(), FNAME_Find);
+	if (PackageName.IsNone())
 	{
-		if (AssetData.AssetName.ToString() == AssetName)
-		{
-			return AssetData.ToSoftObjectPath();
-		}
+		return FSoftObjectPath();
 	}
 
-	return FSoftObjectPath();
+	// Asset Registry 모듈 가져오기
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	// 폴더 전체를 나열하지 않고 Package.Asset 경로로 직접 조회
+	FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(FTopLevelAssetPath(PackageName, AssetName)));
+	GetMutableRegistrationStats().RegistryQueries++;
+
+	return AssetData.IsValid() ? AssetData.ToSoftObjectPath() : FSoftObjectPath();
 }
 
 bool FXAssetMover::CheckIfSameSourceAsset(
@@ -173,36 +196,38 @@ bool FXAssetMover::CheckIfSameSourceAsset(
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-	// 두 에셋의 FAssetData 가져오기
-	FAssetData SourceAssetData = AssetRegistry.GetAssetByObjectPath(*SourceAssetPath.ToString());
-	FAssetData ExistingAssetData = AssetRegistry.GetAssetByObjectPath(*ExistingAssetPath.ToString());
+	// 기존 에셋의 태그만 필요하므로 한 번만 조회 (로드 없음)
+	FAssetData ExistingAssetData = AssetRegistry.GetAssetByObjectPath(ExistingAssetPath);
+	GetMutableRegistrationStats().RegistryQueries++;
 
-	if (!SourceAssetData.IsValid() || !ExistingAssetData.IsValid())
+	if (!ExistingAssetData.IsValid())
 	{
 		return false;
 	}
 
-	// 원본 경로가 같으면 같은 에셋으로 간주
-	// (실제로는 복사 시 원본 경로를 Asset UserData나 Tag로 저장하고 비교하는 것이 더 정확함)
-	// 현재는 원본 경로가 같은지 확인
+	// 원본 자체이면 같은 에셋으로 간주
 	if (SourceAssetPath == ExistingAssetPath)
 	{
 		return true;
 	}
 
-	// 원본 경로가 다르면 다른 에셋으로 간주
-	// 하지만 실제로는 같은 원본에서 복사했을 수도 있으므로,
-	// 더 정확한 방법은 복사 시 원본 경로를 메타데이터로 저장하고 비교하는 것
-	// 여기서는 일단 false 반환 (다른 에셋으로 처리하여 넘버링 추가)
-	return false;
+	// 복사 시 기록한 원본 경로(FXLib.Source)가 같으면 같은 원본의 복사본
+	// 태그가 없는 이전 복사본은 다른 에셋으로 처리하여 넘버링 추가
+	FString RecordedSource;
+	return ExistingAssetData.GetTagValue(FFXAssetLibConstants::SourceMetadataTag, RecordedSource)
+		&& FSoftObjectPath(RecordedSource) == SourceAssetPath;
 }
 
 void FXAssetMover::CopyReferencedAssetsRecursive(
-	const TArray<FReferencedAsset>& ReferencedAssets,
+	const FReferencedAssetArray& ReferencedAssets,
 	const FString& RootPath,
 	TSet<FSoftObjectPath>& ProcessedAssets,
 	TMap<FSoftObjectPath, FSoftObjectPath>& ReferenceMap)
 {
+	static const FName MaterialTypeName(TEXT("Material"));
+	const bool bCollapseMasterMaterials = GetDefault<UFXLibrarySettings>()->bCollapseEquivalentMasterMaterials;
+	FFXRegistrationStats& Stats = GetMutableRegistrationStats();
+
 	for (const FReferencedAsset& RefAsset : ReferencedAssets)
 	{
 		// 이미 처리된 에셋은 스킵
@@ -212,12 +237,37 @@ void FXAssetMover::CopyReferencedAssetsRecursive(
 		}
 		
 		ProcessedAssets.Add(RefAsset.AssetPath);
+
+		const bool bIsMasterMaterial = RefAsset.AssetType == MaterialTypeName;
+		bool bNestedReferencesProcessed = false;
+
+		// 그래프가 동일한 라이브러리 마스터가 있으면 복사하지 않고 재사용
+		if (bCollapseMasterMaterials && bIsMasterMaterial)
+		{
+			// 마스터가 참조하는 텍스처 등을 먼저 처리하여 라이브러리 복사본 경로 기준으로 비교
+			// (같은 원본의 복사본은 재사용되므로 동일한 마스터라면 새로 복사되는 에셋 없음)
+			FReferencedAssetArray NestedReferences = FFXAssetReferenceCollector::CollectAllReferences(RefAsset.AssetPath, &Stats);
+			if (NestedReferences.Num() > 0)
+			{
+				CopyReferencedAssetsRecursive(NestedReferences, RootPath, ProcessedAssets, ReferenceMap);
+			}
+			bNestedReferencesProcessed = true;
+
+			FSoftObjectPath EquivalentMasterPath = FXMaterialDeduplicator::FindEquivalentMaster(RefAsset.AssetPath, RootPath, ReferenceMap);
+			if (EquivalentMasterPath.IsValid())
+			{
+				ReferenceMap.Add(RefAsset.AssetPath, EquivalentMasterPath);
+				UE_LOG(LogTemp, Verbose, TEXT("Collapsed master material onto equivalent library master: %s -> %s"),
+					*RefAsset.AssetPath.ToString(), *EquivalentMasterPath.ToString());
+				continue;
+			}
+		}
 		
 		// 에셋 타입에 따라 폴더 경로 결정
-		FString DestinationFolder = FXAssetOrganizer::GetFolderPathForAssetType(RootPath, TEXT(""), RefAsset.AssetType);
+		const FName DestinationFolder = GetDestinationFolder(RootPath, RefAsset.AssetType);
 		
 		// 원본 에셋 이름 추출
-		FString AssetName = RefAsset.AssetPath.GetAssetName();
+		const FName AssetName = RefAsset.AssetPath.GetAssetFName();
 		
 		// 중복 체크: 같은 이름의 에셋이 이미 존재하는지 확인
 		FSoftObjectPath ExistingAssetPath = FindExistingAsset(DestinationFolder, AssetName);
@@ -230,40 +280,42 @@ void FXAssetMover::CopyReferencedAssetsRecursive(
 			{
 				// 같은 에셋이면 기존 에셋 재사용
 				CopiedPath = ExistingAssetPath;
-				UE_LOG(LogTemp, Log, TEXT("Reusing existing asset (same source): %s -> %s (Type: %s)"), 
-					*RefAsset.AssetPath.ToString(), *CopiedPath.ToString(), *RefAsset.AssetType);
+				UE_LOG(LogTemp, Verbose, TEXT("Reusing existing asset (same source): %s -> %s (Type: %s)"), 
+					*RefAsset.AssetPath.ToString(), *CopiedPath.ToString(), *RefAsset.AssetType.ToString());
 			}
 			else
 			{
-				// 다른 에셋이면 넘버링 추가
+				// 다른 에셋이면 넘버링 추가 (후보 이름은 스택 버퍼에서 구성)
 				int32 Counter = 1;
-				FString NewAssetName;
+				FNameBuilder NewAssetName;
 				FSoftObjectPath TestPath;
 				
 				do
 				{
-					NewAssetName = FString::Printf(TEXT("%s_%02d"), *AssetName, Counter);
-					TestPath = FindExistingAsset(DestinationFolder, NewAssetName);
+					NewAssetName.Reset();
+					NewAssetName << AssetName;
+					NewAssetName.Appendf(TEXT("_%02d"), Counter);
+					TestPath = FindExistingAsset(DestinationFolder, FName(NewAssetName.ToView(), FNAME_Find));
 					Counter++;
 				} while (TestPath.IsValid() && Counter < 100); // 최대 99까지 시도
 				
 				// 새 이름으로 복사
-				CopiedPath = CopyAssetWithNewName(RefAsset.AssetPath, DestinationFolder, NewAssetName);
+				CopiedPath = CopyAssetWithNewName(RefAsset.AssetPath, DestinationFolder.ToString(), FString(NewAssetName.ToView()));
 				if (CopiedPath.IsValid())
 				{
-					UE_LOG(LogTemp, Log, TEXT("Copied referenced asset with numbering: %s -> %s (Type: %s)"), 
-						*RefAsset.AssetPath.ToString(), *CopiedPath.ToString(), *RefAsset.AssetType);
+					UE_LOG(LogTemp, Verbose, TEXT("Copied referenced asset with numbering: %s -> %s (Type: %s)"), 
+						*RefAsset.AssetPath.ToString(), *CopiedPath.ToString(), *RefAsset.AssetType.ToString());
 				}
 			}
 		}
 		else
 		{
 			// 기존 에셋이 없으면 그대로 복사
-			CopiedPath = CopyAssetWithNewName(RefAsset.AssetPath, DestinationFolder, AssetName);
+			CopiedPath = CopyAssetWithNewName(RefAsset.AssetPath, DestinationFolder.ToString(), AssetName.ToString());
 			if (CopiedPath.IsValid())
 			{
-				UE_LOG(LogTemp, Log, TEXT("Copied referenced asset: %s -> %s (Type: %s)"), 
-					*RefAsset.AssetPath.ToString(), *CopiedPath.ToString(), *RefAsset.AssetType);
+				UE_LOG(LogTemp, Verbose, TEXT("Copied referenced asset: %s -> %s (Type: %s)"), 
+					*RefAsset.AssetPath.ToString(), *CopiedPath.ToString(), *RefAsset.AssetType.ToString());
 			}
 		}
 		
@@ -272,15 +324,24 @@ void FXAssetMover::CopyReferencedAssetsRecursive(
 			// 참조 맵에 추가
 			ReferenceMap.Add(RefAsset.AssetPath, CopiedPath);
 			
-			// 복사된 에셋의 참조도 재귀적으로 처리
-			TArray<FReferencedAsset> NestedReferences = FFXAssetReferenceCollector::CollectAllReferences(RefAsset.AssetPath);
-			if (NestedReferences.Num() > 0)
+			// 복사된 에셋의 참조도 재귀적으로 처리 (마스터 비교 때 이미 처리했으면 스킵)
+			if (!bNestedReferencesProcessed)
 			{
-				CopyReferencedAssetsRecursive(NestedReferences, RootPath, ProcessedAssets, ReferenceMap);
+				FReferencedAssetArray NestedReferences = FFXAssetReferenceCollector::CollectAllReferences(RefAsset.AssetPath, &Stats);
+				if (NestedReferences.Num() > 0)
+				{
+					CopyReferencedAssetsRecursive(NestedReferences, RootPath, ProcessedAssets, ReferenceMap);
+				}
 			}
 			
 			// 복사된 에셋의 참조도 업데이트
 			UpdateAssetReferences(CopiedPath, ReferenceMap);
+
+			// 새 라이브러리 마스터를 이후 등록의 재사용 대상으로 인덱싱
+			if (bCollapseMasterMaterials && bIsMasterMaterial)
+			{
+				FXMaterialDeduplicator::RegisterMaster(CopiedPath, RootPath);
+			}
 		}
 		else
 		{
@@ -289,6 +350,102 @@ void FXAssetMover::CopyReferencedAssetsRecursive(
 	}
 }
 
+FName FXAssetMover::GetDestinationFolder(const FString& RootPath, FName AssetType)
+{
+	// (루트 경로, 에셋 타입) -> 대상 폴더 (게임 스레드 전용 캐시)
+	static TMap<TPair<FName, FName>, FName> FolderCache;
+
+	const TPair<FName, FName> CacheKey(FName(RootPath), AssetType);
+	if (const FName* CachedFolder = FolderCache.Find(CacheKey))
+	{
+		return *CachedFolder;
+	}
+
+	const FString FolderPath = FXAssetOrganizer::GetFolderPathForAssetType(RootPath, TEXT(""), AssetType.ToString());
+	return FolderCache.Add(CacheKey, FName(FolderPath));
+}
+
+void FXAssetMover::RegisterLibraryMetadataTags()
+{
+	TSet<FName>& RegistryTags = UMetaData::GetMetaDataTagsForAssetRegistry();
+	RegistryTags.Add(FFXAssetLibConstants::CategoryMetadataTag);
+	RegistryTags.Add(FFXAssetLibConstants::HashtagsMetadataTag);
+	RegistryTags.Add(FFXAssetLibConstants::SourceMetadataTag);
+	RegistryTags.Add(FFXAssetLibConstants::FeaturesMetadataTag);
+	RegistryTags.Add(FFXAssetLibConstants::TiersMetadataTag);
+	RegistryTags.Add(FFXAssetLibConstants::GraphHashMetadataTag);
+}
+
+bool FXAssetMover::WriteLibraryMetadata(
+	const FSoftObjectPath& AssetPath,
+	FName CategoryName,
+	const FString& Hashtags)
+{
+	UObject* Asset = AssetPath.TryLoad();
+	if (!Asset)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to load asset for library metadata: %s"), *AssetPath.ToString());
+		return false;
+	}
+
+	UMetaData* MetaData = Asset->GetPackage()->GetMetaData();
+	MetaData->SetValue(Asset, FFXAssetLibConstants::CategoryMetadataTag, *CategoryName.ToString());
+
+	const FString NormalizedHashtags = NormalizeHashtags(Hashtags);
+	if (NormalizedHashtags.IsEmpty())
+	{
+		MetaData->RemoveValue(Asset, FFXAssetLibConstants::HashtagsMetadataTag);
+	}
+	else
+	{
+		MetaData->SetValue(Asset, FFXAssetLibConstants::HashtagsMetadataTag, *NormalizedHashtags);
+	}
+
+	// 유사 이펙트 특징 (이미 로드된 김에 계산하여 태그로 캐시, 라이브러리는 로드 없이 읽음)
+	FFXEffectFeatures Features;
+	if (FXEffectFeatureExtractor::ExtractFeatures(Cast<UNiagaraSystem>(Asset), Features))
+	{
+		MetaData->SetValue(Asset, FFXAssetLibConstants::FeaturesMetadataTag, *Features.ToTagString());
+	}
+
+	// 저장해야 디스크의 레지스트리 태그에 반영됨
+	return SaveAssetPackage(Asset);
+}
+
+FString FXAssetMover::NormalizeHashtags(const FString& Hashtags)
+{
+	static const TCHAR* Delimiters[] = { TEXT(" "), TEXT(","), TEXT(";"), TEXT("\t") };
+
+	TArray<FString> Tokens;
+	Hashtags.ParseIntoArray(Tokens, Delimiters, UE_ARRAY_COUNT(Delimiters));
+
+	// 대소문자 구분 없이 중복 제거 (입력 순서 유지)
+	TArray<FString> Normalized;
+	Normalized.Reserve(Tokens.Num());
+	for (FString& Token : Tokens)
+	{
+		Token.TrimCharInline(TEXT('#'), nullptr);
+		Token.ToLowerInline();
+		if (!Token.IsEmpty())
+		{
+			Normalized.AddUnique(Token);
+		}
+	}
+
+	return FString::Join(Normalized, TEXT(","));
+}
+
+const FFXRegistrationStats& FXAssetMover::GetLastRegistrationStats()
+{
+	return GetMutableRegistrationStats();
+}
+
+FFXRegistrationStats& FXAssetMover::GetMutableRegistrationStats()
+{
+	static FFXRegistrationStats RegistrationStats;
+	return RegistrationStats;
+}
+
 bool FXAssetMover::UpdateAssetReferences(
 	const FSoftObjectPath& AssetPath,
 	const TMap<FSoftObjectPath, FSoftObjectPath>& ReferenceMap)
@@ -423,6 +580,36 @@ bool FXAssetMover::UpdateAssetReferences(
 	return true;
 }
 
+bool FXAssetMover::SaveAssetPackage(UObject* Asset)
+{
+	if (!Asset)
+	{
+		return false;
+	}
+
+	Asset->MarkPackageDirty();
+
+	UPackage* Package = Asset->GetOutermost();
+	if (!Package)
+	{
+		return false;
+	}
+
+	FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+	// FSavePackageArgs를 사용하여 패키지 저장
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+
+	if (!UPackage::SavePackage(Package, Asset, *PackageFileName, SaveArgs))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to save asset package: %s"), *Package->GetName());
+		return false;
+	}
+
+	return true;
+}
+
 bool FXAssetMover::UpdateNiagaraAssetReferences(
 	UNiagaraSystem* NiagaraSystem,
 	const TMap<FSoftObjectPath, FSoftObjectPath>& ReferenceMap)
@@ -591,6 +778,73 @@ bool FXAssetMover::UpdateNiagaraAssetReferences(
 	return true;
 }
 
+void FXAssetMover::CollectMaterialExpressions(
+	UMaterial* Material,
+	TArray<UMaterialExpression*, TInlineAllocator<64>>& OutExpressions)
+{
+	if (!Material)
+	{
+		return;
+	}
+
+	// UE5 방식 - ExpressionCollection 을 Property reflection으로 접근
+	// 실패하면 Expressions 배열 직접 접근
+	FStructProperty* ExpressionCollectionProp = FindFProperty<FStructProperty>(Material->GetClass(), TEXT("ExpressionCollection"));
+	if (ExpressionCollectionProp)
+	{
+		void* CollectionPtr = ExpressionCollectionProp->ContainerPtrToValuePtr<void>(Material);
+		FArrayProperty* ExpressionsArrayProp = FindFProperty<FArrayProperty>(ExpressionCollectionProp->Struct, TEXT("Expressions"));
+		if (ExpressionsArrayProp && CollectionPtr)
+		{
+			FScriptArrayHelper ArrayHelper(ExpressionsArrayProp, ExpressionsArrayProp->ContainerPtrToValuePtr<void>(CollectionPtr));
+			for (int32 i = 0; i < ArrayHelper.Num(); ++i)
+			{
+				FObjectProperty* ExpressionProp = CastField<FObjectProperty>(ExpressionsArrayProp->Inner);
+				if (ExpressionProp)
+				{
+					UObject** ExpressionPtr = reinterpret_cast<UObject**>(ArrayHelper.GetRawPtr(i));
+					if (UMaterialExpression* Expression = Cast<UMaterialExpression>(*ExpressionPtr))
+					{
+						OutExpressions.Add(Expression);
+					}
+				}
+			}
+		}
+	}
+	
+	// 위 방법이 실패한 경우 직접 Expressions 배열 접근 시도
+	if (OutExpressions.Num() == 0)
+	{
+		FArrayProperty* ExpressionsProp = FindFProperty<FArrayProperty>(Material->GetClass(), TEXT("Expressions"));
+		// UE4 호환 코드 (주석 처리)
+		// if (!ExpressionsProp)
+		// {
+		// 	ExpressionsProp = FindField<FArrayProperty>(Material->GetClass(), TEXT("Expressions"));
+		// }
+		if (ExpressionsProp)
+		{
+			FScriptArrayHelper ArrayHelper(ExpressionsProp, ExpressionsProp->ContainerPtrToValuePtr<void>(Material));
+			for (int32 i = 0; i < ArrayHelper.Num(); ++i)
+			{
+				FObjectProperty* ExpressionProp = CastField<FObjectProperty>(ExpressionsProp->Inner);
+				// UE4 호환 코드 (주석 처리)
+				// if (!ExpressionProp)
+				// {
+				// 	ExpressionProp = CastField<UObjectProperty>(ExpressionsProp->Inner);
+				// }
+				if (ExpressionProp)
+				{
+					UObject** ExpressionPtr = reinterpret_cast<UObject**>(ArrayHelper.GetRawPtr(i));
+					if (UMaterialExpression* Expression = Cast<UMaterialExpression>(*ExpressionPtr))
+					{
+						OutExpressions.Add(Expression);
+					}
+				}
+			}
+		}
+	}
+}
+
 bool FXAssetMover::UpdateMaterialAssetReferences(
 	UMaterialInterface* MaterialInterface,
 	const TMap<FSoftObjectPath, FSoftObjectPath>& ReferenceMap)
@@ -627,31 +881,28 @@ bool FXAssetMover::UpdateMaterialAssetReferences(
 		BaseMaterial = nullptr; // Material Function은 별도 처리
 	}
 
-	if (!BaseMaterial)
+	// Material Instance의 경우 Parent Material 참조 업데이트
+	// (복사된 마스터 또는 그래프가 동일한 기존 라이브러리 마스터로 재부모화)
+	if (MaterialInstance)
 	{
-		// Material Instance의 경우 Parent Material 참조 업데이트
-		if (MaterialInstance)
+		UMaterialInterface* ParentMaterial = MaterialInstance->Parent;
+		if (ParentMaterial)
 		{
-			UMaterialInterface* ParentMaterial = MaterialInstance->Parent;
-			if (ParentMaterial)
+			FSoftObjectPath ParentPath(ParentMaterial);
+			if (const FSoftObjectPath* NewParentPath = ReferenceMap.Find(ParentPath))
 			{
-				FSoftObjectPath ParentPath(ParentMaterial);
-				if (const FSoftObjectPath* NewParentPath = ReferenceMap.Find(ParentPath))
+				UMaterialInterface* NewParent = Cast<UMaterialInterface>(NewParentPath->TryLoad());
+				if (NewParent && ParentMaterial != NewParent)
 				{
-					UMaterialInterface* NewParent = Cast<UMaterialInterface>(NewParentPath->TryLoad());
-					if (NewParent && ParentMaterial != NewParent)
-					{
-						MaterialInstance->Parent = NewParent;
-						bHasChanges = true;
-						UE_LOG(LogTemp, Verbose, TEXT("Updated Material Instance Parent: %s -> %s"),
-							*ParentPath.ToString(), *NewParentPath->ToString());
-					}
+					MaterialInstance->SetParentEditorOnly(NewParent);
+					MaterialInstance->PostEditChange();
+					BaseMaterial = MaterialInstance->GetBaseMaterial();
+					bHasChanges = true;
+					UE_LOG(LogTemp, Verbose, TEXT("Updated Material Instance Parent: %s -> %s"),
+						*ParentPath.ToString(), *NewParentPath->ToString());
 				}
 			}
 		}
-
-		// Material이 없으면 일반 Property reflection으로 처리
-		// (아래 일반 로직으로 처리됨)
 	}
 	
 	// Material Function의 Expressions 처리
@@ -660,65 +911,8 @@ bool FXAssetMover::UpdateMaterialAssetReferences(
 	if (BaseMaterial)
 	{
 		// 1. Material Expression들을 순회하여 참조 찾기
-		// UE5에서는 GetExpressionCollection()을 통해 접근 시도
-		// 실패하면 Property reflection 사용
-		TArray<UMaterialExpression*> Expressions;
-		
-		// UE5 방식 - GetExpressionCollection() 메서드를 통해 접근
-		FStructProperty* ExpressionCollectionProp = FindFProperty<FStructProperty>(BaseMaterial->GetClass(), TEXT("ExpressionCollection"));
-		if (ExpressionCollectionProp)
-		{
-			void* CollectionPtr = ExpressionCollectionProp->ContainerPtrToValuePtr<void>(BaseMaterial);
-			FArrayProperty* ExpressionsArrayProp = FindFProperty<FArrayProperty>(ExpressionCollectionProp->Struct, TEXT("Expressions"));
-			if (ExpressionsArrayProp && CollectionPtr)
-			{
-				FScriptArrayHelper ArrayHelper(ExpressionsArrayProp, ExpressionsArrayProp->ContainerPtrToValuePtr<void>(CollectionPtr));
-				for (int32 i = 0; i < ArrayHelper.Num(); ++i)
-				{
-					FObjectProperty* ExpressionProp = CastField<FObjectProperty>(ExpressionsArrayProp->Inner);
-					if (ExpressionProp)
-					{
-						UObject** ExpressionPtr = reinterpret_cast<UObject**>(ArrayHelper.GetRawPtr(i));
-						if (UMaterialExpression* Expression = Cast<UMaterialExpression>(*ExpressionPtr))
-						{
-							Expressions.Add(Expression);
-						}
-					}
-				}
-			}
-		}
-		
-		// 위 방법이 실패한 경우 직접 Expressions 배열 접근 시도
-		if (Expressions.Num() == 0)
-		{
-			FArrayProperty* ExpressionsProp = FindFProperty<FArrayProperty>(BaseMaterial->GetClass(), TEXT("Expressions"));
-			// UE4 호환 코드 (주석 처리)
-			// if (!ExpressionsProp)
-			// {
-			// 	ExpressionsProp = FindField<FArrayProperty>(BaseMaterial->GetClass(), TEXT("Expressions"));
-			// }
-			if (ExpressionsProp)
-			{
-				FScriptArrayHelper ArrayHelper(ExpressionsProp, ExpressionsProp->ContainerPtrToValuePtr<void>(BaseMaterial));
-				for (int32 i = 0; i < ArrayHelper.Num(); ++i)
-				{
-					FObjectProperty* ExpressionProp = CastField<FObjectProperty>(ExpressionsProp->Inner);
-					// UE4 호환 코드 (주석 처리)
-					// if (!ExpressionProp)
-					// {
-					// 	ExpressionProp = CastField<UObjectProperty>(ExpressionsProp->Inner);
-					// }
-					if (ExpressionProp)
-					{
-						UObject** ExpressionPtr = reinterpret_cast<UObject**>(ArrayHelper.GetRawPtr(i));
-						if (UMaterialExpression* Expression = Cast<UMaterialExpression>(*ExpressionPtr))
-						{
-							Expressions.Add(Expression);
-						}
-					}
-				}
-			}
-		}
+		TArray<UMaterialExpression*, TInlineAllocator<64>> Expressions;
+		CollectMaterialExpressions(BaseMaterial, Expressions);
 		
 		for (UMaterialExpression* Expression : Expressions)
 		{
@@ -127,6 +127,11 @@ FString FXAssetOrganizer::AssetTypeToFolderName(const FString& AssetType)
 	{
 		return TEXT("NiagaraScripts");
 	}
+	// 공유 이미터 (라이브러리 시스템들이 부모로 참조)
+	else if (AssetType == "NiagaraEmitter")
+	{
+		return TEXT("Emitters");
+	}
 	
 	// 기본값: 에셋 타입 이름 그대로 사용
 	return AssetType;
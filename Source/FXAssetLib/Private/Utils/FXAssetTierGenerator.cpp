@@ -0,0 +1,244 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Utils/FXAssetTierGenerator.h"
+#include "Utils/FXAssetMover.h"
+#include "FXLibrarySettings.h"
+#include "Core/FXAssetLibConstants.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Modules/ModuleManager.h"
+#include "Misc/Paths.h"
+#include "Misc/PackageName.h"
+#include "UObject/MetaData.h"
+#include "UObject/Package.h"
+#include "NiagaraSystem.h"
+#include "NiagaraEmitter.h"
+#include "NiagaraEmitterHandle.h"
+
+TArray<FSoftObjectPath> FXAssetTierGenerator::GenerateCostTiers(
+	const FSoftObjectPath& BaseAssetPath,
+	const FString& DestinationFolderPath,
+	const TArray<FFXCostTierSettings>& Tiers)
+{
+	TArray<FSoftObjectPath> TierAssets;
+	TArray<TPair<FName, FSoftObjectPath>> TierLinks;
+	const FString BaseAssetName = BaseAssetPath.GetAssetName();
+
+	for (const FFXCostTierSettings& Tier : Tiers)
+	{
+		if (Tier.TierName.IsNone())
+		{
+			continue;
+		}
+
+		const FString TierAssetName = MakeTierAssetName(BaseAssetName, Tier.TierName);
+
+		// 1. 기본 복사본에서 변형 복사 (참조가 이미 라이브러리 에셋을 가리키므로 참조 갱신 불필요)
+		FSoftObjectPath TierAssetPath = FXAssetMover::CopyAssetWithNewName(BaseAssetPath, DestinationFolderPath, TierAssetName);
+		if (!TierAssetPath.IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to create cost tier variant: %s"), *TierAssetName);
+			continue;
+		}
+
+		// 2. 티어 스케일 적용 후 저장
+		UNiagaraSystem* TierSystem = Cast<UNiagaraSystem>(TierAssetPath.TryLoad());
+		if (TierSystem && ApplyTierToSystem(TierSystem, Tier))
+		{
+			FXAssetMover::SaveAssetPackage(TierSystem);
+		}
+
+		TierAssets.Add(TierAssetPath);
+		TierLinks.Emplace(Tier.TierName, TierAssetPath);
+		UE_LOG(LogTemp, Log, TEXT("Generated cost tier variant: %s (Spawn x%.2f, Particles x%.2f)"),
+			*TierAssetPath.ToString(), Tier.SpawnCountScale, Tier.MaxParticleScale);
+	}
+
+	// 3. 기본 복사본에 변형 연결 기록 (메타데이터는 에셋과 함께 이동하므로 기본 복사본 이름이 바뀌어도 유지)
+	if (TierLinks.Num() > 0)
+	{
+		if (UObject* BaseAsset = BaseAssetPath.TryLoad())
+		{
+			BaseAsset->GetPackage()->GetMetaData()->SetValue(BaseAsset, FFXAssetLibConstants::TiersMetadataTag, *MakeTierTagString(TierLinks));
+			FXAssetMover::SaveAssetPackage(BaseAsset);
+		}
+	}
+
+	return TierAssets;
+}
+
+FSoftObjectPath FXAssetTierGenerator::FindTierVariant(const FSoftObjectPath& BaseAssetPath, FName TierName)
+{
+	if (!BaseAssetPath.IsValid() || TierName.IsNone())
+	{
+		return FSoftObjectPath();
+	}
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	const FSoftObjectPath BasePath = BaseAssetPath.GetWithoutSubPath();
+	const FAssetData BaseAssetData = AssetRegistry.GetAssetByObjectPath(BasePath);
+	if (!BaseAssetData.IsValid())
+	{
+		return FSoftObjectPath();
+	}
+
+	FSoftObjectPath TierAssetPath;
+	FString TiersText;
+	if (BaseAssetData.GetTagValue(FFXAssetLibConstants::TiersMetadataTag, TiersText))
+	{
+		TierAssetPath = FindTierInTagString(TiersText, TierName);
+	}
+	else
+	{
+		// 태그 기록 전에 생성된 변형: 같은 폴더의 BaseName_TierName 패키지
+		const FString TierAssetName = MakeTierAssetName(BasePath.GetAssetName(), TierName);
+		const FString TierPackageName = FPaths::GetPath(BasePath.GetLongPackageName()) / TierAssetName;
+		TierAssetPath = FSoftObjectPath(FTopLevelAssetPath(*TierPackageName, *TierAssetName));
+	}
+
+	if (!TierAssetPath.IsValid())
+	{
+		return FSoftObjectPath();
+	}
+
+	// 변형이 이동/이름 변경되었으면 원래 경로의 리다이렉터를 따라감 (리다이렉터 체인 포함)
+	FAssetData TierAssetData = AssetRegistry.GetAssetByObjectPath(TierAssetPath);
+	for (int32 Depth = 0; TierAssetData.IsValid() && TierAssetData.IsRedirector() && Depth < 8; ++Depth)
+	{
+		FString DestinationObject;
+		if (!TierAssetData.GetTagValue(TEXT("DestinationObject"), DestinationObject))
+		{
+			return FSoftObjectPath();
+		}
+
+		TierAssetPath = FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(DestinationObject));
+		TierAssetData = AssetRegistry.GetAssetByObjectPath(TierAssetPath);
+	}
+
+	if (!TierAssetData.IsValid() || TierAssetData.IsRedirector())
+	{
+		return FSoftObjectPath();
+	}
+
+	return TierAssetPath;
+}
+
+bool FXAssetTierGenerator::ApplyTierToSystem(UNiagaraSystem* NiagaraSystem, const FFXCostTierSettings& Tier)
+{
+	if (!NiagaraSystem)
+	{
+		return false;
+	}
+
+	bool bHasChanges = false;
+
+	for (FNiagaraEmitterHandle& EmitterHandle : NiagaraSystem->GetEmitterHandles())
+	{
+		if (!EmitterHandle.IsValid())
+		{
+			continue;
+		}
+
+		// 1. 지정된 이미터 비활성화
+		const FString EmitterName = EmitterHandle.GetName().ToString();
+		const bool bDisable = Tier.DisabledEmitters.ContainsByPredicate([&EmitterName](const FString& Pattern)
+		{
+			return EmitterName.MatchesWildcard(Pattern);
+		});
+
+		if (bDisable)
+		{
+			if (EmitterHandle.GetIsEnabled())
+			{
+				EmitterHandle.SetIsEnabled(false, *NiagaraSystem, false);
+				bHasChanges = true;
+				UE_LOG(LogTemp, Verbose, TEXT("Disabled emitter for tier %s: %s"), *Tier.TierName.ToString(), *EmitterName);
+			}
+			continue;
+		}
+
+		FVersionedNiagaraEmitterData* EmitterData = EmitterHandle.GetEmitterData();
+		if (!EmitterData)
+		{
+			continue;
+		}
+
+		// 2. 스폰 레이트/버스트 카운트 스케일 (SpawnRate, SpawnBurst 모듈이 Emitter.SpawnCountScale을 사용)
+		if (!FMath::IsNearlyEqual(Tier.SpawnCountScale, 1.0f))
+		{
+			FNiagaraEmitterScalabilityOverride& Override = EmitterData->ScalabilityOverrides.Overrides.AddDefaulted_GetRef();
+			Override.bOverrideSpawnCountScale = true;
+			Override.bScaleSpawnCount = true;
+			Override.SpawnCountScale = Tier.SpawnCountScale;
+			bHasChanges = true;
+		}
+
+		// 3. 최대 파티클 수 제한 (FixedCount 할당은 PreAllocationCount를 넘는 파티클을 생성하지 않음)
+		if (!FMath::IsNearlyEqual(Tier.MaxParticleScale, 1.0f))
+		{
+			// 자동 추정 모드는 PreAllocationCount를 사용하지 않으므로 실행 기록의 최대 파티클 수 추정치를 기준으로 함
+			const int32 BaseParticleCount = EmitterData->AllocationMode == EParticleAllocationMode::AutomaticEstimate
+				? EmitterData->GetMaxParticleCountEstimate()
+				: EmitterData->PreAllocationCount;
+
+			if (BaseParticleCount > 0)
+			{
+				EmitterData->AllocationMode = EParticleAllocationMode::FixedCount;
+				EmitterData->PreAllocationCount = FMath::Max(1, FMath::RoundToInt(BaseParticleCount * Tier.MaxParticleScale));
+				bHasChanges = true;
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("No particle count estimate for emitter %s, max particle cap skipped for tier %s (simulate the effect once or set a manual allocation count)"),
+					*EmitterName, *Tier.TierName.ToString());
+			}
+
+			if (EmitterData->MaxGPUParticlesSpawnPerFrame > 0)
+			{
+				EmitterData->MaxGPUParticlesSpawnPerFrame = FMath::Max(1, FMath::RoundToInt(EmitterData->MaxGPUParticlesSpawnPerFrame * Tier.MaxParticleScale));
+				bHasChanges = true;
+			}
+		}
+	}
+
+	if (bHasChanges)
+	{
+		// 변경된 Scalability/이미터 상태 반영
+		NiagaraSystem->RequestCompile(false);
+	}
+
+	return bHasChanges;
+}
+
+FString FXAssetTierGenerator::MakeTierAssetName(const FString& BaseAssetName, FName TierName)
+{
+	return FString::Printf(TEXT("%s_%s"), *BaseAssetName, *TierName.ToString());
+}
+
+FString FXAssetTierGenerator::MakeTierTagString(const TArray<TPair<FName, FSoftObjectPath>>& TierLinks)
+{
+	TArray<FString> Entries;
+	Entries.Reserve(TierLinks.Num());
+	for (const TPair<FName, FSoftObjectPath>& Link : TierLinks)
+	{
+		Entries.Add(FString::Printf(TEXT("%s=%s"), *Link.Key.ToString(), *Link.Value.ToString()));
+	}
+	return FString::Join(Entries, TEXT(","));
+}
+
+FSoftObjectPath FXAssetTierGenerator::FindTierInTagString(const FString& TagString, FName TierName)
+{
+	TArray<FString> Entries;
+	TagString.ParseIntoArray(Entries, TEXT(","), true);
+	for (const FString& Entry : Entries)
+	{
+		FString EntryTierName;
+		FString EntryPath;
+		if (Entry.Split(TEXT("="), &EntryTierName, &EntryPath) && FName(*EntryTierName) == TierName)
+		{
+			return FSoftObjectPath(EntryPath);
+		}
+	}
+	return FSoftObjectPath();
+}
@@ -0,0 +1,215 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Utils/FXEffectFeatureExtractor.h"
+#include "Model/FXSimilarityIndex.h"
+#include "NiagaraSystem.h"
+#include "NiagaraEmitter.h"
+#include "NiagaraEmitterHandle.h"
+#include "NiagaraScript.h"
+#include "NiagaraTypes.h"
+#include "NiagaraParameterStore.h"
+#include "NiagaraRendererProperties.h"
+#include "NiagaraSpriteRendererProperties.h"
+#include "NiagaraMeshRendererProperties.h"
+#include "NiagaraRibbonRendererProperties.h"
+#include "NiagaraLightRendererProperties.h"
+#include "Materials/MaterialInterface.h"
+#include "Engine/Texture.h"
+
+namespace FXEffectFeatureExtractorPrivate
+{
+	/**
+	 * 파라미터 저장소의 색/스폰 값 누적
+	 */
+	struct FParameterTotals
+	{
+		float SpawnRate = 0.0f;
+		float BurstCount = 0.0f;
+		FLinearColor ColorSum = FLinearColor(0.0f, 0.0f, 0.0f, 0.0f);
+		float IntensitySum = 0.0f;
+		int32 NumColors = 0;
+
+		void Accumulate(const FNiagaraParameterStore& Store)
+		{
+			for (const FNiagaraVariableWithOffset& VariableWithOffset : Store.ReadParameterVariables())
+			{
+				const FNiagaraVariable Variable(VariableWithOffset.GetType(), VariableWithOffset.GetName());
+				const FNiagaraTypeDefinition& TypeDef = Variable.GetType();
+
+				if (TypeDef == FNiagaraTypeDefinition::GetColorDef())
+				{
+					// 색조와 세기를 분리 (HDR 발광 색도 같은 색조로 비교)
+					const FLinearColor Color = Store.GetParameterValue<FLinearColor>(Variable);
+					const float Intensity = FMath::Max3(Color.R, Color.G, Color.B);
+					if (Intensity > KINDA_SMALL_NUMBER)
+					{
+						ColorSum += FLinearColor(Color.R / Intensity, Color.G / Intensity, Color.B / Intensity, 0.0f);
+						IntensitySum += Intensity;
+						NumColors++;
+					}
+				}
+				else if (TypeDef == FNiagaraTypeDefinition::GetFloatDef())
+				{
+					// 모듈 입력 이름 (예: Constants.Emitter.SpawnRate.SpawnRate)
+					if (Variable.GetName().ToString().Contains(TEXT("SpawnRate")))
+					{
+						SpawnRate += FMath::Max(0.0f, Store.GetParameterValue<float>(Variable));
+					}
+				}
+				else if (TypeDef == FNiagaraTypeDefinition::GetIntDef())
+				{
+					// 예: Constants.Emitter.SpawnBurst_Instantaneous.Spawn Count
+					const FString Name = Variable.GetName().ToString();
+					if (Name.Contains(TEXT("Spawn Count")) || Name.Contains(TEXT("SpawnCount")))
+					{
+						BurstCount += FMath::Max(0, Store.GetParameterValue<int32>(Variable));
+					}
+				}
+			}
+		}
+	};
+
+	static float LogScale(float Value, float Divisor)
+	{
+		return FMath::Log2(1.0f + FMath::Max(0.0f, Value)) / Divisor;
+	}
+}
+
+bool FXEffectFeatureExtractor::ExtractFeatures(const UNiagaraSystem* NiagaraSystem, FFXEffectFeatures& OutFeatures)
+{
+	using namespace FXEffectFeatureExtractorPrivate;
+
+	OutFeatures = FFXEffectFeatures();
+	if (!NiagaraSystem)
+	{
+		return false;
+	}
+
+	int32 NumEmitters = 0;
+	int32 NumGpuEmitters = 0;
+	int32 NumRenderers = 0;
+	int32 NumSprites = 0;
+	int32 NumMeshes = 0;
+	int32 NumRibbons = 0;
+	int32 NumLights = 0;
+	TSet<const UMaterialInterface*> Materials;
+	TSet<const UTexture*> Textures;
+
+	// 시스템 User Parameter의 색도 대표 색에 포함
+	FParameterTotals Totals;
+	Totals.Accumulate(NiagaraSystem->GetExposedParameters());
+
+	// 1. 모든 활성 Emitter 순회
+	for (const FNiagaraEmitterHandle& EmitterHandle : NiagaraSystem->GetEmitterHandles())
+	{
+		if (!EmitterHandle.IsValid() || !EmitterHandle.GetIsEnabled())
+		{
+			continue;
+		}
+
+		const FVersionedNiagaraEmitterData* EmitterData = EmitterHandle.GetEmitterData();
+		if (!EmitterData)
+		{
+			continue;
+		}
+
+		NumEmitters++;
+		if (EmitterData->SimTarget == ENiagaraSimTarget::GPUComputeSim)
+		{
+			NumGpuEmitters++;
+		}
+
+		// 2. 스크립트 모듈 입력 (스폰 속도/버스트 수/색은 상수 입력이 Rapid Iteration 파라미터로 저장됨)
+		TArray<UNiagaraScript*> Scripts;
+		EmitterData->GetScripts(Scripts, false);
+		for (const UNiagaraScript* Script : Scripts)
+		{
+			if (Script)
+			{
+				Totals.Accumulate(Script->RapidIterationParameters);
+			}
+		}
+
+		// 3. 렌더러 종류와 머테리얼/텍스처
+		for (const UNiagaraRendererProperties* RendererProps : EmitterData->GetRenderers())
+		{
+			if (!RendererProps || !RendererProps->GetIsEnabled())
+			{
+				continue;
+			}
+
+			NumRenderers++;
+			if (RendererProps->IsA<UNiagaraSpriteRendererProperties>())
+			{
+				NumSprites++;
+			}
+			else if (RendererProps->IsA<UNiagaraMeshRendererProperties>())
+			{
+				NumMeshes++;
+			}
+			else if (RendererProps->IsA<UNiagaraRibbonRendererProperties>())
+			{
+				NumRibbons++;
+			}
+			else if (RendererProps->IsA<UNiagaraLightRendererProperties>())
+			{
+				NumLights++;
+			}
+
+			TArray<UMaterialInterface*> UsedMaterials;
+			RendererProps->GetUsedMaterials(nullptr, UsedMaterials);
+			for (const UMaterialInterface* Material : UsedMaterials)
+			{
+				if (!Material || Materials.Contains(Material))
+				{
+					continue;
+				}
+				Materials.Add(Material);
+
+				TArray<UTexture*> UsedTextures;
+				Material->GetUsedTextures(UsedTextures, EMaterialQualityLevel::Num, true, ERHIFeatureLevel::Num, true);
+				for (const UTexture* Texture : UsedTextures)
+				{
+					if (Texture)
+					{
+						Textures.Add(Texture);
+					}
+				}
+			}
+		}
+	}
+
+	if (NumEmitters == 0)
+	{
+		return false;
+	}
+
+	float* Values = OutFeatures.Values;
+	Values[FFXEffectFeatures::EmitterCount] = LogScale(NumEmitters, 5.0f);
+	Values[FFXEffectFeatures::GpuEmitterRatio] = float(NumGpuEmitters) / NumEmitters;
+
+	if (NumRenderers > 0)
+	{
+		Values[FFXEffectFeatures::SpriteRatio] = float(NumSprites) / NumRenderers;
+		Values[FFXEffectFeatures::MeshRatio] = float(NumMeshes) / NumRenderers;
+		Values[FFXEffectFeatures::RibbonRatio] = float(NumRibbons) / NumRenderers;
+		Values[FFXEffectFeatures::LightRatio] = float(NumLights) / NumRenderers;
+		Values[FFXEffectFeatures::OtherRendererRatio] = float(NumRenderers - NumSprites - NumMeshes - NumRibbons - NumLights) / NumRenderers;
+	}
+	Values[FFXEffectFeatures::RenderersPerEmitter] = LogScale(float(NumRenderers) / NumEmitters, 3.0f);
+
+	Values[FFXEffectFeatures::SpawnRate] = FMath::LogX(10.0f, 1.0f + Totals.SpawnRate) / 4.0f;
+	Values[FFXEffectFeatures::BurstCount] = FMath::LogX(10.0f, 1.0f + Totals.BurstCount) / 4.0f;
+
+	if (Totals.NumColors > 0)
+	{
+		Values[FFXEffectFeatures::ColorR] = Totals.ColorSum.R / Totals.NumColors;
+		Values[FFXEffectFeatures::ColorG] = Totals.ColorSum.G / Totals.NumColors;
+		Values[FFXEffectFeatures::ColorB] = Totals.ColorSum.B / Totals.NumColors;
+		Values[FFXEffectFeatures::ColorIntensity] = LogScale(Totals.IntensitySum / Totals.NumColors, 6.0f);
+	}
+
+	Values[FFXEffectFeatures::MaterialCount] = LogScale(Materials.Num(), 5.0f);
+	Values[FFXEffectFeatures::TextureCount] = LogScale(Textures.Num(), 6.0f);
+	return true;
+}
@@ -0,0 +1,284 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Utils/FXEmitterDeduplicator.h"
+#include "Utils/FXAssetMover.h"
+#include "Utils/FXAssetOrganizer.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetToolsModule.h"
+#include "IAssetTools.h"
+#include "Modules/ModuleManager.h"
+#include "Misc/SecureHash.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+#include "NiagaraSystem.h"
+#include "NiagaraEmitter.h"
+#include "NiagaraEmitterHandle.h"
+#include "NiagaraScript.h"
+#include "NiagaraParameterStore.h"
+#include "NiagaraRendererProperties.h"
+#include "Materials/MaterialInterface.h"
+
+int32 FXEmitterDeduplicator::ShareIdenticalEmitters(UNiagaraSystem* NiagaraSystem, const FString& RootPath)
+{
+	if (!NiagaraSystem)
+	{
+		return 0;
+	}
+
+	int32 SharedCount = 0;
+
+#if WITH_EDITORONLY_DATA
+	TMap<FString, FSoftObjectPath>& SharedEmitterIndex = GetSharedEmitterIndex(RootPath);
+	bool bHasChanges = false;
+
+	for (FNiagaraEmitterHandle& EmitterHandle : NiagaraSystem->GetEmitterHandles())
+	{
+		if (!EmitterHandle.IsValid())
+		{
+			continue;
+		}
+
+		FVersionedNiagaraEmitter Instance = EmitterHandle.GetInstance();
+		FVersionedNiagaraEmitterData* EmitterData = EmitterHandle.GetEmitterData();
+		if (!Instance.Emitter || !EmitterData)
+		{
+			continue;
+		}
+
+		// 1. 구조 해시 계산 (컴파일되지 않은 이미터는 비교 불가)
+		const FString EmitterHash = ComputeEmitterHash(*EmitterData, Instance.Emitter->GetUniqueEmitterName());
+		if (EmitterHash.IsEmpty())
+		{
+			continue;
+		}
+
+		// 2. 같은 해시의 공유 이미터 찾기 (없으면 이 이미터로 새로 생성)
+		UNiagaraEmitter* SharedEmitter = nullptr;
+		if (const FSoftObjectPath* SharedPath = SharedEmitterIndex.Find(EmitterHash))
+		{
+			SharedEmitter = Cast<UNiagaraEmitter>(SharedPath->TryLoad());
+		}
+
+		if (!SharedEmitter)
+		{
+			SharedEmitter = CreateSharedEmitter(Instance.Emitter, EmitterHandle.GetName().ToString(), RootPath);
+			if (!SharedEmitter)
+			{
+				continue;
+			}
+			SharedEmitterIndex.Add(EmitterHash, FSoftObjectPath(SharedEmitter));
+		}
+
+		// 3. 공유 이미터를 부모로 설정 (이미 연결되어 있으면 스킵)
+		//    해시가 그래프, 모듈 입력 상수, 렌더러 속성까지 같으므로 부모 병합 시 인스턴스 내용이 바뀌지 않음
+		if (EmitterData->GetParent().Emitter != SharedEmitter)
+		{
+			Instance.Emitter->SetParent(FVersionedNiagaraEmitter(SharedEmitter, SharedEmitter->GetExposedVersion().VersionGuid));
+			bHasChanges = true;
+			UE_LOG(LogTemp, Log, TEXT("Linked emitter %s of %s to shared emitter %s"),
+				*EmitterHandle.GetName().ToString(), *NiagaraSystem->GetName(), *SharedEmitter->GetPathName());
+		}
+
+		SharedCount++;
+	}
+
+	if (bHasChanges)
+	{
+		FXAssetMover::SaveAssetPackage(NiagaraSystem);
+	}
+#endif
+
+	return SharedCount;
+}
+
+FString FXEmitterDeduplicator::ComputeEmitterHash(const FVersionedNiagaraEmitterData& EmitterData, const FString& UniqueEmitterName)
+{
+#if WITH_EDITORONLY_DATA
+	FSHA1 Hasher;
+
+	// 이미터 고유 이름은 시스템마다 다르므로 파라미터 이름/바인딩에서 공통 이름으로 치환
+	auto UpdateNormalized = [&Hasher, &UniqueEmitterName](FString Text)
+	{
+		if (!UniqueEmitterName.IsEmpty())
+		{
+			Text.ReplaceInline(*UniqueEmitterName, TEXT("Emitter"), ESearchCase::CaseSensitive);
+		}
+		Hasher.UpdateWithString(*Text, Text.Len());
+	};
+
+	// 1. 스크립트 그래프 해시 (이름/GUID와 무관하게 그래프 구조가 같으면 동일)
+	TArray<UNiagaraScript*> Scripts;
+	EmitterData.GetScripts(Scripts, false);
+	if (Scripts.Num() == 0)
+	{
+		return FString();
+	}
+
+	for (const UNiagaraScript* Script : Scripts)
+	{
+		if (!Script)
+		{
+			continue;
+		}
+
+		const FNiagaraVMExecutableDataId& CompileId = Script->GetComputedVMCompilationId();
+		if (!CompileId.IsValid())
+		{
+			return FString();
+		}
+
+		const FString ScriptHash = FString::Printf(TEXT("%d:%s;"), static_cast<int32>(Script->GetUsage()), *CompileId.BaseScriptCompileHash.ToString());
+		Hasher.UpdateWithString(*ScriptHash, ScriptHash.Len());
+
+		// 모듈 입력 상수 (컴파일 해시에 포함되지 않으므로 값 자체를 비교, 이름순으로 정렬)
+		TArray<FString> RapidIterationValues;
+		const FNiagaraParameterStore& RapidIterationParameters = Script->RapidIterationParameters;
+		for (const FNiagaraVariableWithOffset& Variable : RapidIterationParameters.ReadParameterVariables())
+		{
+			const uint8* ValueData = RapidIterationParameters.GetParameterData(Variable.Offset);
+			const int32 ValueSize = Variable.GetType().GetSize();
+			RapidIterationValues.Add(FString::Printf(TEXT("%s=%s"),
+				*Variable.GetName().ToString(), ValueData ? *BytesToHex(ValueData, ValueSize) : TEXT("None")));
+		}
+		RapidIterationValues.Sort();
+		UpdateNormalized(FString::Join(RapidIterationValues, TEXT(",")) + TEXT(";"));
+	}
+
+	// 2. 시뮬레이션 설정
+	const FString SimSettings = FString::Printf(TEXT("Sim:%d,%d,%d;"),
+		static_cast<int32>(EmitterData.SimTarget), EmitterData.bLocalSpace ? 1 : 0, EmitterData.bDeterminism ? 1 : 0);
+	Hasher.UpdateWithString(*SimSettings, SimSettings.Len());
+
+	// 3. 렌더러 종류, 머테리얼 참조(라이브러리 복사본 경로 기준)와 전체 속성 값
+	for (const UNiagaraRendererProperties* RendererProps : EmitterData.GetRenderers())
+	{
+		if (!RendererProps)
+		{
+			continue;
+		}
+
+		FString RendererKey = RendererProps->GetClass()->GetPathName();
+		TArray<UMaterialInterface*> Materials;
+		RendererProps->GetUsedMaterials(nullptr, Materials);
+		for (const UMaterialInterface* Material : Materials)
+		{
+			RendererKey += TEXT("|");
+			RendererKey += Material ? Material->GetPathName() : TEXT("None");
+		}
+
+		// 속성 텍스트 내보내기 (바인딩, 정렬, 메시 등 렌더러가 직렬화하는 값 전부)
+		for (TFieldIterator<FProperty> PropertyIt(RendererProps->GetClass()); PropertyIt; ++PropertyIt)
+		{
+			const FProperty* Property = *PropertyIt;
+			if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient))
+			{
+				continue;
+			}
+
+			FString ValueText;
+			Property->ExportText_InContainer(0, ValueText, RendererProps, nullptr, nullptr, PPF_None);
+			RendererKey += TEXT("|");
+			RendererKey += Property->GetName();
+			RendererKey += TEXT("=");
+			RendererKey += ValueText;
+		}
+
+		RendererKey += TEXT(";");
+		UpdateNormalized(MoveTemp(RendererKey));
+	}
+
+	Hasher.Final();
+
+	FSHAHash Hash;
+	Hasher.GetHash(Hash.Hash);
+	return Hash.ToString();
+#else
+	return FString();
+#endif
+}
+
+TMap<FString, FSoftObjectPath>& FXEmitterDeduplicator::GetSharedEmitterIndex(const FString& RootPath)
+{
+	// 루트 경로별 해시 -> 공유 이미터 경로 (에디터 세션 동안 유지)
+	static TMap<FString, TMap<FString, FSoftObjectPath>> IndicesByFolder;
+
+	const FString EmitterFolder = FXAssetOrganizer::GetFolderPathForAssetType(RootPath, TEXT(""), TEXT("NiagaraEmitter"));
+	if (TMap<FString, FSoftObjectPath>* ExistingIndex = IndicesByFolder.Find(EmitterFolder))
+	{
+		return *ExistingIndex;
+	}
+
+	TMap<FString, FSoftObjectPath>& SharedEmitterIndex = IndicesByFolder.Add(EmitterFolder);
+
+	// 기존 공유 이미터 스캔
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetData> EmitterAssets;
+	AssetRegistry.GetAssetsByPath(*EmitterFolder, EmitterAssets, true);
+
+	for (const FAssetData& AssetData : EmitterAssets)
+	{
+		if (AssetData.AssetClassPath != UNiagaraEmitter::StaticClass()->GetClassPathName())
+		{
+			continue;
+		}
+
+		UNiagaraEmitter* SharedEmitter = Cast<UNiagaraEmitter>(AssetData.GetAsset());
+		FVersionedNiagaraEmitterData* EmitterData = SharedEmitter ? SharedEmitter->GetLatestEmitterData() : nullptr;
+		if (!EmitterData)
+		{
+			continue;
+		}
+
+		const FString EmitterHash = ComputeEmitterHash(*EmitterData, SharedEmitter->GetUniqueEmitterName());
+		if (!EmitterHash.IsEmpty())
+		{
+			SharedEmitterIndex.Add(EmitterHash, AssetData.ToSoftObjectPath());
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Indexed %d shared emitters in %s"), SharedEmitterIndex.Num(), *EmitterFolder);
+	return SharedEmitterIndex;
+}
+
+UNiagaraEmitter* FXEmitterDeduplicator::CreateSharedEmitter(UNiagaraEmitter* SourceEmitter, const FString& EmitterName, const FString& RootPath)
+{
+	if (!SourceEmitter)
+	{
+		return nullptr;
+	}
+
+	const FString EmitterFolder = FXAssetOrganizer::GetFolderPathForAssetType(RootPath, TEXT(""), TEXT("NiagaraEmitter"));
+	if (!FXAssetOrganizer::CreateFolderPath(EmitterFolder))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to create folder: %s"), *EmitterFolder);
+		return nullptr;
+	}
+
+	// 고유한 에셋 이름 생성 (예: /Game/FXLib/Emitters/E_Sparks_01)
+	IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+	FString PackageName;
+	FString AssetName;
+	AssetTools.CreateUniqueAssetName(EmitterFolder / (TEXT("E_") + EmitterName), TEXT(""), PackageName, AssetName);
+
+	UPackage* Package = CreatePackage(*PackageName);
+	UNiagaraEmitter* SharedEmitter = DuplicateObject<UNiagaraEmitter>(SourceEmitter, Package, *AssetName);
+	if (!SharedEmitter)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to create shared emitter: %s"), *PackageName);
+		return nullptr;
+	}
+
+	SharedEmitter->SetFlags(RF_Public | RF_Standalone);
+	SharedEmitter->ClearFlags(RF_Transient);
+
+#if WITH_EDITORONLY_DATA
+	// 공유 이미터는 라이브러리 안에서 자립 (원본 벤더 이미터 상속 해제)
+	SharedEmitter->RemoveParent();
+#endif
+
+	FAssetRegistryModule::AssetCreated(SharedEmitter);
+	FXAssetMover::SaveAssetPackage(SharedEmitter);
+
+	UE_LOG(LogTemp, Log, TEXT("Created shared emitter: %s"), *SharedEmitter->GetPathName());
+	return SharedEmitter;
+}
@@ -0,0 +1,162 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Utils/FXLibraryScriptingLibrary.h"
+#include "Model/FXLibrarySubsystem.h"
+#include "Model/FXLibraryModel.h"
+#include "Model/FXLibraryState.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+
+namespace FXLibraryScriptingPrivate
+{
+	static TSharedPtr<FFXLibraryModel> GetLibraryModel()
+	{
+		UFXLibrarySubsystem* LibrarySubsystem = UFXLibrarySubsystem::Get();
+		TSharedPtr<FFXLibraryModel> Model = LibrarySubsystem ? LibrarySubsystem->GetModel() : nullptr;
+		if (!Model.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[FX Library Scripting] Library service is not available"));
+		}
+		return Model;
+	}
+
+	static bool MatchesTags(const FAssetData& AssetData, const TMap<FName, FString>& Tags)
+	{
+		for (const TPair<FName, FString>& Tag : Tags)
+		{
+			FString Value;
+			if (!AssetData.GetTagValue(Tag.Key, Value) || (!Tag.Value.IsEmpty() && Value != Tag.Value))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+int32 UFXLibraryScriptingLibrary::AddAssets(FName Category, const TArray<FSoftObjectPath>& AssetPaths, bool bCreateCategory)
+{
+	TSharedPtr<FFXLibraryModel> Model = FXLibraryScriptingPrivate::GetLibraryModel();
+	return Model.IsValid() ? Model->AddAssetsToCategory(Category, AssetPaths, bCreateCategory) : 0;
+}
+
+int32 UFXLibraryScriptingLibrary::RemoveAssets(FName Category, const TArray<FSoftObjectPath>& AssetPaths)
+{
+	TSharedPtr<FFXLibraryModel> Model = FXLibraryScriptingPrivate::GetLibraryModel();
+	if (!Model.IsValid())
+	{
+		return 0;
+	}
+
+	return Model->RemoveAssetsFromCategory(Category, AssetPaths);
+}
+
+int32 UFXLibraryScriptingLibrary::MoveAssets(FName SourceCategory, FName TargetCategory, const TArray<FSoftObjectPath>& AssetPaths)
+{
+	TSharedPtr<FFXLibraryModel> Model = FXLibraryScriptingPrivate::GetLibraryModel();
+	return Model.IsValid() ? Model->MoveAssetsToCategory(SourceCategory, TargetCategory, AssetPaths) : 0;
+}
+
+TArray<FFXLibraryEntry> UFXLibraryScriptingLibrary::QueryEntries(const FFXLibraryQuery& Query)
+{
+	TArray<FFXLibraryEntry> Entries;
+
+	TSharedPtr<FFXLibraryModel> Model = FXLibraryScriptingPrivate::GetLibraryModel();
+	TSharedPtr<FFXLibraryState> State = Model.IsValid() ? Model->GetState() : nullptr;
+	if (!State.IsValid())
+	{
+		return Entries;
+	}
+
+	// 1. 카테고리 조건으로 후보 수집
+	for (const TSharedPtr<FName>& CategoryPtr : State->Categories)
+	{
+		if (!CategoryPtr.IsValid() || (Query.Categories.Num() > 0 && !Query.Categories.Contains(*CategoryPtr)))
+		{
+			continue;
+		}
+
+		for (const FSoftObjectPath& AssetPath : State->GetCategoryAssets(*CategoryPtr))
+		{
+			FFXLibraryEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.Category = *CategoryPtr;
+			Entry.Path = AssetPath;
+			Entry.bIsVariant = FFXAssetVariant::IsVariantEntry(AssetPath);
+			Entry.bIsReferenced = State->IsReferencedAsset(AssetPath);
+		}
+	}
+
+	if (!Query.bIncludeVariants)
+	{
+		Entries.RemoveAll([](const FFXLibraryEntry& Entry) { return Entry.bIsVariant; });
+	}
+
+	if (Query.Classes.Num() == 0 && Query.Tags.Num() == 0)
+	{
+		return Entries;
+	}
+
+	// 2. 클래스/태그 조건은 후보 전체를 한 번의 레지스트리 조회로 확인
+	TSet<FSoftObjectPath> CandidatePaths;
+	CandidatePaths.Reserve(Entries.Num());
+	for (const FFXLibraryEntry& Entry : Entries)
+	{
+		CandidatePaths.Add(Entry.Path.GetWithoutSubPath());
+	}
+
+	FARFilter Filter;
+	Filter.SoftObjectPaths = CandidatePaths.Array();
+	for (const UClass* Class : Query.Classes)
+	{
+		if (Class)
+		{
+			Filter.ClassPaths.Add(Class->GetClassPathName());
+		}
+	}
+	Filter.bRecursiveClasses = true;
+
+	TArray<FAssetData> MatchingAssets;
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.GetAssets(Filter, MatchingAssets);
+
+	TSet<FSoftObjectPath> MatchingPaths;
+	MatchingPaths.Reserve(MatchingAssets.Num());
+	for (const FAssetData& AssetData : MatchingAssets)
+	{
+		if (FXLibraryScriptingPrivate::MatchesTags(AssetData, Query.Tags))
+		{
+			MatchingPaths.Add(AssetData.GetSoftObjectPath());
+		}
+	}
+
+	Entries.RemoveAll([&MatchingPaths](const FFXLibraryEntry& Entry)
+	{
+		return !MatchingPaths.Contains(Entry.Path.GetWithoutSubPath());
+	});
+	return Entries;
+}
+
+int32 UFXLibraryScriptingLibrary::RebuildFromAssetRegistry(const FString& RootPath)
+{
+	TSharedPtr<FFXLibraryModel> Model = FXLibraryScriptingPrivate::GetLibraryModel();
+	return Model.IsValid() ? Model->RebuildFromAssetRegistry(RootPath) : 0;
+}
+
+TArray<FName> UFXLibraryScriptingLibrary::GetCategories()
+{
+	TArray<FName> Categories;
+
+	TSharedPtr<FFXLibraryModel> Model = FXLibraryScriptingPrivate::GetLibraryModel();
+	TSharedPtr<FFXLibraryState> State = Model.IsValid() ? Model->GetState() : nullptr;
+	if (State.IsValid())
+	{
+		for (const TSharedPtr<FName>& CategoryPtr : State->Categories)
+		{
+			if (CategoryPtr.IsValid())
+			{
+				Categories.Add(*CategoryPtr);
+			}
+		}
+	}
+	return Categories;
+}
@@ -0,0 +1,320 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Utils/FXMaterialDeduplicator.h"
+#include "Utils/FXAssetOrganizer.h"
+#include "Utils/FXAssetMover.h"
+#include "Core/FXAssetLibConstants.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Modules/ModuleManager.h"
+#include "Misc/SecureHash.h"
+#include "UObject/UnrealType.h"
+#include "UObject/MetaData.h"
+#include "UObject/Package.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialExpression.h"
+#include "Materials/MaterialExpressionComment.h"
+
+namespace FXMaterialDeduplicatorPrivate
+{
+	// 그래프 비교에서 제외할 프로퍼티 (에디터 배치/식별 정보)
+	static bool IsIgnoredProperty(const FProperty* Property)
+	{
+		static const TSet<FName> IgnoredNames = {
+			TEXT("MaterialExpressionEditorX"),
+			TEXT("MaterialExpressionEditorY"),
+			TEXT("MaterialExpressionGuid"),
+			TEXT("ExpressionGUID"),
+			TEXT("Desc"),
+			TEXT("bCollapsed"),
+			TEXT("bRealtimePreview"),
+			TEXT("bNeedToUpdatePreview"),
+			TEXT("bCommentBubbleVisible"),
+			TEXT("GraphNode"),
+			TEXT("SubgraphExpression"),
+			TEXT("Material"),
+			TEXT("Function"),
+			TEXT("Outputs")
+		};
+
+		if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient))
+		{
+			return true;
+		}
+
+		return IgnoredNames.Contains(Property->GetFName());
+	}
+
+	// 연결 정보 구조체 (FExpressionInput 계열) 여부 - 연결은 GetInputsView로 따로 해시
+	static bool IsInputStruct(const FProperty* Property)
+	{
+		const FProperty* ValueProperty = Property;
+		if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+		{
+			ValueProperty = ArrayProp->Inner;
+		}
+
+		const FStructProperty* StructProp = CastField<FStructProperty>(ValueProperty);
+		return StructProp && StructProp->Struct->GetName().EndsWith(TEXT("Input"));
+	}
+
+	static void UpdateHash(FSHA1& Hasher, const FString& Value)
+	{
+		Hasher.UpdateWithString(*Value, Value.Len());
+		Hasher.UpdateWithString(TEXT(";"), 1);
+	}
+
+	// 참조 경로를 라이브러리 기준으로 변환 (매핑이 없으면 그대로, 이미 라이브러리 경로거나 복사되지 않은 외부 에셋)
+	static FString GetLibraryReferencePath(const FSoftObjectPath& ReferencePath, const TMap<FSoftObjectPath, FSoftObjectPath>* ReferenceMap)
+	{
+		if (ReferenceMap)
+		{
+			if (const FSoftObjectPath* MappedPath = ReferenceMap->Find(ReferencePath))
+			{
+				return MappedPath->ToString();
+			}
+		}
+		return ReferencePath.ToString();
+	}
+
+	// 머테리얼 폴더 -> (그래프 해시 -> 라이브러리 마스터 경로)
+	static TMap<FString, TMap<FString, FSoftObjectPath>>& GetIndicesByFolder()
+	{
+		static TMap<FString, TMap<FString, FSoftObjectPath>> IndicesByFolder;
+		return IndicesByFolder;
+	}
+}
+
+FSoftObjectPath FXMaterialDeduplicator::FindEquivalentMaster(const FSoftObjectPath& SourceMaterialPath, const FString& RootPath, const TMap<FSoftObjectPath, FSoftObjectPath>& ReferenceMap)
+{
+	const UMaterial* SourceMaterial = Cast<UMaterial>(SourceMaterialPath.TryLoad());
+	if (!SourceMaterial)
+	{
+		return FSoftObjectPath();
+	}
+
+	const FString GraphHash = ComputeMaterialGraphHash(SourceMaterial, &ReferenceMap);
+	if (GraphHash.IsEmpty())
+	{
+		return FSoftObjectPath();
+	}
+
+	if (const FSoftObjectPath* MasterPath = GetMasterIndex(RootPath).Find(GraphHash))
+	{
+		return *MasterPath;
+	}
+
+	return FSoftObjectPath();
+}
+
+void FXMaterialDeduplicator::RegisterMaster(const FSoftObjectPath& MasterPath, const FString& RootPath)
+{
+	UMaterial* Master = Cast<UMaterial>(MasterPath.TryLoad());
+	if (!Master)
+	{
+		return;
+	}
+
+	const FString GraphHash = ComputeMaterialGraphHash(Master);
+	if (GraphHash.IsEmpty())
+	{
+		return;
+	}
+
+	// 해시를 태그로 기록 (저장해야 디스크의 레지스트리 태그에 반영됨)
+	Master->GetPackage()->GetMetaData()->SetValue(Master, FFXAssetLibConstants::GraphHashMetadataTag, *GraphHash);
+	FXAssetMover::SaveAssetPackage(Master);
+
+	GetMasterIndex(RootPath).FindOrAdd(GraphHash, MasterPath);
+}
+
+void FXMaterialDeduplicator::InvalidateIndexForPath(const FSoftObjectPath& AssetPath)
+{
+	TMap<FString, TMap<FString, FSoftObjectPath>>& IndicesByFolder = FXMaterialDeduplicatorPrivate::GetIndicesByFolder();
+	if (IndicesByFolder.Num() == 0)
+	{
+		return;
+	}
+
+	const FString PackageName = AssetPath.GetLongPackageName();
+	for (auto It = IndicesByFolder.CreateIterator(); It; ++It)
+	{
+		FString FolderPrefix = It.Key();
+		if (!FolderPrefix.EndsWith(TEXT("/")))
+		{
+			FolderPrefix += TEXT("/");
+		}
+
+		if (PackageName.StartsWith(FolderPrefix))
+		{
+			UE_LOG(LogTemp, Log, TEXT("Invalidated master material index for %s (changed: %s)"), *It.Key(), *PackageName);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+FString FXMaterialDeduplicator::ComputeMaterialGraphHash(const UMaterial* Material, const TMap<FSoftObjectPath, FSoftObjectPath>* ReferenceMap)
+{
+#if WITH_EDITORONLY_DATA
+	using namespace FXMaterialDeduplicatorPrivate;
+
+	if (!Material)
+	{
+		return FString();
+	}
+
+	FSHA1 Hasher;
+
+	// 1. 머테리얼 설정 (도메인/블렌드/셰이딩 모델/사용 플래그)
+	UpdateHash(Hasher, FString::Printf(TEXT("Domain:%d,Blend:%d,Shading:%d,TwoSided:%d,Clip:%.4f,TLM:%d"),
+		static_cast<int32>(Material->MaterialDomain.GetValue()),
+		static_cast<int32>(Material->BlendMode.GetValue()),
+		static_cast<int32>(Material->GetShadingModels().GetShadingModelField()),
+		Material->IsTwoSided() ? 1 : 0,
+		Material->GetOpacityMaskClipValue(),
+		static_cast<int32>(Material->TranslucencyLightingMode.GetValue())));
+
+	FString UsageFlags;
+	for (int32 Usage = 0; Usage < MATUSAGE_MAX; ++Usage)
+	{
+		UsageFlags += Material->GetUsageByFlag(static_cast<EMaterialUsage>(Usage)) ? TEXT("1") : TEXT("0");
+	}
+	UpdateHash(Hasher, UsageFlags);
+
+	// 2. 노드 목록 (코멘트 제외) 과 인덱스 매핑
+	TArray<UMaterialExpression*> Expressions;
+	for (UMaterialExpression* Expression : Material->GetExpressions())
+	{
+		if (Expression && !Expression->IsA<UMaterialExpressionComment>())
+		{
+			Expressions.Add(Expression);
+		}
+	}
+
+	auto GetExpressionKey = [&Expressions](const UMaterialExpression* Expression) -> FString
+	{
+		return Expression ? FString::FromInt(Expressions.IndexOfByKey(Expression)) : TEXT("-");
+	};
+
+	for (UMaterialExpression* Expression : Expressions)
+	{
+		UpdateHash(Hasher, Expression->GetClass()->GetPathName());
+
+		// 프로퍼티 값
+		for (TFieldIterator<FProperty> PropIt(Expression->GetClass()); PropIt; ++PropIt)
+		{
+			const FProperty* Property = *PropIt;
+			if (IsIgnoredProperty(Property) || IsInputStruct(Property))
+			{
+				continue;
+			}
+
+			const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Expression);
+			FString ValueText;
+
+			if (const FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(Property))
+			{
+				// 오브젝트 참조는 라이브러리 복사본의 전체 경로로 비교 (이름만 같은 다른 텍스처와 구분)
+				const UObject* Referenced = ObjectProp->GetObjectPropertyValue(ValuePtr);
+				if (const UMaterialExpression* ReferencedExpression = Cast<UMaterialExpression>(Referenced))
+				{
+					ValueText = GetExpressionKey(ReferencedExpression);
+				}
+				else if (Referenced && Referenced->IsIn(Material->GetPackage()))
+				{
+					// 머테리얼 패키지 내부 오브젝트는 머테리얼 기준 상대 경로
+					ValueText = Referenced->GetPathName(Material);
+				}
+				else
+				{
+					ValueText = Referenced ? GetLibraryReferencePath(FSoftObjectPath(Referenced), ReferenceMap) : TEXT("None");
+				}
+			}
+			else if (const FSoftObjectProperty* SoftObjectProp = CastField<FSoftObjectProperty>(Property))
+			{
+				const FSoftObjectPath& ReferencePath = static_cast<const FSoftObjectPtr*>(ValuePtr)->ToSoftObjectPath();
+				ValueText = ReferencePath.IsNull() ? TEXT("None") : GetLibraryReferencePath(ReferencePath, ReferenceMap);
+			}
+			else
+			{
+				Property->ExportTextItem_Direct(ValueText, ValuePtr, nullptr, nullptr, PPF_None);
+			}
+
+			UpdateHash(Hasher, Property->GetName() + TEXT("=") + ValueText);
+		}
+
+		// 연결 구조 (입력 노드 인덱스 + 출력 인덱스)
+		for (const FExpressionInput* Input : Expression->GetInputsView())
+		{
+			UpdateHash(Hasher, Input
+				? FString::Printf(TEXT("In:%s.%d"), *GetExpressionKey(Input->Expression), Input->OutputIndex)
+				: TEXT("In:-"));
+		}
+	}
+
+	// 3. 머테리얼 속성 입력 연결 (EmissiveColor, Opacity 등)
+	if (const UMaterialEditorOnlyData* EditorOnlyData = Material->GetEditorOnlyData())
+	{
+		for (TFieldIterator<FStructProperty> PropIt(EditorOnlyData->GetClass()); PropIt; ++PropIt)
+		{
+			const FStructProperty* StructProp = *PropIt;
+			if (!IsInputStruct(StructProp))
+			{
+				continue;
+			}
+
+			const FExpressionInput* Input = StructProp->ContainerPtrToValuePtr<FExpressionInput>(EditorOnlyData);
+			UpdateHash(Hasher, FString::Printf(TEXT("%s:%s.%d"),
+				*StructProp->GetName(), *GetExpressionKey(Input->Expression), Input->OutputIndex));
+		}
+	}
+
+	Hasher.Final();
+
+	FSHAHash Hash;
+	Hasher.GetHash(Hash.Hash);
+	return Hash.ToString();
+#else
+	return FString();
+#endif
+}
+
+TMap<FString, FSoftObjectPath>& FXMaterialDeduplicator::GetMasterIndex(const FString& RootPath)
+{
+	// 루트 경로별 해시 -> 라이브러리 마스터 경로 (폴더의 에셋이 제거/이름 변경되면 InvalidateIndexForPath로 폐기)
+	TMap<FString, TMap<FString, FSoftObjectPath>>& IndicesByFolder = FXMaterialDeduplicatorPrivate::GetIndicesByFolder();
+
+	const FString MaterialFolder = FXAssetOrganizer::GetFolderPathForAssetType(RootPath, TEXT(""), TEXT("Material"));
+	if (TMap<FString, FSoftObjectPath>* ExistingIndex = IndicesByFolder.Find(MaterialFolder))
+	{
+		return *ExistingIndex;
+	}
+
+	TMap<FString, FSoftObjectPath>& MasterIndex = IndicesByFolder.Add(MaterialFolder);
+
+	// 기존 라이브러리 마스터 머테리얼의 해시 태그 스캔 (로드 없음, 태그 기록 전 복사본은 재사용 대상에서 제외)
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetData> MaterialAssets;
+	AssetRegistry.GetAssetsByPath(*MaterialFolder, MaterialAssets, true);
+
+	int32 UntaggedCount = 0;
+	for (const FAssetData& AssetData : MaterialAssets)
+	{
+		if (AssetData.AssetClassPath != UMaterial::StaticClass()->GetClassPathName())
+		{
+			continue;
+		}
+
+		FString GraphHash;
+		if (AssetData.GetTagValue(FFXAssetLibConstants::GraphHashMetadataTag, GraphHash) && !GraphHash.IsEmpty())
+		{
+			MasterIndex.FindOrAdd(GraphHash, AssetData.ToSoftObjectPath());
+		}
+		else
+		{
+			UntaggedCount++;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Indexed %d master materials in %s (%d without graph hash tag)"), MasterIndex.Num(), *MaterialFolder, UntaggedCount);
+	return MasterIndex;
+}
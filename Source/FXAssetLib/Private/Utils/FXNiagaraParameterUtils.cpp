@@ -0,0 +1,123 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Utils/FXNiagaraParameterUtils.h"
+#include "FXLibrarySettings.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "NiagaraTypes.h"
+#include "NiagaraUserRedirectionParameterStore.h"
+
+int32 FFXNiagaraParameterUtils::CaptureUserParameterOverrides(
+	const UNiagaraComponent* NiagaraComponent,
+	TArray<FFXUserParameterOverride>& OutOverrides)
+{
+	OutOverrides.Empty();
+
+	if (!NiagaraComponent || !NiagaraComponent->GetAsset())
+	{
+		return 0;
+	}
+
+	const FNiagaraUserRedirectionParameterStore& ComponentParams = NiagaraComponent->GetOverrideParameters();
+	const FNiagaraUserRedirectionParameterStore& DefaultParams = NiagaraComponent->GetAsset()->GetExposedParameters();
+
+	TArray<FNiagaraVariable> UserParameters;
+	ComponentParams.GetUserParameters(UserParameters);
+
+	for (const FNiagaraVariable& Variable : UserParameters)
+	{
+		const FNiagaraTypeDefinition& TypeDef = Variable.GetType();
+
+		FFXUserParameterOverride Override;
+		Override.ParameterName = Variable.GetName();
+		bool bDiffers = false;
+
+		// 시스템 기본값과 다른 값만 저장
+		if (TypeDef == FNiagaraTypeDefinition::GetFloatDef())
+		{
+			Override.Type = EFXUserParameterType::Float;
+			Override.FloatValue = ComponentParams.GetParameterValue<float>(Variable);
+			bDiffers = !FMath::IsNearlyEqual(Override.FloatValue, DefaultParams.GetParameterValue<float>(Variable));
+		}
+		else if (TypeDef == FNiagaraTypeDefinition::GetIntDef())
+		{
+			Override.Type = EFXUserParameterType::Int;
+			Override.IntValue = ComponentParams.GetParameterValue<int32>(Variable);
+			bDiffers = Override.IntValue != DefaultParams.GetParameterValue<int32>(Variable);
+		}
+		else if (TypeDef == FNiagaraTypeDefinition::GetBoolDef())
+		{
+			Override.Type = EFXUserParameterType::Bool;
+			Override.bBoolValue = ComponentParams.GetParameterValue<FNiagaraBool>(Variable).GetValue();
+			bDiffers = Override.bBoolValue != DefaultParams.GetParameterValue<FNiagaraBool>(Variable).GetValue();
+		}
+		else if (TypeDef == FNiagaraTypeDefinition::GetVec3Def())
+		{
+			Override.Type = EFXUserParameterType::Vector;
+			Override.VectorValue = FVector(ComponentParams.GetParameterValue<FVector3f>(Variable));
+			bDiffers = !Override.VectorValue.Equals(FVector(DefaultParams.GetParameterValue<FVector3f>(Variable)));
+		}
+		else if (TypeDef == FNiagaraTypeDefinition::GetColorDef())
+		{
+			Override.Type = EFXUserParameterType::Color;
+			Override.ColorValue = ComponentParams.GetParameterValue<FLinearColor>(Variable);
+			bDiffers = !Override.ColorValue.Equals(DefaultParams.GetParameterValue<FLinearColor>(Variable));
+		}
+		else
+		{
+			// 지원하지 않는 타입 (DataInterface, Object 등)은 스킵
+			continue;
+		}
+
+		if (bDiffers)
+		{
+			OutOverrides.Add(Override);
+		}
+	}
+
+	return OutOverrides.Num();
+}
+
+int32 FFXNiagaraParameterUtils::ApplyUserParameterOverrides(
+	UNiagaraComponent* NiagaraComponent,
+	const TArray<FFXUserParameterOverride>& Overrides)
+{
+	if (!NiagaraComponent)
+	{
+		return 0;
+	}
+
+	int32 AppliedCount = 0;
+	for (const FFXUserParameterOverride& Override : Overrides)
+	{
+		if (Override.ParameterName.IsNone())
+		{
+			continue;
+		}
+
+		switch (Override.Type)
+		{
+		case EFXUserParameterType::Float:
+			NiagaraComponent->SetVariableFloat(Override.ParameterName, Override.FloatValue);
+			break;
+		case EFXUserParameterType::Int:
+			NiagaraComponent->SetVariableInt(Override.ParameterName, Override.IntValue);
+			break;
+		case EFXUserParameterType::Bool:
+			NiagaraComponent->SetVariableBool(Override.ParameterName, Override.bBoolValue);
+			break;
+		case EFXUserParameterType::Vector:
+			NiagaraComponent->SetVariableVec3(Override.ParameterName, Override.VectorValue);
+			break;
+		case EFXUserParameterType::Color:
+			NiagaraComponent->SetVariableLinearColor(Override.ParameterName, Override.ColorValue);
+			break;
+		default:
+			continue;
+		}
+
+		AppliedCount++;
+	}
+
+	return AppliedCount;
+}
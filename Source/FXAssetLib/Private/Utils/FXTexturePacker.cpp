@@ -0,0 +1,345 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Utils/FXTexturePacker.h"
+#include "Utils/FXAssetMover.h"
+#include "Utils/FXAssetOrganizer.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetToolsModule.h"
+#include "IAssetTools.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+#include "ImageCore.h"
+#include "Algo/AllOf.h"
+#include "Engine/Texture2D.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialExpression.h"
+#include "Materials/MaterialExpressionTextureSample.h"
+
+FFXTexturePackResult FXTexturePacker::PackGrayscaleMasks(UMaterial* Material, const FString& RootPath)
+{
+	FFXTexturePackResult Result;
+
+#if WITH_EDITORONLY_DATA
+	if (!Material)
+	{
+		return Result;
+	}
+
+	TArray<UMaterialExpression*, TInlineAllocator<64>> Expressions;
+	FXAssetMover::CollectMaterialExpressions(Material, Expressions);
+
+	// 1. Expression별 입력 연결 수집 (노드 입력 + 머테리얼 속성 입력)
+	TMap<UMaterialExpression*, TArray<FExpressionInput*>> Consumers;
+	for (UMaterialExpression* Expression : Expressions)
+	{
+		if (!Expression)
+		{
+			continue;
+		}
+
+		for (FExpressionInput* Input : Expression->GetInputsView())
+		{
+			if (Input && Input->Expression)
+			{
+				Consumers.FindOrAdd(Input->Expression).Add(Input);
+			}
+		}
+	}
+
+	if (UMaterialEditorOnlyData* EditorOnlyData = Material->GetEditorOnlyData())
+	{
+		for (TFieldIterator<FStructProperty> PropIt(EditorOnlyData->GetClass()); PropIt; ++PropIt)
+		{
+			if (!PropIt->Struct->GetName().EndsWith(TEXT("Input")))
+			{
+				continue;
+			}
+
+			FExpressionInput* Input = PropIt->ContainerPtrToValuePtr<FExpressionInput>(EditorOnlyData);
+			if (Input->Expression)
+			{
+				Consumers.FindOrAdd(Input->Expression).Add(Input);
+			}
+		}
+	}
+
+	// 2. 패킹 가능한 Texture Sample을 UV/샘플링 설정/해상도 기준으로 그룹화
+	TMap<FString, TArray<UMaterialExpressionTextureSample*>> SampleGroups;
+	for (UMaterialExpression* Expression : Expressions)
+	{
+		// 파라미터 노드는 인스턴스에서 교체될 수 있으므로 제외
+		if (!Expression || Expression->GetClass() != UMaterialExpressionTextureSample::StaticClass())
+		{
+			continue;
+		}
+
+		UMaterialExpressionTextureSample* Sample = CastChecked<UMaterialExpressionTextureSample>(Expression);
+		UTexture2D* Texture = Cast<UTexture2D>(Sample->Texture);
+		if (!IsGrayscaleTexture(Texture))
+		{
+			continue;
+		}
+
+		// UV 외의 입력(TextureObject, MipValue 등)이 연결된 노드는 제외
+		bool bHasOtherInputs = false;
+		for (FExpressionInput* Input : Sample->GetInputsView())
+		{
+			if (Input && Input != &Sample->Coordinates && Input->Expression)
+			{
+				bHasOtherInputs = true;
+				break;
+			}
+		}
+
+		// 모든 사용처가 단일 채널(R/G/B) 출력이어야 함 (그레이스케일이므로 값 동일)
+		const TArray<FExpressionInput*>* SampleConsumers = Consumers.Find(Sample);
+		const bool bSingleChannelOnly = SampleConsumers && SampleConsumers->Num() > 0
+			&& Algo::AllOf(*SampleConsumers, [](const FExpressionInput* Input)
+			{
+				return Input->OutputIndex >= 1 && Input->OutputIndex <= 3;
+			});
+
+		if (bHasOtherInputs || !bSingleChannelOnly)
+		{
+			continue;
+		}
+
+		// 패킹 텍스처는 한 벌의 샘플링 설정만 가지므로 주소 모드/필터/LOD 그룹/밉 생성 설정이 같은 텍스처끼리만 묶음
+		const FString GroupKey = FString::Printf(TEXT("%p.%d|%d|%d|%d|%dx%d|%d,%d|%d|%d|%d"),
+			Sample->Coordinates.Expression.Get(), Sample->Coordinates.OutputIndex, Sample->ConstCoordinate,
+			static_cast<int32>(Sample->SamplerSource.GetValue()), static_cast<int32>(Sample->MipValueMode.GetValue()),
+			Texture->Source.GetSizeX(), Texture->Source.GetSizeY(),
+			static_cast<int32>(Texture->AddressX.GetValue()), static_cast<int32>(Texture->AddressY.GetValue()),
+			static_cast<int32>(Texture->Filter.GetValue()), static_cast<int32>(Texture->LODGroup.GetValue()),
+			static_cast<int32>(Texture->MipGenSettings.GetValue()));
+		SampleGroups.FindOrAdd(GroupKey).Add(Sample);
+	}
+
+	// 3. 그룹별로 최대 4개 텍스처씩 패킹 후 재배선
+	bool bHasChanges = false;
+	for (TPair<FString, TArray<UMaterialExpressionTextureSample*>>& Group : SampleGroups)
+	{
+		TArray<UMaterialExpressionTextureSample*>& Samples = Group.Value;
+		int32 SampleIndex = 0;
+
+		while (SampleIndex < Samples.Num())
+		{
+			// 채널 할당 (같은 텍스처는 같은 채널 공유)
+			TArray<UTexture2D*, TInlineAllocator<4>> ChannelTextures;
+			TArray<TPair<UMaterialExpressionTextureSample*, int32>> PackSamples;
+			for (; SampleIndex < Samples.Num(); ++SampleIndex)
+			{
+				UTexture2D* Texture = Cast<UTexture2D>(Samples[SampleIndex]->Texture);
+				int32 Channel = ChannelTextures.IndexOfByKey(Texture);
+				if (Channel == INDEX_NONE)
+				{
+					if (ChannelTextures.Num() == 4)
+					{
+						break;
+					}
+					Channel = ChannelTextures.Add(Texture);
+				}
+				PackSamples.Emplace(Samples[SampleIndex], Channel);
+			}
+
+			// 같은 텍스처를 여러 노드가 샘플링해도 텍스처가 하나면 패킹할 것이 없음
+			if (ChannelTextures.Num() < 2)
+			{
+				continue;
+			}
+
+			int64 SourceMemory = 0;
+			for (const UTexture2D* Texture : ChannelTextures)
+			{
+				SourceMemory += static_cast<int64>(Texture->CalcTextureMemorySizeEnum(TMC_AllMips));
+			}
+
+			UTexture2D* PackedTexture = CreatePackedTexture(ChannelTextures, RootPath, Material->GetName());
+			if (!PackedTexture)
+			{
+				continue;
+			}
+
+			if (!bHasChanges)
+			{
+				Material->PreEditChange(nullptr);
+				bHasChanges = true;
+			}
+
+			// 첫 번째 노드가 패킹 텍스처를 샘플링하고 나머지 노드의 사용처를 채널 출력으로 연결
+			UMaterialExpressionTextureSample* KeptSample = PackSamples[0].Key;
+			KeptSample->Texture = PackedTexture;
+			KeptSample->SamplerType = SAMPLERTYPE_Masks;
+
+			TArray<TPair<FExpressionInput*, int32>> ChannelInputs;
+			for (const TPair<UMaterialExpressionTextureSample*, int32>& PackSample : PackSamples)
+			{
+				UMaterialExpressionTextureSample* Sample = PackSample.Key;
+
+				// TextureSample 출력: 0 = RGB, 1 = R, 2 = G, 3 = B, 4 = A
+				// Connect는 출력 인덱스와 함께 채널 마스크도 갱신 (마스크가 남으면 원래 샘플러의 채널을 계속 읽음)
+				for (FExpressionInput* Input : Consumers.FindChecked(Sample))
+				{
+					Input->Connect(PackSample.Value + 1, KeptSample);
+					ChannelInputs.Emplace(Input, PackSample.Value);
+				}
+
+				if (Sample != KeptSample)
+				{
+					Material->GetExpressionCollection().RemoveExpression(Sample);
+					Result.SamplersSaved++;
+				}
+			}
+
+			VerifyChannelWiring(KeptSample, ChannelInputs);
+
+			Result.PackedTextures++;
+			Result.MemoryBytesSaved += SourceMemory - static_cast<int64>(PackedTexture->CalcTextureMemorySizeEnum(TMC_AllMips));
+
+			UE_LOG(LogTemp, Log, TEXT("Packed %d grayscale masks into %s for material %s"),
+				ChannelTextures.Num(), *PackedTexture->GetPathName(), *Material->GetPathName());
+		}
+	}
+
+	if (bHasChanges)
+	{
+		Material->PostEditChange();
+		FXAssetMover::SaveAssetPackage(Material);
+	}
+#endif
+
+	return Result;
+}
+
+bool FXTexturePacker::VerifyChannelWiring(const UMaterialExpressionTextureSample* PackedSample, const TArray<TPair<FExpressionInput*, int32>>& ChannelInputs)
+{
+#if WITH_EDITORONLY_DATA
+	bool bAllWired = true;
+	for (const TPair<FExpressionInput*, int32>& ChannelInput : ChannelInputs)
+	{
+		const FExpressionInput* Input = ChannelInput.Key;
+		const int32 Channel = ChannelInput.Value;
+
+		// 패킹 텍스처의 해당 채널 하나만 읽어야 함
+		const bool bWired = Input->Expression == PackedSample
+			&& Input->OutputIndex == Channel + 1
+			&& Input->Mask != 0
+			&& (Input->MaskR != 0) == (Channel == 0)
+			&& (Input->MaskG != 0) == (Channel == 1)
+			&& (Input->MaskB != 0) == (Channel == 2)
+			&& (Input->MaskA != 0) == (Channel == 3);
+
+		if (!bWired)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Packed mask channel %d is miswired in %s (output %d, mask %d%d%d%d)"),
+				Channel, *PackedSample->GetPathName(), Input->OutputIndex, Input->MaskR, Input->MaskG, Input->MaskB, Input->MaskA);
+			bAllWired = false;
+		}
+	}
+	return bAllWired;
+#else
+	return false;
+#endif
+}
+
+bool FXTexturePacker::IsGrayscaleTexture(const UTexture2D* Texture)
+{
+#if WITH_EDITORONLY_DATA
+	if (!Texture || !Texture->Source.IsValid() || Texture->Source.GetNumLayers() != 1 || Texture->Source.GetNumBlocks() != 1)
+	{
+		return false;
+	}
+
+	const ETextureSourceFormat SourceFormat = Texture->Source.GetFormat();
+	return SourceFormat == TSF_G8
+		|| SourceFormat == TSF_G16
+		|| Texture->CompressionSettings == TC_Grayscale
+		|| Texture->CompressionSettings == TC_Alpha;
+#else
+	return false;
+#endif
+}
+
+UTexture2D* FXTexturePacker::CreatePackedTexture(const TArray<UTexture2D*, TInlineAllocator<4>>& ChannelTextures, const FString& RootPath, const FString& BaseName)
+{
+#if WITH_EDITORONLY_DATA
+	if (ChannelTextures.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	const int32 SizeX = ChannelTextures[0]->Source.GetSizeX();
+	const int32 SizeY = ChannelTextures[0]->Source.GetSizeY();
+
+	// BGRA8 버퍼 (사용하지 않는 채널은 0, 알파는 1)
+	TArray64<FColor> PackedPixels;
+	PackedPixels.Init(FColor(0, 0, 0, 255), static_cast<int64>(SizeX) * SizeY);
+
+	for (int32 Channel = 0; Channel < ChannelTextures.Num(); ++Channel)
+	{
+		FImage SourceImage;
+		if (!ChannelTextures[Channel]->Source.GetMipImage(SourceImage, 0))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to read texture source: %s"), *ChannelTextures[Channel]->GetPathName());
+			return nullptr;
+		}
+
+		// 선형 8비트 그레이스케일로 변환 (sRGB 소스도 선형 값으로 저장)
+		FImage GrayImage;
+		SourceImage.CopyTo(GrayImage, ERawImageFormat::G8, EGammaSpace::Linear);
+		const TArrayView64<uint8> GrayPixels = GrayImage.AsG8();
+		if (GrayPixels.Num() != PackedPixels.Num())
+		{
+			return nullptr;
+		}
+
+		for (int64 PixelIndex = 0; PixelIndex < PackedPixels.Num(); ++PixelIndex)
+		{
+			FColor& Pixel = PackedPixels[PixelIndex];
+			switch (Channel)
+			{
+			case 0: Pixel.R = GrayPixels[PixelIndex]; break;
+			case 1: Pixel.G = GrayPixels[PixelIndex]; break;
+			case 2: Pixel.B = GrayPixels[PixelIndex]; break;
+			default: Pixel.A = GrayPixels[PixelIndex]; break;
+			}
+		}
+	}
+
+	// 패킹 텍스처 에셋 생성 (예: /Game/FXLib/Textures/T_M_Smoke_Packed)
+	const FString TextureFolder = FXAssetOrganizer::GetFolderPathForAssetType(RootPath, TEXT(""), TEXT("Texture2D"));
+	if (!FXAssetOrganizer::CreateFolderPath(TextureFolder))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to create folder: %s"), *TextureFolder);
+		return nullptr;
+	}
+
+	IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+	FString PackageName;
+	FString AssetName;
+	AssetTools.CreateUniqueAssetName(TextureFolder / (TEXT("T_") + BaseName + TEXT("_Packed")), TEXT(""), PackageName, AssetName);
+
+	UPackage* Package = CreatePackage(*PackageName);
+	UTexture2D* PackedTexture = NewObject<UTexture2D>(Package, *AssetName, RF_Public | RF_Standalone);
+	PackedTexture->Source.Init(SizeX, SizeY, 1, 1, TSF_BGRA8, reinterpret_cast<const uint8*>(PackedPixels.GetData()));
+	PackedTexture->CompressionSettings = TC_Masks;
+	PackedTexture->SRGB = false;
+
+	// 샘플링 설정은 원본과 동일하게 유지 (그룹 키로 모든 채널 텍스처가 같은 값임이 보장됨)
+	const UTexture2D* SettingsSource = ChannelTextures[0];
+	PackedTexture->AddressX = SettingsSource->AddressX;
+	PackedTexture->AddressY = SettingsSource->AddressY;
+	PackedTexture->Filter = SettingsSource->Filter;
+	PackedTexture->LODGroup = SettingsSource->LODGroup;
+	PackedTexture->MipGenSettings = SettingsSource->MipGenSettings;
+	PackedTexture->PostEditChange();
+
+	FAssetRegistryModule::AssetCreated(PackedTexture);
+	FXAssetMover::SaveAssetPackage(PackedTexture);
+
+	return PackedTexture;
+#else
+	return nullptr;
+#endif
+}
@@ -6,6 +6,7 @@
 // Controller & Model
 #include "Controller/SFXAssetRegistPanelController.h"
 #include "Model/FXLibraryModel.h"
+#include "Model/FXLibrarySubsystem.h"
 
 // Utils
 #include "Utils/FXAssetOrganizer.h"
@@ -13,6 +14,7 @@
 
 // Core
 #include "Core/FXAssetLibConstants.h"
+#include "FXLibrarySettings.h"
 
 // Slate Widgets
 #include "Widgets/Layout/SBorder.h"
@@ -20,6 +22,7 @@
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SComboBox.h"
+#include "Widgets/Input/SCheckBox.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Widgets/SWindow.h"
 #include "Styling/AppStyle.h"
@@ -35,23 +38,18 @@ void SFXAssetRegistPanel::Construct(const FArguments& InArgs)
 	//Controller = MakeShared<SFXAssetRegistPanelController>();
 	//Controller->Initialize(Model);
 
-	// State와 Model 생성
-	TSharedPtr<FFXLibraryState> State = MakeShared<FFXLibraryState>();
-	TSharedPtr<FFXLibraryModel> Model = MakeShared<FFXLibraryModel>();
-	Model->SetState(State);  // ⭐ State를 Model에 설정
+	// 라이브러리 서비스의 공유 Model 사용 (창을 열 때마다 다시 로드하지 않음)
+	UFXLibrarySubsystem* LibrarySubsystem = UFXLibrarySubsystem::Get();
+	TSharedPtr<FFXLibraryModel> Model = LibrarySubsystem ? LibrarySubsystem->GetModel() : nullptr;
 
 	// Controller 생성 및 초기화
 	Controller = MakeShared<SFXAssetRegistPanelController>();
 	Controller->Initialize(Model);
 
-	// 초기 데이터 로드
-	if (Model.IsValid())
-	{
-		Model->LoadFromSettings();
-	}
-
 	// 기본값 설정
 	RootPath = FFXAssetLibConstants::DefaultRootPath;
+	bGenerateCostTiers = GetDefault<UFXLibrarySettings>()->bGenerateCostTiers;
+	bReferenceOnly = GetDefault<UFXLibrarySettings>()->bReferenceOnlyRegistration;
 	
 	// 첫 번째 선택된 에셋의 이름을 기본값으로 사용
 	if (SelectedAssets.Num() > 0)
@@ -174,6 +172,65 @@ void SFXAssetRegistPanel::Construct(const FArguments& InArgs)
 				]
 			]
 
+			// Hashtags
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 0, 0, 10)
+			[
+				SNew(SVerticalBox)
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 0, 0, 5)
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(TEXT("Hashtags")))
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					SNew(SEditableTextBox)
+					.Text(FText::FromString(Hashtags))
+					.OnTextChanged(this, &SFXAssetRegistPanel::OnHashtagsChanged)
+					.IsEnabled_Lambda([this]() { return !bReferenceOnly; })
+					.ToolTipText(FText::FromString(TEXT("Saved as asset registry tags on the copied asset (not written for reference-only registrations)")))
+					.HintText(FText::FromString(TEXT("#fire #smoke")))
+				]
+			]
+
+			// Reference Only
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 0, 0, 5)
+			[
+				SNew(SCheckBox)
+				.IsChecked(bReferenceOnly ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+				.OnCheckStateChanged(this, &SFXAssetRegistPanel::OnReferenceOnlyChanged)
+				.ToolTipText(FText::FromString(TEXT("Register the selected assets in place without copying them or their references")))
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(TEXT("Reference Only (No Copy)")))
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
+				]
+			]
+
+			// Cost Tiers
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 0, 0, 10)
+			[
+				SNew(SCheckBox)
+				.IsEnabled_Lambda([this]() { return !bReferenceOnly; })
+				.IsChecked(bGenerateCostTiers ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+				.OnCheckStateChanged(this, &SFXAssetRegistPanel::OnGenerateCostTiersChanged)
+				.ToolTipText(FText::FromString(TEXT("Generate scaled Low/Medium cost variants next to the registered copy")))
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(TEXT("Generate Cost Tiers")))
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
+				]
+			]
+
 			// 버튼들
 			+ SVerticalBox::Slot()
 			.AutoHeight()
@@ -209,7 +266,7 @@ FReply SFXAssetRegistPanel::OnRegisterClicked()
 		return FReply::Handled();
 	}
 
-	FReply Result = Controller->OnRegisterClicked(RootPath, AssetName, CategoryName, SelectedAssets);
+	FReply Result = Controller->OnRegisterClicked(RootPath, AssetName, CategoryName, Hashtags, SelectedAssets, bGenerateCostTiers && !bReferenceOnly, bReferenceOnly);
 
 	// 창 닫기
 	if (TSharedPtr<SWindow> ParentWindow = FSlateApplication::Get().FindWidgetWindow(AsShared()))
@@ -277,7 +334,7 @@ FReply SFXAssetRegistPanel::OnAddCategoryClicked()
 {
 	// 간단한 입력 다이얼로그 생성
 	FText Title = FText::FromString(TEXT("New Category"));
-	FText Message = FText::FromString(TEXT("Enter category name:"));
+	FText Message = FText::FromString(TEXT("Enter category name (use / to nest, e.g. Fire/Torch/Small):"));
 	FString DefaultValue = TEXT("NewCategory");
 	
 	// 입력 다이얼로그 창 생성
@@ -445,5 +502,15 @@ void SFXAssetRegistPanel::OnHashtagsChanged(const FText& NewText)
 	}
 }
 
+void SFXAssetRegistPanel::OnGenerateCostTiersChanged(ECheckBoxState NewState)
+{
+	bGenerateCostTiers = (NewState == ECheckBoxState::Checked);
+}
+
+void SFXAssetRegistPanel::OnReferenceOnlyChanged(ECheckBoxState NewState)
+{
+	bReferenceOnly = (NewState == ECheckBoxState::Checked);
+}
+
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
@@ -6,6 +6,7 @@
 // Model & Controller
 #include "Model/FXLibraryState.h"
 #include "Model/FXLibraryModel.h"
+#include "Model/FXLibrarySubsystem.h"
 #include "Controller/SFXLibraryPanelController.h"
 
 // Utils
@@ -16,6 +17,7 @@
 #include "View/Widgets/SFXCategoryRowWidget.h"
 #include "View/Widgets/SFXAssetTileWidget.h"
 #include "View/Widgets/SFXCategoryModalWidget.h"
+#include "View/Widgets/SFXQuickSpawnPalette.h"
 
 // Slate Widgets
 #include "Widgets/Layout/SBorder.h"
@@ -23,6 +25,9 @@
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Images/SImage.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/SWindow.h"
 #include "Widgets/Views/STableRow.h"
 #include "Framework/Application/SlateApplication.h"
 
@@ -40,9 +45,13 @@
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 void SFXLibraryPanel::Construct(const FArguments& InArgs)
 {
-	// State와 Model 생성
-	State = MakeShared<FFXLibraryState>();
-	TSharedPtr<FFXLibraryModel> Model = MakeShared<FFXLibraryModel>();
+	// 라이브러리 서비스의 공유 State와 Model 사용 (이미 로드되어 있음)
+	TSharedPtr<FFXLibraryModel> Model;
+	if (UFXLibrarySubsystem* LibrarySubsystem = UFXLibrarySubsystem::Get())
+	{
+		State = LibrarySubsystem->GetState();
+		Model = LibrarySubsystem->GetModel();
+	}
 	
 	// Controller 생성 및 초기화
 	Controller = MakeShared<SFXLibraryPanelController>();
@@ -51,12 +60,6 @@ void SFXLibraryPanel::Construct(const FArguments& InArgs)
 	// State 변경 델리게이트 바인딩
 	BindStateDelegates();
 
-	// 초기 데이터 로드
-	if (Model.IsValid())
-	{
-		Model->LoadFromSettings();
-	}
-
 	// ⭐ 여기에 추가: ListItemsSource 포인터 초기화
 	if (State.IsValid())
 	{
@@ -160,6 +163,7 @@ void SFXLibraryPanel::Construct(const FArguments& InArgs)
 					// Clean Up 버튼
 					+ SHorizontalBox::Slot()
 						.AutoWidth()
+						.Padding(0, 0, 5, 0)
 						[
 							SNew(SButton)
 								.Text(FText::FromString(TEXT("Clean Up")))
@@ -196,6 +200,47 @@ void SFXLibraryPanel::Construct(const FArguments& InArgs)
 										]
 								]
 						]
+
+					// Quick Spawn 버튼
+					+ SHorizontalBox::Slot()
+						.AutoWidth()
+						[
+							SNew(SButton)
+								.Text(FText::FromString(TEXT("Quick Spawn")))
+								.ToolTipText(FText::FromString(TEXT("Find an effect by name across all categories and spawn it (Ctrl+K)")))
+								.OnClicked_Lambda([this]()
+									{
+										OpenQuickSpawnPalette();
+										return FReply::Handled();
+									})
+								.HAlign(HAlign_Center)
+								.VAlign(VAlign_Center)
+								[
+									SNew(SHorizontalBox)
+
+										+ SHorizontalBox::Slot()
+										.AutoWidth()
+										.VAlign(VAlign_Center)
+										.Padding(0, 0, 5, 0)
+										[
+											SNew(SBox)
+												.WidthOverride(16)
+												.HeightOverride(16)
+												[
+													SNew(SImage)
+														.Image(FAppStyle::GetBrush("Icons.Search"))
+												]
+										]
+
+										+ SHorizontalBox::Slot()
+										.AutoWidth()
+										.VAlign(VAlign_Center)
+										[
+											SNew(STextBlock)
+												.Text(FText::FromString(TEXT("Quick Spawn")))
+										]
+								]
+						]
 				]
 
 			// 메인 컨텐츠
@@ -258,6 +303,15 @@ void SFXLibraryPanel::Construct(const FArguments& InArgs)
 															SNew(STextBlock)
 																.Text_Lambda([this]()
 																	{
+																		if (State.IsValid() && State->IsSimilarityActive())
+																		{
+																			return FText::FromString(FString::Printf(TEXT("Similar to %s (%d)"),
+																				*State->GetSimilarSource().GetAssetName(), FMath::Max(0, State->VisibleAssets.Num() - 1)));
+																		}
+																		if (State.IsValid() && State->IsSearchActive())
+																		{
+																			return FText::FromString(FString::Printf(TEXT("Search Results (%d)"), State->VisibleAssets.Num()));
+																		}
 																		if (State.IsValid() && State->SelectedCategory.IsValid())
 																		{
 																			return FText::FromName(*State->SelectedCategory);
@@ -267,6 +321,18 @@ void SFXLibraryPanel::Construct(const FArguments& InArgs)
 														]
 												]
 										]
+
+										// 검색 (모든 카테고리 대상)
+										+ SHorizontalBox::Slot()
+										.FillWidth(1.0f)
+										.Padding(10, 0, 0, 0)
+										.VAlign(VAlign_Center)
+										[
+											SAssignNew(SearchBox, SSearchBox)
+												.HintText(FText::FromString(TEXT("Search all categories (name, #tag, cat:, class:, -exclude)")))
+												.InitialText(State.IsValid() ? FText::FromString(State->GetSearchText()) : FText::GetEmpty())
+												.OnTextChanged(this, &SFXLibraryPanel::OnSearchTextChanged)
+										]
 								]
 
 								+ SVerticalBox::Slot()
@@ -282,8 +348,8 @@ void SFXLibraryPanel::Construct(const FArguments& InArgs)
 				]
 		];
 
-	// 첫 번째 카테고리 선택
-	if (State.IsValid() && State->Categories.Num() > 0)
+	// 첫 번째 카테고리 선택 (다른 패널에서 이미 선택한 카테고리가 있으면 유지)
+	if (State.IsValid() && !State->SelectedCategory.IsValid() && State->Categories.Num() > 0)
 	{
 		Controller->OnCategoryChanged(State->Categories[0]);
 		RefreshUI();
@@ -296,23 +362,45 @@ void SFXLibraryPanel::BindStateDelegates()
 {
 	if (State.IsValid())
 	{
-		State->OnStateChanged.AddLambda([this]()
-			{
-				RefreshUI();
-			});
+		// State는 서비스가 소유하므로 패널이 닫히면 자동으로 해제되도록 AddSP 사용
+		State->OnStateChanged.AddSP(this, &SFXLibraryPanel::RefreshUI);
+		State->OnVisibleAssetsChanged.AddSP(this, &SFXLibraryPanel::OnVisibleAssetsChanged);
 	}
 }
 
 void SFXLibraryPanel::RefreshUI()
 {
-	if (AssetTileView.IsValid())
-	{
-		AssetTileView->RequestListRefresh();
-	}
+	// 타일 목록은 OnVisibleAssetsChanged에서 변경분만 갱신
 	if (CategoryButton.IsValid())
 	{
 		CategoryButton->Invalidate(EInvalidateWidgetReason::Paint);
 	}
+
+	// 열려 있는 카테고리 트리는 노드가 추가/제거된 경우만 갱신
+	if (CategorySubWidget.IsValid())
+	{
+		CategorySubWidget->RefreshTree();
+	}
+}
+
+void SFXLibraryPanel::OnVisibleAssetsChanged(const FFXVisibleAssetsDelta& Delta)
+{
+	if (!AssetTileView.IsValid())
+	{
+		return;
+	}
+
+	// 제거된 항목은 선택에서도 해제 (남은 항목의 타일/썸네일은 그대로 재사용)
+	for (const TSharedPtr<FSoftObjectPath>& Item : Delta.Removed)
+	{
+		if (AssetTileView->IsItemSelected(Item))
+		{
+			AssetTileView->SetItemSelection(Item, false, ESelectInfo::Direct);
+		}
+	}
+
+	// 항목 소스(State->VisibleAssets)는 State가 이미 패치했으므로 새 항목의 타일만 생성됨
+	AssetTileView->RequestListRefresh();
 }
 
 TSharedRef<ITableRow> SFXLibraryPanel::GenAssetTile(TSharedPtr<FSoftObjectPath> Item, const TSharedRef<STableViewBase>& Owner)
@@ -324,9 +412,15 @@ TSharedRef<ITableRow> SFXLibraryPanel::GenAssetTile(TSharedPtr<FSoftObjectPath>
 
 	FString AssetName = Item->GetAssetName();
 
-	// Asset Registry에서 FAssetData 가져오기
+	// 변형 항목은 "에셋 이름 (변형 이름)"으로 표시
+	if (FFXAssetVariant::IsVariantEntry(*Item))
+	{
+		AssetName = FString::Printf(TEXT("%s (%s)"), *AssetName, *Item->GetSubPathString());
+	}
+
+	// Asset Registry에서 FAssetData 가져오기 (변형은 기본 에셋 썸네일 사용)
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	FAssetData AssetData = AssetRegistryModule.Get().GetAssetByObjectPath(*Item);
+	FAssetData AssetData = AssetRegistryModule.Get().GetAssetByObjectPath(Item->GetWithoutSubPath());
 
 	// 썸네일 생성
 	TSharedPtr<FAssetThumbnail> Thumbnail = FFXUIUtils::CreateAssetThumbnail(
@@ -341,7 +435,8 @@ TSharedRef<ITableRow> SFXLibraryPanel::GenAssetTile(TSharedPtr<FSoftObjectPath>
 		.AssetPath(Item)
 		.ParentPanel(this)
 		.Thumbnail(Thumbnail)
-		.AssetName(AssetName);
+		.AssetName(AssetName)
+		.bIsReferenced(State.IsValid() && State->IsReferencedAsset(*Item));
 
 	// 좌클릭으로 스폰
 	return SNew(STableRow<TSharedPtr<FSoftObjectPath>>, Owner)
@@ -396,6 +491,14 @@ void SFXLibraryPanel::OnBrowseToAsset(TSharedPtr<FSoftObjectPath> AssetPath)
 	}
 }
 
+void SFXLibraryPanel::OnSpawnAssetTier(TSharedPtr<FSoftObjectPath> AssetPath, FName TierName)
+{
+	if (Controller.IsValid())
+	{
+		Controller->SpawnNiagaraActorTier(AssetPath, TierName);
+	}
+}
+
 void SFXLibraryPanel::OnRemoveAssetFromLibrary(TSharedPtr<FSoftObjectPath> AssetPath)
 {
 	if (Controller.IsValid())
@@ -405,6 +508,96 @@ void SFXLibraryPanel::OnRemoveAssetFromLibrary(TSharedPtr<FSoftObjectPath> Asset
 	}
 }
 
+void SFXLibraryPanel::OnFindSimilarAssets(TSharedPtr<FSoftObjectPath> AssetPath)
+{
+	if (!Controller.IsValid())
+	{
+		return;
+	}
+
+	// 유사 보기는 검색어를 대체 (State가 검색어를 비우므로 입력창도 맞춤)
+	if (SearchBox.IsValid() && !SearchBox->GetText().IsEmpty())
+	{
+		SearchBox->SetText(FText::GetEmpty());
+	}
+
+	Controller->FindSimilarAssets(AssetPath);
+}
+
+void SFXLibraryPanel::OnCreateVariantFromSelection(TSharedPtr<FSoftObjectPath> AssetPath)
+{
+	if (!Controller.IsValid() || !AssetPath.IsValid())
+	{
+		return;
+	}
+
+	// 변형 이름 입력 다이얼로그
+	TSharedRef<SWindow> InputWindow = SNew(SWindow)
+		.Title(FText::FromString(TEXT("New Variant")))
+		.SizingRule(ESizingRule::Autosized)
+		.SupportsMaximize(false)
+		.SupportsMinimize(false);
+
+	TSharedPtr<SEditableTextBox> InputTextBox;
+
+	InputWindow->SetContent(
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(20, 20, 20, 10)
+		[
+			SNew(STextBlock)
+				.Text(FText::FromString(TEXT("Save the selected actor's user parameters as a variant named:")))
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(20, 0, 20, 20)
+		[
+			SAssignNew(InputTextBox, SEditableTextBox)
+				.Text(FText::FromString(TEXT("Variant")))
+				.SelectAllTextWhenFocused(true)
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.HAlign(HAlign_Right)
+		.Padding(20, 0, 20, 20)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(5, 0)
+			[
+				SNew(SButton)
+					.Text(FText::FromString(TEXT("Cancel")))
+					.OnClicked_Lambda([InputWindow]()
+						{
+							InputWindow->RequestDestroyWindow();
+							return FReply::Handled();
+						})
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(5, 0)
+			[
+				SNew(SButton)
+					.Text(FText::FromString(TEXT("Save")))
+					.ButtonStyle(FAppStyle::Get(), "PrimaryButton")
+					.OnClicked_Lambda([this, InputWindow, InputTextBox, AssetPath]()
+						{
+							FString VariantName = InputTextBox->GetText().ToString().TrimStartAndEnd();
+							if (!VariantName.IsEmpty() && Controller.IsValid())
+							{
+								Controller->CreateVariantFromSelection(AssetPath, *VariantName);
+							}
+							InputWindow->RequestDestroyWindow();
+							return FReply::Handled();
+						})
+			]
+		]);
+
+	FSlateApplication::Get().AddModalWindow(InputWindow, nullptr);
+}
+
 FReply SFXLibraryPanel::OnCategoryButtonMouseDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
 	if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton && CategoryButton.IsValid())
@@ -447,6 +640,63 @@ FReply SFXLibraryPanel::OnCategoryButtonMouseUp(const FGeometry& MyGeometry, con
 	return FReply::Unhandled();
 }
 
+void SFXLibraryPanel::OnSearchTextChanged(const FText& NewText)
+{
+	if (Controller.IsValid())
+	{
+		Controller->OnSearchTextChanged(NewText);
+	}
+}
+
+FReply SFXLibraryPanel::OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent)
+{
+	// Ctrl+K: 빠른 스폰 팔레트
+	if (InKeyEvent.GetKey() == EKeys::K && InKeyEvent.IsControlDown() && !InKeyEvent.IsAltDown() && !InKeyEvent.IsShiftDown())
+	{
+		OpenQuickSpawnPalette();
+		return FReply::Handled();
+	}
+
+	return SCompoundWidget::OnKeyDown(MyGeometry, InKeyEvent);
+}
+
+void SFXLibraryPanel::OpenQuickSpawnPalette()
+{
+	if (!State.IsValid() || !Controller.IsValid())
+	{
+		return;
+	}
+
+	CloseCategorySubWidget();
+
+	TWeakPtr<SFXLibraryPanelController> WeakController = Controller;
+	TSharedRef<SFXQuickSpawnPalette> Palette = SNew(SFXQuickSpawnPalette)
+		.State(State)
+		.OnSpawn_Lambda([WeakController](TSharedPtr<FSoftObjectPath> AssetPath)
+			{
+				if (TSharedPtr<SFXLibraryPanelController> PinnedController = WeakController.Pin())
+				{
+					PinnedController->SpawnNiagaraActor(AssetPath);
+				}
+			});
+
+	// 패널 상단 중앙에 표시
+	const FGeometry& PanelGeometry = GetCachedGeometry();
+	const FVector2D PanelSize = PanelGeometry.GetAbsoluteSize();
+	const FVector2D PalettePosition = PanelGeometry.GetAbsolutePosition()
+		+ FVector2D(FMath::Max(0.0, (PanelSize.X - FFXAssetLibConstants::QuickSpawnPaletteSize.X) * 0.5), 30.0);
+
+	FSlateApplication::Get().PushMenu(
+		AsShared(),
+		FWidgetPath(),
+		Palette,
+		PalettePosition,
+		FPopupTransitionEffect(FPopupTransitionEffect::None)
+	);
+
+	FSlateApplication::Get().SetKeyboardFocus(Palette->GetWidgetToFocus(), EFocusCause::SetDirectly);
+}
+
 void SFXLibraryPanel::CloseCategorySubWidget()
 {
 	if (bIsSubWidgetVisible)
@@ -464,6 +714,13 @@ void SFXLibraryPanel::OnCategorySelected(TSharedPtr<FName> Category)
 	{
 		UE_LOG(LogTemp, Log, TEXT("OnCategorySelected called with category: %s"), *Category->ToString());
 
+		// 카테고리를 고르면 검색을 끝내고 해당 카테고리 표시
+		if (SearchBox.IsValid() && !SearchBox->GetText().IsEmpty())
+		{
+			SearchBox->SetText(FText::GetEmpty());
+			Controller->OnSearchTextChanged(FText::GetEmpty());
+		}
+
 		// 1. Controller를 통해 카테고리 변경 (State 업데이트)
 		Controller->OnCategoryChanged(Category);
 
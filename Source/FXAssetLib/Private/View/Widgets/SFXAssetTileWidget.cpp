@@ -2,10 +2,13 @@
 
 #include "View/Widgets/SFXAssetTileWidget.h"
 #include "View/SFXLibraryPanel.h"
+#include "FXLibrarySettings.h"
+#include "Utils/FXAssetTierGenerator.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SBox.h"
 //#include "Widgets/Layout/SVerticalBox.h"
 #include "Widgets/Text/STextBlock.h"
+#include "Widgets/Images/SImage.h"
 #include "AssetThumbnail.h"
 #include "Styling/CoreStyle.h"
 #include "Styling/AppStyle.h"
@@ -18,6 +21,7 @@ void SFXAssetTileWidget::Construct(const FArguments& InArgs)
 	ParentPanel = InArgs._ParentPanel;
 	Thumbnail = InArgs._Thumbnail;
 	AssetName = InArgs._AssetName;
+	bIsReferenced = InArgs._bIsReferenced;
 
 	ChildSlot
 		[
@@ -40,7 +44,24 @@ void SFXAssetTileWidget::Construct(const FArguments& InArgs)
 								.WidthOverride(90)
 								.HeightOverride(90)
 								[
-									Thumbnail.IsValid() ? Thumbnail->MakeThumbnailWidget() : SNew(SBox)
+									SNew(SOverlay)
+
+										+ SOverlay::Slot()
+										[
+											Thumbnail.IsValid() ? Thumbnail->MakeThumbnailWidget() : SNew(SBox)
+										]
+
+										// 참조 전용 항목 표시 (라이브러리가 소유하지 않은 원본)
+										+ SOverlay::Slot()
+										.HAlign(HAlign_Right)
+										.VAlign(VAlign_Top)
+										.Padding(2)
+										[
+											SNew(SImage)
+												.Visibility(bIsReferenced ? EVisibility::Visible : EVisibility::Collapsed)
+												.Image(FAppStyle::GetBrush("Icons.Link"))
+												.ToolTipText(FText::FromString(TEXT("Referenced in place (not copied into the library)")))
+										]
 								]
 						]
 
@@ -83,6 +104,67 @@ FReply SFXAssetTileWidget::OnMouseButtonUp(const FGeometry& MyGeometry, const FP
 				}))
 		);
 
+		// 유사 이펙트 보기 메뉴 항목 (특징 벡터 최근접 이웃)
+		MenuBuilder.AddMenuEntry(
+			FText::FromString(TEXT("Find Similar Effects")),
+			FText::FromString(TEXT("Show library effects with the closest emitter, renderer, spawn, color and texture profile")),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Search"),
+			FUIAction(FExecuteAction::CreateLambda([this]()
+				{
+					if (ParentPanel && AssetPath.IsValid())
+					{
+						ParentPanel->OnFindSimilarAssets(AssetPath);
+					}
+				}))
+		);
+
+		// 파라미터 오버라이드 변형 저장 메뉴 항목
+		MenuBuilder.AddMenuEntry(
+			FText::FromString(TEXT("Save Selected Actor as Variant...")),
+			FText::FromString(TEXT("Store the selected Niagara actor's user parameters as a lightweight variant of this asset")),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Duplicate"),
+			FUIAction(FExecuteAction::CreateLambda([this]()
+				{
+					if (ParentPanel && AssetPath.IsValid())
+					{
+						ParentPanel->OnCreateVariantFromSelection(AssetPath);
+					}
+				}))
+		);
+
+		// 비용 티어 변형 스폰 메뉴 항목 (생성된 티어만 표시)
+		if (AssetPath.IsValid())
+		{
+			bool bHasTierSection = false;
+			for (const FFXCostTierSettings& Tier : GetDefault<UFXLibrarySettings>()->CostTiers)
+			{
+				if (!FXAssetTierGenerator::FindTierVariant(*AssetPath, Tier.TierName).IsValid())
+				{
+					continue;
+				}
+
+				if (!bHasTierSection)
+				{
+					MenuBuilder.AddMenuSeparator();
+					bHasTierSection = true;
+				}
+
+				const FName TierName = Tier.TierName;
+				MenuBuilder.AddMenuEntry(
+					FText::FromString(FString::Printf(TEXT("Spawn %s Tier"), *TierName.ToString())),
+					FText::FromString(FString::Printf(TEXT("Spawn the %s cost tier variant of this asset"), *TierName.ToString())),
+					FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Plus"),
+					FUIAction(FExecuteAction::CreateLambda([this, TierName]()
+						{
+							if (ParentPanel && AssetPath.IsValid())
+							{
+								ParentPanel->OnSpawnAssetTier(AssetPath, TierName);
+							}
+						}))
+				);
+			}
+		}
+
 		// 구분선
 		MenuBuilder.AddMenuSeparator();
 
@@ -4,6 +4,7 @@
 #include "View/SFXLibraryPanel.h"
 #include "View/Widgets/SFXCategoryRowWidget.h"
 #include "Model/FXLibraryState.h"
+#include "Model/FXCategoryTree.h"
 #include "Core/FXAssetLibConstants.h"
 
 #include "Widgets/Layout/SBorder.h"
@@ -11,15 +12,19 @@
 #include "Widgets/Views/STableRow.h"
 #include "Styling/CoreStyle.h"
 #include "Styling/AppStyle.h"
+#include "Brushes/SlateDynamicImageBrush.h"
+#include "Engine/Texture2D.h"
 
 void SFXCategoryModalWidget::Construct(const FArguments& InArgs)
 {
 	ParentPanel = InArgs._ParentPanel;
 	State = InArgs._State;
 
+	const TArray<TSharedPtr<FFXCategoryTreeNode>>* RootNodes = nullptr;
 	if (State.IsValid())
 	{
-		CategoryListSource = &State->Categories;
+		RootNodes = &State->GetCategoryTree().GetRootNodes();
+		TreeVersion = State->GetCategoryTree().GetVersion();
 	}
 
 	ChildSlot
@@ -32,54 +37,128 @@ void SFXCategoryModalWidget::Construct(const FArguments& InArgs)
 						.WidthOverride(300)
 						.HeightOverride(400)
 						[
-							SAssignNew(CategoryListView, SListView<TSharedPtr<FName>>)
-								.ListItemsSource(CategoryListSource)
+							// 펼쳐진 노드의 하위만 순회하고 화면에 보이는 행만 생성
+							SAssignNew(CategoryTreeView, STreeView<TSharedPtr<FFXCategoryTreeNode>>)
+								.TreeItemsSource(RootNodes)
 								.OnGenerateRow(this, &SFXCategoryModalWidget::GenerateCategoryRow)
-								.ItemHeight(120)
+								.OnGetChildren(this, &SFXCategoryModalWidget::GetCategoryChildren)
+								.OnExpansionChanged(this, &SFXCategoryModalWidget::OnCategoryExpansionChanged)
+								.SelectionMode(ESelectionMode::Single)
 						]
 				]
 		];
+
+	RestoreExpansion();
+}
+
+void SFXCategoryModalWidget::RefreshTree()
+{
+	if (!State.IsValid() || !CategoryTreeView.IsValid())
+	{
+		return;
+	}
+
+	// 항목 추가/제거로 바뀐 수는 행의 텍스트 바인딩이 반영하므로 노드가 추가/제거된 경우만 갱신
+	const uint32 NewVersion = State->GetCategoryTree().GetVersion();
+	if (NewVersion == TreeVersion)
+	{
+		return;
+	}
+
+	TreeVersion = NewVersion;
+	RestoreExpansion();
+	CategoryTreeView->RequestTreeRefresh();
 }
 
-TSharedRef<ITableRow> SFXCategoryModalWidget::GenerateCategoryRow(TSharedPtr<FName> Item, const TSharedRef<STableViewBase>& Owner)
+TSharedRef<ITableRow> SFXCategoryModalWidget::GenerateCategoryRow(TSharedPtr<FFXCategoryTreeNode> Item, const TSharedRef<STableViewBase>& Owner)
 {
 	if (!Item.IsValid() || !State.IsValid())
 	{
-		return SNew(STableRow<TSharedPtr<FName>>, Owner);
+		return SNew(STableRow<TSharedPtr<FFXCategoryTreeNode>>, Owner);
 	}
 
-	FName CategoryName = *Item;
+	return SNew(SFXCategoryRowWidget, Owner)
+		.Node(Item)
+		.IconBrush(Item->IsCategory() ? GetCategoryIconBrush(*Item->Category) : nullptr)
+		.ParentPanel(ParentPanel);
+}
+
+void SFXCategoryModalWidget::GetCategoryChildren(TSharedPtr<FFXCategoryTreeNode> Item, TArray<TSharedPtr<FFXCategoryTreeNode>>& OutChildren)
+{
+	if (Item.IsValid())
+	{
+		OutChildren = Item->Children;
+	}
+}
 
-	// 배경 이미지 브러시 로드
-	FSlateBrush* BackgroundBrush = nullptr;
-	const FSoftObjectPath* IconPath = State->CategoryIcons.Find(CategoryName);
+void SFXCategoryModalWidget::OnCategoryExpansionChanged(TSharedPtr<FFXCategoryTreeNode> Item, bool bExpanded)
+{
+	if (!Item.IsValid() || !State.IsValid())
+	{
+		return;
+	}
 
-	if (IconPath && IconPath->IsValid())
+	if (bExpanded)
+	{
+		State->ExpandedCategoryPaths.Add(Item->Path);
+	}
+	else
+	{
+		State->ExpandedCategoryPaths.Remove(Item->Path);
+	}
+}
+
+void SFXCategoryModalWidget::RestoreExpansion()
+{
+	if (!State.IsValid() || !CategoryTreeView.IsValid())
+	{
+		return;
+	}
+
+	const FFXCategoryTree& CategoryTree = State->GetCategoryTree();
+	for (const FName& Path : State->ExpandedCategoryPaths.Array())
+	{
+		if (TSharedPtr<FFXCategoryTreeNode> Node = CategoryTree.FindNode(Path))
+		{
+			CategoryTreeView->SetItemExpansion(Node, true);
+		}
+	}
+
+	// 선택된 카테고리가 보이도록 조상 노드를 펼침
+	if (State->SelectedCategory.IsValid())
 	{
-		UObject* LoadedObject = IconPath->TryLoad();
-		if (LoadedObject)
+		if (TSharedPtr<FFXCategoryTreeNode> SelectedNode = CategoryTree.FindCategoryNode(*State->SelectedCategory))
 		{
-			UTexture2D* BgTexture = Cast<UTexture2D>(LoadedObject);
-			if (BgTexture)
+			for (TSharedPtr<FFXCategoryTreeNode> Parent = SelectedNode->Parent.Pin(); Parent.IsValid(); Parent = Parent->Parent.Pin())
 			{
-				BackgroundBrush = new FSlateDynamicImageBrush(
-					BgTexture,
-					FFXAssetLibConstants::CategoryTileSize,
-					BgTexture->GetFName()
-				);
+				CategoryTreeView->SetItemExpansion(Parent, true);
 			}
+			CategoryTreeView->SetItemSelection(SelectedNode, true, ESelectInfo::Direct);
+			CategoryTreeView->RequestScrollIntoView(SelectedNode);
 		}
 	}
+}
 
-	if (!BackgroundBrush)
+const FSlateBrush* SFXCategoryModalWidget::GetCategoryIconBrush(FName CategoryName)
+{
+	// 아이콘이 없거나 로드에 실패한 카테고리도 기록하여 다시 로드하지 않음
+	if (const TSharedPtr<FSlateBrush>* Existing = IconBrushes.Find(CategoryName))
 	{
-		BackgroundBrush = new FSlateColorBrush(FLinearColor(0.15f, 0.15f, 0.2f, 1.0f));
+		return Existing->Get();
 	}
 
-	return SNew(SFXCategoryRowWidget, Owner)
-		.CategoryName(Item)
-		.BackgroundBrush(BackgroundBrush)
-		.ParentPanel(ParentPanel)
-		.HoveredCategory(State->HoveredCategory);
+	TSharedPtr<FSlateBrush>& Brush = IconBrushes.Add(CategoryName);
+	const FSoftObjectPath* IconPath = State->CategoryIcons.Find(CategoryName);
+	if (IconPath && IconPath->IsValid())
+	{
+		if (UTexture2D* IconTexture = Cast<UTexture2D>(IconPath->TryLoad()))
+		{
+			Brush = MakeShared<FSlateDynamicImageBrush>(
+				IconTexture,
+				FFXAssetLibConstants::CategoryIconSize,
+				IconTexture->GetFName()
+			);
+		}
+	}
+	return Brush.Get();
 }
-
@@ -2,29 +2,27 @@
 
 #include "View/Widgets/SFXCategoryRowWidget.h"
 #include "View/SFXLibraryPanel.h"
-#include "Widgets/Layout/SBorder.h"
+#include "Core/FXAssetLibConstants.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Images/SImage.h"
 #include "Widgets/Input/SButton.h"
 #include "Styling/CoreStyle.h"
+#include "Styling/AppStyle.h"
 
 void SFXCategoryRowWidget::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable)
 {
-	CategoryName = InArgs._CategoryName;
-	BackgroundBrush = InArgs._BackgroundBrush;
+	Node = InArgs._Node;
+	IconBrush = InArgs._IconBrush;
 	ParentPanel = InArgs._ParentPanel;
-	HoveredCategory = InArgs._HoveredCategory;
 
-	STableRow<TSharedPtr<FName>>::Construct(
-		STableRow<TSharedPtr<FName>>::FArguments(),
+	// 트리 모드의 행은 내용 앞에 펼치기 화살표가 붙음
+	STableRow<TSharedPtr<FFXCategoryTreeNode>>::Construct(
+		STableRow<TSharedPtr<FFXCategoryTreeNode>>::FArguments(),
 		InOwnerTable
 	);
 
-	// 호버 상태에 따라 색상 변경
-	bool bIsHovered = (HoveredCategory.IsValid() && CategoryName.IsValid() && *HoveredCategory == *CategoryName);
-	FLinearColor BorderColor = bIsHovered ? FLinearColor::White : FLinearColor(0.7f, 0.7f, 0.7f, 1.0f);
-	FLinearColor ImageTint = bIsHovered ? FLinearColor::White : FLinearColor(0.5f, 0.5f, 0.5f, 1.0f);
+	const bool bIsCategory = Node.IsValid() && Node->IsCategory();
 
 	SetContent(
 		SNew(SButton)
@@ -32,77 +30,107 @@ void SFXCategoryRowWidget::Construct(const FArguments& InArgs, const TSharedRef<
 		.Cursor(EMouseCursor::Hand)
 		.OnClicked_Lambda([this]() -> FReply
 			{
-				if (ParentPanel && CategoryName.IsValid())
+				if (!Node.IsValid())
 				{
-					UE_LOG(LogTemp, Log, TEXT("SFXCategoryRowWidget::OnClicked - Category: %s"), *CategoryName->ToString());
+					return FReply::Unhandled();
+				}
+
+				// 폴더 노드는 선택할 카테고리가 없으므로 펼치기/접기
+				if (!Node->IsCategory())
+				{
+					ToggleExpansion();
+					return FReply::Handled();
+				}
+
+				if (ParentPanel)
+				{
+					UE_LOG(LogTemp, Log, TEXT("SFXCategoryRowWidget::OnClicked - Category: %s"), *Node->Category->ToString());
 					// 클릭 시 카테고리 선택
-					ParentPanel->OnCategorySelected(CategoryName);
+					ParentPanel->OnCategorySelected(Node->Category);
 					return FReply::Handled();
 				}
 				return FReply::Unhandled();
 			})
 		[
-			SNew(SBorder)
-			.BorderImage(BackgroundBrush)
-			.BorderBackgroundColor(BorderColor)
-			.Padding(10)
-			[
-				SNew(SBox)
-					.HeightOverride(120)
-					[
-						SNew(SOverlay)
+			SNew(SBox)
+				.HeightOverride(FFXAssetLibConstants::CategoryRowHeight)
+				.Padding(FMargin(2, 0))
+				[
+					SNew(SHorizontalBox)
 
-							// 배경 이미지 (호버 시 채도 복원)
-							+ SOverlay::Slot()
-							[
-								SNew(SImage)
-									.Image(BackgroundBrush)
-									.ColorAndOpacity(ImageTint)
-							]
+						// 아이콘 (카테고리 아이콘이 없으면 폴더)
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(0, 0, 6, 0)
+						[
+							SNew(SBox)
+								.WidthOverride(FFXAssetLibConstants::CategoryIconSize.X)
+								.HeightOverride(FFXAssetLibConstants::CategoryIconSize.Y)
+								[
+									SNew(SImage)
+										.Image(this, &SFXCategoryRowWidget::GetIconBrush)
+								]
+						]
 
-							// 어두운 오버레이 (호버 시 투명도 감소)
-							+ SOverlay::Slot()
-							[
-								SNew(SImage)
-									.Image(new FSlateColorBrush(FLinearColor(0, 0, 0, bIsHovered ? 0.2f : 0.5f)))
-							]
+						// 카테고리 이름 (마지막 경로 구간)
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+								.Text(FText::FromString(Node.IsValid() ? Node->Label : FString()))
+								.ToolTipText(FText::FromName(Node.IsValid() ? Node->Path : NAME_None))
+								.Font(FCoreStyle::GetDefaultFontStyle(bIsCategory ? "Bold" : "Regular", 10))
+								.ColorAndOpacity_Lambda([this]()
+									{
+										return IsHovered() ? FLinearColor::White : FLinearColor(0.8f, 0.8f, 0.8f, 1.0f);
+									})
+						]
 
-							// 카테고리 이름
-							+ SOverlay::Slot()
-							.HAlign(HAlign_Center)
-							.VAlign(VAlign_Center)
-							[
-								SNew(STextBlock)
-									.Text(FText::FromName(CategoryName.IsValid() ? *CategoryName : NAME_None))
-									.Font(FCoreStyle::GetDefaultFontStyle("Bold", bIsHovered ? 20 : 18))
-									.ColorAndOpacity(FLinearColor::White)
-									.Justification(ETextJustify::Center)
-									.ShadowOffset(FVector2D(2, 2))
-									.ShadowColorAndOpacity(FLinearColor::Black)
-							]
-					]
-			]
+						// 하위 포함 항목 수 (State가 증분 유지)
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(6, 0, 4, 0)
+						[
+							SNew(STextBlock)
+								.Text_Lambda([this]()
+									{
+										return FText::AsNumber(Node.IsValid() ? Node->SubtreeAssetCount : 0);
+									})
+								.ColorAndOpacity(FLinearColor(0.5f, 0.5f, 0.5f, 1.0f))
+						]
+				]
 		]
 	);
 }
 
+const FSlateBrush* SFXCategoryRowWidget::GetIconBrush() const
+{
+	if (IconBrush)
+	{
+		return IconBrush;
+	}
+	return FAppStyle::GetBrush(IsItemExpanded() ? "Icons.FolderOpen" : "Icons.FolderClosed");
+}
+
 void SFXCategoryRowWidget::OnMouseEnter(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
-	STableRow<TSharedPtr<FName>>::OnMouseEnter(MyGeometry, MouseEvent);
+	STableRow<TSharedPtr<FFXCategoryTreeNode>>::OnMouseEnter(MyGeometry, MouseEvent);
 
-	if (ParentPanel && CategoryName.IsValid())
+	if (ParentPanel && Node.IsValid() && Node->IsCategory())
 	{
-		ParentPanel->OnCategoryHovered(CategoryName);
+		ParentPanel->OnCategoryHovered(Node->Category);
 	}
 }
 
 void SFXCategoryRowWidget::OnMouseLeave(const FPointerEvent& MouseEvent)
 {
-	STableRow<TSharedPtr<FName>>::OnMouseLeave(MouseEvent);
+	STableRow<TSharedPtr<FFXCategoryTreeNode>>::OnMouseLeave(MouseEvent);
 
 	if (ParentPanel)
 	{
 		ParentPanel->OnCategoryUnhovered();
 	}
 }
-
@@ -0,0 +1,256 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "View/Widgets/SFXQuickSpawnPalette.h"
+#include "Model/FXLibraryState.h"
+#include "Core/FXAssetLibConstants.h"
+
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Views/STableRow.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Styling/CoreStyle.h"
+#include "Styling/AppStyle.h"
+
+void SFXQuickSpawnPalette::Construct(const FArguments& InArgs)
+{
+	State = InArgs._State;
+	OnSpawn = InArgs._OnSpawn;
+
+	BuildCandidates();
+
+	ChildSlot
+		[
+			SNew(SBorder)
+				.BorderImage(FAppStyle::GetBrush("Menu.Background"))
+				.Padding(5)
+				[
+					SNew(SBox)
+						.WidthOverride(FFXAssetLibConstants::QuickSpawnPaletteSize.X)
+						.HeightOverride(FFXAssetLibConstants::QuickSpawnPaletteSize.Y)
+						[
+							SNew(SVerticalBox)
+
+								+ SVerticalBox::Slot()
+								.AutoHeight()
+								.Padding(0, 0, 0, 5)
+								[
+									SAssignNew(SearchBox, SSearchBox)
+										.HintText(FText::FromString(TEXT("Spawn effect by name (typos allowed)")))
+										.OnTextChanged(this, &SFXQuickSpawnPalette::OnQueryChanged)
+										.OnKeyDownHandler(this, &SFXQuickSpawnPalette::OnQueryKeyDown)
+								]
+
+								+ SVerticalBox::Slot()
+								.FillHeight(1.0f)
+								[
+									SAssignNew(ResultListView, SListView<TSharedPtr<FFXQuickSpawnItem>>)
+										.ListItemsSource(&Results)
+										.OnGenerateRow(this, &SFXQuickSpawnPalette::GenerateResultRow)
+										.OnMouseButtonDoubleClick(this, &SFXQuickSpawnPalette::OnResultDoubleClicked)
+										.SelectionMode(ESelectionMode::Single)
+								]
+
+								+ SVerticalBox::Slot()
+								.AutoHeight()
+								.Padding(0, 5, 0, 0)
+								[
+									SNew(STextBlock)
+										.Text(this, &SFXQuickSpawnPalette::GetStatusText)
+										.Font(FCoreStyle::GetDefaultFontStyle("Regular", 8))
+										.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+								]
+						]
+				]
+		];
+}
+
+TSharedPtr<SWidget> SFXQuickSpawnPalette::GetWidgetToFocus() const
+{
+	return SearchBox;
+}
+
+void SFXQuickSpawnPalette::BuildCandidates()
+{
+	Matcher.Reset();
+	CandidatePaths.Reset();
+
+	if (!State.IsValid())
+	{
+		return;
+	}
+
+	// 빈 질의 = 모든 카테고리의 항목 (같은 항목은 한 번만)
+	TArray<FFXPathId> PathIds;
+	State->GetSearchIndex().Search(FFXSearchQuery(), PathIds);
+
+	const FFXPathTable& PathTable = State->GetPathTable();
+	CandidatePaths.Reserve(PathIds.Num());
+	Matcher.Reserve(PathIds.Num());
+	for (FFXPathId PathId : PathIds)
+	{
+		// 변형 항목은 "에셋 이름 (변형 이름)"으로 매칭
+		const FSoftObjectPath& Path = CandidatePaths.Add_GetRef(PathTable.Get(PathId));
+		const FString& SubPath = Path.GetSubPathString();
+		Matcher.AddCandidate(SubPath.IsEmpty() ? Path.GetAssetName() : FString::Printf(TEXT("%s (%s)"), *Path.GetAssetName(), *SubPath));
+	}
+}
+
+void SFXQuickSpawnPalette::OnQueryChanged(const FText& NewText)
+{
+	Results.Reset();
+
+	if (State.IsValid())
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		TArray<FFXFuzzyMatch> Matches;
+		Matcher.Match(NewText.ToString(), FFXAssetLibConstants::QuickSpawnMaxResults, Matches);
+
+		LastMatchMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		// 표시할 결과만 이름/카테고리 구성 (카테고리는 현재 상태에서 조회)
+		TArray<TPair<FName, FSoftObjectPath>> Entries;
+		for (const FFXFuzzyMatch& Match : Matches)
+		{
+			const FSoftObjectPath& Path = CandidatePaths[Match.CandidateIndex];
+
+			TSharedPtr<FFXQuickSpawnItem> Item = MakeShared<FFXQuickSpawnItem>();
+			Item->AssetPath = Path;
+			Item->Distance = Match.Distance;
+			Item->DisplayName = Path.GetSubPathString().IsEmpty()
+				? Path.GetAssetName()
+				: FString::Printf(TEXT("%s (%s)"), *Path.GetAssetName(), *Path.GetSubPathString());
+
+			Entries.Reset();
+			State->FindAssetEntries(Path, Entries);
+			for (const TPair<FName, FSoftObjectPath>& Entry : Entries)
+			{
+				if (Entry.Value == Path)
+				{
+					Item->CategoryText += Item->CategoryText.IsEmpty() ? Entry.Key.ToString() : TEXT(", ") + Entry.Key.ToString();
+				}
+			}
+
+			Results.Add(Item);
+		}
+	}
+
+	if (ResultListView.IsValid())
+	{
+		ResultListView->RequestListRefresh();
+		if (Results.Num() > 0)
+		{
+			ResultListView->SetSelection(Results[0], ESelectInfo::Direct);
+			ResultListView->RequestScrollIntoView(Results[0]);
+		}
+	}
+}
+
+FReply SFXQuickSpawnPalette::OnQueryKeyDown(const FGeometry& MyGeometry, const FKeyEvent& KeyEvent)
+{
+	const FKey Key = KeyEvent.GetKey();
+	if (Key == EKeys::Up)
+	{
+		MoveSelection(-1);
+		return FReply::Handled();
+	}
+	if (Key == EKeys::Down)
+	{
+		MoveSelection(1);
+		return FReply::Handled();
+	}
+	if (Key == EKeys::Enter)
+	{
+		TArray<TSharedPtr<FFXQuickSpawnItem>> SelectedItems = ResultListView->GetSelectedItems();
+		SpawnItem(SelectedItems.Num() > 0 ? SelectedItems[0] : (Results.Num() > 0 ? Results[0] : nullptr));
+		return FReply::Handled();
+	}
+	if (Key == EKeys::Escape)
+	{
+		Close();
+		return FReply::Handled();
+	}
+	return FReply::Unhandled();
+}
+
+TSharedRef<ITableRow> SFXQuickSpawnPalette::GenerateResultRow(TSharedPtr<FFXQuickSpawnItem> Item, const TSharedRef<STableViewBase>& Owner)
+{
+	if (!Item.IsValid())
+	{
+		return SNew(STableRow<TSharedPtr<FFXQuickSpawnItem>>, Owner);
+	}
+
+	// 오타로 일치한 항목은 흐리게 표시
+	return SNew(STableRow<TSharedPtr<FFXQuickSpawnItem>>, Owner)
+		.Padding(FMargin(4, 2))
+		[
+			SNew(SHorizontalBox)
+
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+						.Text(FText::FromString(Item->DisplayName))
+						.Font(FCoreStyle::GetDefaultFontStyle(Item->Distance == 0 ? "Bold" : "Regular", 10))
+				]
+
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(10, 0, 0, 0)
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+						.Text(FText::FromString(Item->CategoryText))
+						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 8))
+						.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+				]
+		];
+}
+
+void SFXQuickSpawnPalette::OnResultDoubleClicked(TSharedPtr<FFXQuickSpawnItem> Item)
+{
+	SpawnItem(Item);
+}
+
+void SFXQuickSpawnPalette::MoveSelection(int32 Delta)
+{
+	if (Results.Num() == 0 || !ResultListView.IsValid())
+	{
+		return;
+	}
+
+	TArray<TSharedPtr<FFXQuickSpawnItem>> SelectedItems = ResultListView->GetSelectedItems();
+	const int32 CurrentIndex = SelectedItems.Num() > 0 ? Results.Find(SelectedItems[0]) : INDEX_NONE;
+	const int32 NewIndex = FMath::Clamp(CurrentIndex + Delta, 0, Results.Num() - 1);
+
+	ResultListView->SetSelection(Results[NewIndex], ESelectInfo::OnKeyPress);
+	ResultListView->RequestScrollIntoView(Results[NewIndex]);
+}
+
+void SFXQuickSpawnPalette::SpawnItem(TSharedPtr<FFXQuickSpawnItem> Item)
+{
+	if (!Item.IsValid() || !State.IsValid())
+	{
+		return;
+	}
+
+	// 팔레트를 먼저 닫아 스폰 후 뷰포트가 포커스를 받도록 함 (닫히면 위젯이 해제될 수 있으므로 델리게이트는 복사)
+	TSharedPtr<FSoftObjectPath> AssetPath = MakeShared<FSoftObjectPath>(Item->AssetPath);
+	const FOnFXQuickSpawn SpawnDelegate = OnSpawn;
+	Close();
+	SpawnDelegate.ExecuteIfBound(AssetPath);
+}
+
+void SFXQuickSpawnPalette::Close()
+{
+	FSlateApplication::Get().DismissMenuByWidget(SharedThis(this));
+}
+
+FText SFXQuickSpawnPalette::GetStatusText() const
+{
+	return FText::FromString(FString::Printf(TEXT("%d matches | %d effects | %d scanned in %.2f ms"),
+		Results.Num(), Matcher.NumCandidates(), Matcher.GetLastScannedCount(), LastMatchMs));
+}
@@ -0,0 +1,25 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FXLibraryBenchmarkCommandlet.generated.h"
+
+/**
+ * FX Library 마이크로벤치마크 (헤드리스)
+ * 메모리 저장소/레지스트리로 모델을 구성하여 에디터 UI 없이 핵심 연산 시간 측정
+ * 추가 / 조회 / 표시 목록 재구성 / 정리 / 제거를 1k, 10k, 100k 항목에서 측정
+ *
+ * 실행: UnrealEditor-Cmd <Project>.uproject -run=FXLibraryBenchmark [-Sizes=1000,10000,100000] [-Categories=20] [-Unattended]
+ */
+UCLASS()
+class UFXLibraryBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UFXLibraryBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
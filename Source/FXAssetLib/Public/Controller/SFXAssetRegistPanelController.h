@@ -26,7 +26,10 @@ public:
 		const FString& RootPath,
 		const FString& AssetName,
 		const FString& CategoryName,
-		const TArray<FAssetData>& SelectedAssets
+		const FString& Hashtags,
+		const TArray<FAssetData>& SelectedAssets,
+		bool bGenerateCostTiers = false,
+		bool bReferenceOnly = false
 	);
 	FReply OnCancelClicked();
 
@@ -8,6 +8,7 @@
 // Forward declarations
 class FFXLibraryState;
 class FFXLibraryModel;
+struct FFXAssetVariant;
 
 /**
  * FX Library Panel Controller
@@ -32,18 +33,33 @@ public:
 
 	// 에셋 관련 이벤트
 	void SpawnNiagaraActor(TSharedPtr<FSoftObjectPath> AssetPath);
+	void SpawnNiagaraActorTier(TSharedPtr<FSoftObjectPath> AssetPath, FName TierName);
 	void BrowseToAsset(TSharedPtr<FSoftObjectPath> AssetPath);
 	void RemoveAssetFromLibrary(TSharedPtr<FSoftObjectPath> AssetPath);
 
+	// 선택된 레벨 액터의 User Parameter 값을 변형으로 저장
+	bool CreateVariantFromSelection(TSharedPtr<FSoftObjectPath> AssetPath, FName VariantName);
+
 	// 카테고리 관련 이벤트
 	void OnCategoryChanged(TSharedPtr<FName> Category);
 	void OnCategoryHovered(TSharedPtr<FName> Category);
 	void OnCategoryUnhovered();
 
+	// 검색어 변경 (입력할 때마다 역색인으로 표시 목록 갱신)
+	void OnSearchTextChanged(const FText& NewText);
+
+	// 유사 이펙트 보기 (특징 벡터가 아직 없으면 기준 에셋만 즉시 추출)
+	void FindSimilarAssets(TSharedPtr<FSoftObjectPath> AssetPath);
+	void ClearSimilarAssets();
+
 	// State 접근
 	TSharedPtr<FFXLibraryState> GetState() const { return State; }
 	TSharedPtr<FFXLibraryModel> GetModel() const { return Model; }
 
+private:
+	// 나이아가라 시스템 스폰 (변형이면 User Parameter 오버라이드 적용)
+	void SpawnNiagaraSystem(const FSoftObjectPath& SystemPath, const FFXAssetVariant* Variant);
+
 private:
 	TSharedPtr<FFXLibraryState> State;
 	TSharedPtr<FFXLibraryModel> Model;
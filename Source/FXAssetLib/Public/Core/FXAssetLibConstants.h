@@ -16,11 +16,30 @@ namespace FFXAssetLibConstants
 	static const FString DefaultRootPath = TEXT("/Game/FXLib/");
 	static const FString DefaultCategoryName = TEXT("Default");
 	
+	// 라이브러리 복사본의 패키지 메타데이터 키 (에셋 레지스트리 태그로 노출되어 로드 없이 FARFilter로 조회)
+	static const FName CategoryMetadataTag = TEXT("FXLib.Category");     // 등록 카테고리
+	static const FName HashtagsMetadataTag = TEXT("FXLib.Hashtags");     // 쉼표로 구분한 해시태그 (# 제외)
+	static const FName SourceMetadataTag = TEXT("FXLib.Source");         // 복사 원본 오브젝트 경로
+	static const FName FeaturesMetadataTag = TEXT("FXLib.Features");     // 유사 이펙트 검색용 특징 벡터 (FFXEffectFeatures)
+	static const FName TiersMetadataTag = TEXT("FXLib.Tiers");           // 기본 복사본의 비용 티어 변형 (TierName=ObjectPath, 쉼표 구분)
+	static const FName GraphHashMetadataTag = TEXT("FXLib.GraphHash");   // 라이브러리 마스터 머테리얼 그래프 해시 (중복 제거 인덱스)
+	
 	// UI 크기
 	static const FVector2D RegistrationWindowSize(500.0f, 400.0f);
-	static const FVector2D CategoryTileSize(200.0f, 120.0f);
+	static const FVector2D CategoryIconSize(20.0f, 20.0f);
+	static const float CategoryRowHeight = 26.0f;
 	static const FVector2D AssetTileSize(120.0f, 130.0f);
 	static const FVector2D ThumbnailSize(90.0f, 90.0f);
+	static const FVector2D QuickSpawnPaletteSize(480.0f, 360.0f);
+	
+	// 빠른 스폰 팔레트 최대 결과 수
+	static const int32 QuickSpawnMaxResults = 50;
+	
+	// 유사 이펙트 최대 결과 수
+	static const int32 SimilarEffectsMaxResults = 24;
+	
+	// 백그라운드 특징 추출 시 한 번에 비동기 로드할 에셋 수
+	static const int32 FeatureExtractionBatchSize = 8;
 	
 	// 카메라 스폰 거리
 	static const float NiagaraSpawnDistance = 500.0f;
@@ -4,9 +4,105 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "Engine/EngineTypes.h"
+#include "Model/FXCategoryIndex.h"
 #include "FXLibrarySettings.generated.h"
 
 
+/**
+ * 라이브러리 데이터 저장 방식
+ */
+UENUM()
+enum class EFXLibraryStorageBackend : uint8
+{
+    // DefaultGame.ini (변경 시 전체 재작성)
+    Ini         UMETA(DisplayName = "Config (DefaultGame.ini)"),
+    // 바이너리 스냅샷 + 추가 전용 저널 (Saved/FXLibrary)
+    Database    UMETA(DisplayName = "Binary Database"),
+    // 팀 공유 디렉터리의 스냅샷 파일 (잠금 파일 + 병합 후 쓰기, 외부 변경 감지)
+    Shared      UMETA(DisplayName = "Shared Directory (Team)")
+};
+
+/**
+ * 나이아가라 User Parameter 타입
+ */
+UENUM(BlueprintType)
+enum class EFXUserParameterType : uint8
+{
+    Float,
+    Int,
+    Bool,
+    Vector,
+    Color
+};
+
+/**
+ * 나이아가라 User Parameter 오버라이드 값
+ * 스폰 시 UNiagaraComponent에 적용됨
+ */
+USTRUCT(BlueprintType)
+struct FFXUserParameterOverride
+{
+    GENERATED_BODY()
+
+    // 파라미터 이름 (User. 접두어 제외 가능)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameter")
+    FName ParameterName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameter")
+    EFXUserParameterType Type = EFXUserParameterType::Float;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameter", meta = (EditCondition = "Type == EFXUserParameterType::Float", EditConditionHides))
+    float FloatValue = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameter", meta = (EditCondition = "Type == EFXUserParameterType::Int", EditConditionHides))
+    int32 IntValue = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameter", meta = (EditCondition = "Type == EFXUserParameterType::Bool", EditConditionHides))
+    bool bBoolValue = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameter", meta = (EditCondition = "Type == EFXUserParameterType::Vector", EditConditionHides))
+    FVector VectorValue = FVector::ZeroVector;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameter", meta = (EditCondition = "Type == EFXUserParameterType::Color", EditConditionHides))
+    FLinearColor ColorValue = FLinearColor::White;
+};
+
+/**
+ * 파라미터 오버라이드 변형 정보 구조체
+ * 시스템 전체를 복사하지 않고 기본 에셋 + User Parameter 오버라이드만 저장
+ * 라이브러리 항목 경로는 기본 에셋 경로에 변형 이름을 SubPath로 붙인 형태 (예: /Game/FXLib/NS_Spark.NS_Spark:Red)
+ */
+USTRUCT(BlueprintType)
+struct FFXAssetVariant
+{
+    GENERATED_BODY()
+
+    // 변형 이름
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Variant")
+    FName VariantName;
+
+    // 기본 나이아가라 시스템 경로
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Variant", meta = (AllowedClasses = "/Script/Niagara.NiagaraSystem"))
+    FSoftObjectPath BasePath;
+
+    // 스폰 시 적용할 User Parameter 오버라이드 목록
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Variant")
+    TArray<FFXUserParameterOverride> Overrides;
+
+    // 라이브러리 항목 경로 (BasePath + SubPath)
+    FSoftObjectPath GetEntryPath() const
+    {
+        return FSoftObjectPath(BasePath.GetAssetPath(), VariantName.ToString());
+    }
+
+    // 라이브러리 항목이 변형인지 확인 (SubPath 유무)
+    static bool IsVariantEntry(const FSoftObjectPath& EntryPath)
+    {
+        return !EntryPath.GetSubPathString().IsEmpty();
+    }
+};
+
 /**
  * 카테고리 정보 구조체
  * 카테고리 이름, 아이콘, 등록된 에셋들을 함께 관리
@@ -28,11 +124,21 @@ struct FFXCategoryData
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Assets")
     TArray<FSoftObjectPath> Assets;
 
+    // 파라미터 오버라이드 변형 목록 (Assets에 GetEntryPath()로 등록됨)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Assets")
+    TArray<FFXAssetVariant> Variants;
+
+    // 복사 없이 원본을 그대로 참조하는 항목 (라이브러리가 소유하지 않음)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Assets")
+    TArray<FSoftObjectPath> ReferencedAssets;
+
     // 기본 생성자
     FFXCategoryData()
         : CategoryName(NAME_None)
         , IconPath()
         , Assets()
+        , Variants()
+        , ReferencedAssets()
     {
     }
 
@@ -41,6 +147,51 @@ struct FFXCategoryData
         : CategoryName(InName)
         , IconPath()
         , Assets()
+        , Variants()
+        , ReferencedAssets()
+    {
+    }
+};
+
+
+/**
+ * 비용 티어(Low/Medium/High) 설정 구조체
+ * 등록 시 복사된 나이아가라 시스템을 복제하여 티어별로 스케일 조정한 변형을 생성
+ */
+USTRUCT(BlueprintType)
+struct FFXCostTierSettings
+{
+    GENERATED_BODY()
+
+    // 티어 이름 (변형 에셋 이름의 접미사로 사용, 예: NS_Fire_Low)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tier")
+    FName TierName;
+
+    // 스폰 레이트/버스트 카운트 스케일 (Emitter Scalability의 SpawnCountScale로 적용)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tier", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float SpawnCountScale;
+
+    // 최대 파티클 수 스케일 (이미터 할당을 FixedCount로 바꾸고 기존 최대 수에 스케일을 곱한 값으로 제한, GPU 프레임당 스폰 상한에도 적용)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tier", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float MaxParticleScale;
+
+    // 이 티어에서 비활성화할 이미터 이름 (와일드카드 지원, 예: "*Sparks*")
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tier")
+    TArray<FString> DisabledEmitters;
+
+    FFXCostTierSettings()
+        : TierName(NAME_None)
+        , SpawnCountScale(1.0f)
+        , MaxParticleScale(1.0f)
+        , DisabledEmitters()
+    {
+    }
+
+    FFXCostTierSettings(FName InName, float InSpawnCountScale, float InMaxParticleScale)
+        : TierName(InName)
+        , SpawnCountScale(InSpawnCountScale)
+        , MaxParticleScale(InMaxParticleScale)
+        , DisabledEmitters()
     {
     }
 };
@@ -59,17 +210,74 @@ public:
 
     // ⭐ 추가!
     virtual void PostInitProperties() override;
+    virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+    virtual void PostEditUndo() override;
+#endif
 
     
     UPROPERTY(Config, EditAnywhere, Category = "FX Library")
     TArray<FFXCategoryData> Categories;
 
+    // 라이브러리 데이터 저장 방식 (Database로 전환 시 현재 카테고리를 스냅샷으로 이전)
+    UPROPERTY(Config, EditAnywhere, Category = "FX Library | Storage")
+    EFXLibraryStorageBackend StorageBackend = EFXLibraryStorageBackend::Ini;
+
+    // 팀 공유 라이브러리 디렉터리 (네트워크 공유 또는 동기화 폴더)
+    UPROPERTY(Config, EditAnywhere, Category = "FX Library | Storage", meta = (EditCondition = "StorageBackend == EFXLibraryStorageBackend::Shared"))
+    FDirectoryPath SharedLibraryDirectory;
+
+    // 저널 레코드가 이 수를 넘으면 스냅샷으로 압축
+    UPROPERTY(Config, EditAnywhere, Category = "FX Library | Storage", meta = (ClampMin = "16", EditCondition = "StorageBackend == EFXLibraryStorageBackend::Database"))
+    int32 JournalCompactionThreshold = 512;
+
+    // 마지막 변경 후 이 시간(초) 동안 추가 변경이 없으면 저장 (연속 변경은 한 번에 저장)
+    UPROPERTY(Config, EditAnywhere, Category = "FX Library | Storage", meta = (ClampMin = "0.0", ClampMax = "10.0"))
+    float WriteBehindDelaySeconds = 2.0f;
+
+    // 등록 시 복사 없이 원본을 참조만 하는 모드를 기본으로 사용할지 여부
+    UPROPERTY(Config, EditAnywhere, Category = "FX Library")
+    bool bReferenceOnlyRegistration = false;
+
+    // 등록 시 구조가 동일한 이미터를 공유 이미터(RootPath/Emitters)로 묶어 상속하도록 설정
+    UPROPERTY(Config, EditAnywhere, Category = "FX Library | Deduplication")
+    bool bShareIdenticalEmitters = false;
+
+    // 복사 시 그래프가 동일한 라이브러리 마스터 머테리얼이 있으면 복사하지 않고 인스턴스를 재부모화
+    UPROPERTY(Config, EditAnywhere, Category = "FX Library | Deduplication")
+    bool bCollapseEquivalentMasterMaterials = false;
+
+    // 복사된 머테리얼에서 같은 UV로 샘플링되는 그레이스케일 마스크들을 RGBA 텍스처 하나로 패킹
+    UPROPERTY(Config, EditAnywhere, Category = "FX Library | Optimization")
+    bool bPackGrayscaleTextureMasks = false;
+
+    // 등록 시 비용 티어 변형을 기본으로 생성할지 여부
+    UPROPERTY(Config, EditAnywhere, Category = "FX Library | Cost Tiers")
+    bool bGenerateCostTiers = false;
+
+    // 생성할 비용 티어 목록 (원본 복사본이 High 티어 역할)
+    UPROPERTY(Config, EditAnywhere, Category = "FX Library | Cost Tiers")
+    TArray<FFXCostTierSettings> CostTiers;
+
     FFXCategoryData* FindCategory(FName CategoryName);
     const FFXCategoryData* FindCategory(FName CategoryName) const;
 
+    // 카테고리 변경 함수는 메모리만 수정 (저장은 FFXLibraryWriteBehind가 모아서 수행)
     FFXCategoryData* AddCategory(FName CategoryName, const FSoftObjectPath& IconPath = FSoftObjectPath());
     bool AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath);
     int32 RemoveAssetFromCategory(FName CategoryName, const FSoftObjectPath& AssetPath);
+    bool ReplaceAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath);
+    bool RemoveCategory(FName CategoryName);
+
+    // 카테고리 포함 여부 (해시 조회)
+    bool IsAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath) const;
+
+    // Categories 배열을 직접 교체/수정한 뒤 호출 (이름/멤버십 인덱스 재생성)
+    void InvalidateCategoryIndex();
+
+    bool UsesDatabaseBackend() const { return StorageBackend == EFXLibraryStorageBackend::Database; }
+    bool UsesSharedBackend() const { return StorageBackend == EFXLibraryStorageBackend::Shared && !SharedLibraryDirectory.Path.IsEmpty(); }
 
 
 
@@ -90,4 +298,8 @@ public:
 
     virtual FName GetCategoryName() const override;
     virtual FText GetSectionText() const override;
+
+private:
+    // 이름 -> Categories 인덱스 / 카테고리별 에셋 멤버십 (Categories를 직접 바꾸는 경로는 InvalidateCategoryIndex로 폐기)
+    FFXCategoryIndex CategoryIndex;
 };
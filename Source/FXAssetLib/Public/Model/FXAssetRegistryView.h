@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+/**
+ * 모델이 사용하는 에셋 레지스트리 조회 인터페이스 (검증/정리/리다이렉터 추적)
+ * 백그라운드 검증에서 워커 스레드로 호출되므로 구현은 스레드 안전해야 함
+ *
+ * FFXEngineAssetRegistryView: 엔진 AssetRegistry (에디터 기본)
+ * FFXInMemoryAssetRegistryView: 등록한 에셋만 존재하는 메모리 레지스트리 (벤치마크/헤드리스 실행)
+ */
+class FXASSETLIB_API IFXAssetRegistryView
+{
+public:
+	virtual ~IFXAssetRegistryView() = default;
+
+	// 오브젝트 경로의 에셋 (없으면 유효하지 않은 FAssetData)
+	virtual FAssetData GetAssetByObjectPath(const FSoftObjectPath& ObjectPath) const = 0;
+
+	// 패키지에 포함된 에셋 (리다이렉터 포함)
+	virtual void GetAssetsByPackageName(FName PackageName, TArray<FAssetData>& OutAssets) const = 0;
+
+	// 여러 오브젝트 경로를 한 번에 조회 (존재하는 에셋만 반환, 순서 무관)
+	virtual void GetAssetsByObjectPaths(TConstArrayView<FSoftObjectPath> ObjectPaths, TArray<FAssetData>& OutAssets) const = 0;
+
+	// 경로(하위 폴더 포함) 아래에서 태그가 있는 에셋 (값 무관, 로드 없이 태그만 조회)
+	virtual void GetAssetsWithTag(FName PackagePath, FName TagName, TArray<FAssetData>& OutAssets) const = 0;
+};
+
+class FXASSETLIB_API FFXEngineAssetRegistryView : public IFXAssetRegistryView
+{
+public:
+	virtual FAssetData GetAssetByObjectPath(const FSoftObjectPath& ObjectPath) const override;
+	virtual void GetAssetsByPackageName(FName PackageName, TArray<FAssetData>& OutAssets) const override;
+	virtual void GetAssetsByObjectPaths(TConstArrayView<FSoftObjectPath> ObjectPaths, TArray<FAssetData>& OutAssets) const override;
+	virtual void GetAssetsWithTag(FName PackagePath, FName TagName, TArray<FAssetData>& OutAssets) const override;
+};
+
+class FXASSETLIB_API FFXInMemoryAssetRegistryView : public IFXAssetRegistryView
+{
+public:
+	// 에셋 등록 (클래스 경로 예: /Script/Niagara.NiagaraSystem)
+	void AddAsset(const FSoftObjectPath& ObjectPath, const FTopLevelAssetPath& ClassPath, FAssetDataTagMap Tags = FAssetDataTagMap());
+
+	// 이동된 에셋: 원래 경로에 DestinationObject 태그를 가진 리다이렉터 등록
+	void AddRedirector(const FSoftObjectPath& FromPath, const FSoftObjectPath& ToPath);
+
+	void RemoveAsset(const FSoftObjectPath& ObjectPath);
+
+	int32 Num() const { return Assets.Num(); }
+
+	virtual FAssetData GetAssetByObjectPath(const FSoftObjectPath& ObjectPath) const override;
+	virtual void GetAssetsByPackageName(FName PackageName, TArray<FAssetData>& OutAssets) const override;
+	virtual void GetAssetsByObjectPaths(TConstArrayView<FSoftObjectPath> ObjectPaths, TArray<FAssetData>& OutAssets) const override;
+	virtual void GetAssetsWithTag(FName PackagePath, FName TagName, TArray<FAssetData>& OutAssets) const override;
+
+private:
+	TMap<FSoftObjectPath, FAssetData> Assets;
+	TMultiMap<FName, FSoftObjectPath> AssetsByPackage;
+};
@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+struct FFXCategoryData;
+
+/**
+ * 카테고리 배열 조회/변경 색인 (이름 -> 배열 인덱스, 카테고리별 에셋 멤버십 집합)
+ * 배열은 호출자가 소유하고 매 호출에 전달 (UFXLibrarySettings의 Config 배열, 저장소, 저널 재생 배열)
+ * 이름 색인은 처음 조회 시 생성하고 개수/이름이 어긋나면 재생성, 멤버십은 카테고리별로 처음 조회 시 생성
+ * 배열을 직접 교체/수정한 뒤에는 Invalidate 호출
+ */
+class FXASSETLIB_API FFXCategoryIndex
+{
+public:
+	// 이름으로 카테고리 찾기 (중복 이름은 첫 항목)
+	int32 FindCategoryIndex(const TArray<FFXCategoryData>& Categories, FName CategoryName) const;
+	FFXCategoryData* FindCategory(TArray<FFXCategoryData>& Categories, FName CategoryName) const;
+	const FFXCategoryData* FindCategory(const TArray<FFXCategoryData>& Categories, FName CategoryName) const;
+
+	// 카테고리 추가 (이미 있으면 기존 항목) / 제거
+	FFXCategoryData& AddCategory(TArray<FFXCategoryData>& Categories, FName CategoryName, const FSoftObjectPath& IconPath);
+	bool RemoveCategory(TArray<FFXCategoryData>& Categories, FName CategoryName);
+
+	// 에셋 추가 (중복 무시, 카테고리가 없으면 false) / 제거 (제거한 수)
+	bool AddAsset(TArray<FFXCategoryData>& Categories, FName CategoryName, const FSoftObjectPath& AssetPath);
+	int32 RemoveAsset(TArray<FFXCategoryData>& Categories, FName CategoryName, const FSoftObjectPath& AssetPath);
+
+	// 같은 위치에서 경로 교체 (새 경로가 이미 있으면 기존 항목만 제거, 표시 순서 유지)
+	bool ReplaceAsset(TArray<FFXCategoryData>& Categories, FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath);
+
+	// 카테고리 포함 여부 (해시 조회)
+	bool ContainsAsset(const TArray<FFXCategoryData>& Categories, FName CategoryName, const FSoftObjectPath& AssetPath) const;
+
+	void Invalidate();
+
+private:
+	void RebuildNameIndex(const TArray<FFXCategoryData>& Categories) const;
+	TSet<FSoftObjectPath>& GetAssetMembership(const FFXCategoryData& Category) const;
+
+	mutable TMap<FName, int32> CategoryIndexByName;
+	mutable int32 IndexedCategoryCount = INDEX_NONE;
+	mutable TMap<FName, TSet<FSoftObjectPath>> AssetMembership;
+};
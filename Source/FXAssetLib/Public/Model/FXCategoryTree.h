@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 카테고리 트리 노드
+ * 경로형 카테고리 이름(예: Fire/Torch/Small)의 한 구간
+ * 중간 구간만 있는 노드(예: Fire/Torch)는 폴더 역할만 하며 선택할 카테고리가 없음
+ */
+struct FXASSETLIB_API FFXCategoryTreeNode
+{
+	// 정규화된 전체 경로 (빈 구간/앞뒤 공백 제거)
+	FName Path;
+
+	// 마지막 구간 (트리에 표시되는 이름)
+	FString Label;
+
+	// 이 경로의 카테고리 (폴더 노드면 nullptr)
+	TSharedPtr<FName> Category;
+
+	// 이 노드 카테고리의 항목 수 / 하위 노드 포함 항목 수 (항목 변경마다 증분 갱신)
+	int32 AssetCount = 0;
+	int32 SubtreeAssetCount = 0;
+
+	TWeakPtr<FFXCategoryTreeNode> Parent;
+
+	// 하위 노드 (카테고리 표시 순서)
+	TArray<TSharedPtr<FFXCategoryTreeNode>> Children;
+
+	bool IsCategory() const { return Category.IsValid(); }
+};
+
+/**
+ * 경로형 카테고리 트리
+ * 평면 카테고리 목록(State::Categories)에서 '/' 구간으로 유도한 계층 (저장 형식은 그대로 평면 이름)
+ * 항목 수는 카테고리 항목 추가/제거 시 조상 노드만 갱신하므로 트리를 그릴 때 항목 목록을 순회하지 않음
+ */
+class FXASSETLIB_API FFXCategoryTree
+{
+public:
+	static constexpr TCHAR Separator = TEXT('/');
+
+	// 전체 재구성 (카테고리 목록 로드 시, 항목 수는 카테고리별 크기 조회)
+	void Rebuild(const TArray<TSharedPtr<FName>>& Categories, TFunctionRef<int32(FName)> GetAssetCount);
+
+	// 카테고리 노드 추가 (없는 조상은 폴더 노드로 생성)
+	void AddCategory(const TSharedPtr<FName>& Category, int32 AssetCount);
+
+	// 카테고리 노드 제거 (하위 노드가 없는 폴더 노드는 함께 정리)
+	void RemoveCategory(FName CategoryName);
+
+	// 카테고리 항목 수 변경을 조상 노드에 반영 (트리 깊이에 비례)
+	void AdjustAssetCount(FName CategoryName, int32 Delta);
+
+	// 정규화된 경로의 노드 (없으면 nullptr)
+	TSharedPtr<FFXCategoryTreeNode> FindNode(FName Path) const;
+
+	// 카테고리 이름의 노드 (트리에 없으면 nullptr)
+	TSharedPtr<FFXCategoryTreeNode> FindCategoryNode(FName CategoryName) const;
+
+	// 최상위 노드 (STreeView 항목 소스)
+	const TArray<TSharedPtr<FFXCategoryTreeNode>>& GetRootNodes() const { return RootNodes; }
+
+	// 구조 변경(노드 추가/제거) 횟수 (뷰가 트리를 새로 고칠지 판단)
+	uint32 GetVersion() const { return Version; }
+
+	int32 NumNodes() const { return Nodes.Num(); }
+
+	void Reset();
+
+	// 메모리 사용량 (노드 + 조회 맵)
+	SIZE_T GetAllocatedSize() const;
+
+	// 카테고리 이름을 트리 경로로 정규화 (예: " Fire//Torch/ " -> Fire/Torch)
+	static FString NormalizePath(const FString& CategoryPath);
+
+private:
+	TSharedPtr<FFXCategoryTreeNode> FindOrAddNode(const FString& NormalizedPath);
+	void PruneFolderNodes(TSharedPtr<FFXCategoryTreeNode> Node);
+
+	// 카테고리 이름 -> 노드, 카테고리 항목 수 (정규화 경로가 같은 카테고리는 한 노드에 합쳐짐)
+	struct FCategoryEntry
+	{
+		TSharedPtr<FFXCategoryTreeNode> Node;
+		TSharedPtr<FName> Category;
+		int32 AssetCount = 0;
+	};
+
+	TArray<TSharedPtr<FFXCategoryTreeNode>> RootNodes;
+	TMap<FName, TSharedPtr<FFXCategoryTreeNode>> Nodes;
+	TMap<FName, FCategoryEntry> CategoryEntries;
+	uint32 Version = 0;
+};
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 퍼지 매칭 결과 1건
+ */
+struct FFXFuzzyMatch
+{
+	int32 CandidateIndex = INDEX_NONE;
+	int32 Distance = 0;     // 이름의 가장 가까운 부분 문자열과의 편집 거리
+	int32 Boundary = 0;     // 일치 위치 (0: 이름 시작, 1: 단어 시작, 2: 단어 중간)
+	int32 Length = 0;       // 이름 길이 (같은 조건이면 짧은 이름 우선)
+};
+
+/**
+ * 오타 허용 이름 매칭 (빠른 스폰 팔레트)
+ *
+ * Myers 비트 병렬 근사 문자열 매칭: 검색어(최대 64자)의 편집 거리 열 전체를 64비트 벡터로 두고
+ * 이름 한 글자당 정수 연산 십여 번으로 "이름의 임의 부분 문자열과의 최소 편집 거리"를 계산
+ *
+ * 검색어가 이전 검색어를 이어 쓴 것이면 이전 후보 풀만 다시 검사
+ * (검색어가 길어져도 편집 거리는 줄지 않으므로, 허용 거리 + 1 이내였던 후보만 남기면 충분)
+ * 백스페이스는 이전 단계의 풀로 돌아가므로 다시 전체를 검사하지 않음
+ */
+class FXASSETLIB_API FFXFuzzyMatcher
+{
+public:
+	// 후보 이름 (팔레트를 열 때 1회 구성, 인덱스는 추가 순서)
+	void Reset();
+	void Reserve(int32 NumCandidates);
+	int32 AddCandidate(const FString& Name);
+	int32 NumCandidates() const { return NameOffsets.Num(); }
+
+	/**
+	 * 검색어와 가까운 후보 (거리, 일치 위치, 이름 길이 순)
+	 * @param MaxResults 반환할 최대 개수 (순위 계산은 상위 MaxResults개만 유지)
+	 */
+	void Match(const FString& Query, int32 MaxResults, TArray<FFXFuzzyMatch>& OutMatches);
+
+	// 허용 오타 수 (짧은 검색어는 정확히, 길수록 더 허용)
+	static int32 GetMaxErrors(int32 PatternLength);
+
+	// 마지막 Match에서 편집 거리를 계산한 후보 수 (전체 또는 이전 풀)
+	int32 GetLastScannedCount() const { return LastScannedCount; }
+
+private:
+	// 검색어 1단계 (입력 중인 검색어마다 쌓이고, 이어 쓰지 않은 검색어가 오면 버림)
+	struct FPass
+	{
+		TArray<uint8> Pattern;
+		int32 PoolLimit = 0;    // Pool에 남긴 최대 거리
+		TArray<int32> Pool;     // 거리 <= PoolLimit인 후보 (다음 단계의 검사 대상)
+	};
+
+	// 소문자 1바이트로 접은 이름 (연속 배열)
+	TArray<uint8> NameChars;
+	TArray<int32> NameOffsets;
+	TArray<int32> NameLengths;
+
+	// 이름에 있는 글자 비트 (c & 63), 없는 글자 수가 허용 거리를 넘으면 편집 거리 계산 생략
+	TArray<uint64> NameCharMasks;
+
+	TArray<FPass> Passes;
+	int32 LastScannedCount = 0;
+};
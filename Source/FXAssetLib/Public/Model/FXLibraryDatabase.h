@@ -0,0 +1,116 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FXLibrarySettings.h"
+
+class IFileHandle;
+
+/**
+ * 저널 레코드 종류
+ */
+enum class EFXJournalOp : uint8
+{
+	AddCategory,
+	RemoveCategory,
+	AddAsset,
+	RemoveAsset,
+	ReplaceAsset        // 이름이 바뀐 에셋을 같은 위치에서 새 경로로 교체
+};
+
+/**
+ * 저널 레코드 (라이브러리 변경 1건)
+ */
+struct FXASSETLIB_API FFXJournalRecord
+{
+	EFXJournalOp Op = EFXJournalOp::AddAsset;
+	FName CategoryName;
+	FSoftObjectPath Path;           // AddCategory: 아이콘 경로, AddAsset/RemoveAsset/ReplaceAsset: 항목 경로
+	FSoftObjectPath PreviousPath;   // ReplaceAsset: 교체 전 항목 경로
+	bool bReferenced = false;       // AddAsset/ReplaceAsset: 참조 전용 항목 여부
+	bool bHasVariant = false;       // AddAsset/ReplaceAsset: 변형 정보 포함 여부
+	FFXAssetVariant Variant;
+};
+
+/**
+ * FX Library 바이너리 데이터베이스
+ * 스냅샷(경로 테이블 + 카테고리)을 메모리 매핑으로 읽고, 변경 사항은 추가 전용 저널에 기록
+ * 저널이 커지면 임시 파일에 스냅샷을 쓴 뒤 교체하는 방식으로 원자적으로 압축
+ *
+ * 파일 위치: Saved/FXLibrary/Library.fxdb, Library.fxjournal
+ */
+class FXASSETLIB_API FFXLibraryDatabase
+{
+public:
+	FFXLibraryDatabase() = default;
+
+	// 데이터베이스 디렉터리 지정 (테스트/도구용, 기본은 Saved/FXLibrary)
+	explicit FFXLibraryDatabase(const FString& InDatabaseDirectory);
+
+	~FFXLibraryDatabase();
+
+	// 에디터 세션 공용 인스턴스
+	static FFXLibraryDatabase& Get();
+
+	/**
+	 * 스냅샷 + 저널을 읽어 카테고리 배열 구성
+	 * 저널 끝에 끊기거나 CRC가 맞지 않는 레코드가 있으면 재생된 상태로 스냅샷을 다시 써서 저널을 비움
+	 * (그대로 두면 이후 추가한 레코드가 손상된 레코드 뒤에 붙어 다음 로드에서 재생되지 않음)
+	 * 압축에 실패해도 재생된 카테고리는 반환하며, 이후 저널 추가는 거부되어 스냅샷 저장으로 대체됨
+	 * @param OutCategories 로드된 카테고리
+	 * @return 데이터베이스 파일이 존재하고 읽기에 성공하면 true
+	 */
+	bool Load(TArray<FFXCategoryData>& OutCategories);
+
+	/**
+	 * 저널에 레코드 추가 (파일 끝에 추가, 즉시 Flush)
+	 * 로드 시 손상된 저널을 압축하지 못했으면 WriteSnapshot이 성공할 때까지 false
+	 */
+	bool AppendRecord(const FFXJournalRecord& Record);
+
+	/**
+	 * 저널에 레코드 여러 건을 한 번의 쓰기로 추가 (쓰기 지연 저장용)
+	 */
+	bool AppendRecords(TConstArrayView<FFXJournalRecord> Records);
+
+	/**
+	 * 전체 스냅샷을 원자적으로 기록하고 저널 비우기 (압축)
+	 */
+	bool WriteSnapshot(const TArray<FFXCategoryData>& Categories);
+
+	// 이번 세션에 Load 또는 WriteSnapshot이 수행되었는지
+	bool IsLoaded() const { return bLoaded; }
+
+	// 마지막 압축 이후 저널 레코드 수
+	int32 GetJournalRecordCount() const { return JournalRecordCount; }
+
+	FString GetDatabaseDirectory() const;
+	FString GetSnapshotPath() const;
+	FString GetJournalPath() const;
+
+	// 레코드를 카테고리 배열에 적용 (저널 재생, 색인은 재생하는 동안 같은 배열에 재사용)
+	static void ApplyRecord(const FFXJournalRecord& Record, TArray<FFXCategoryData>& Categories, FFXCategoryIndex& CategoryIndex);
+
+	// 에셋 레코드의 변형/참조 정보만 카테고리에 적용 (Assets 목록은 호출자가 관리)
+	static void ApplyRecordMetadata(const FFXJournalRecord& Record, FFXCategoryData& Category);
+
+	// 스냅샷 직렬화 (바이트 배열 <-> 카테고리)
+	static void SerializeSnapshot(TConstArrayView<FFXCategoryData> Categories, TArray64<uint8>& OutBytes);
+	static bool DeserializeSnapshot(TArrayView64<const uint8> Bytes, TArray<FFXCategoryData>& OutCategories);
+
+	// 카테고리 1개의 내용 해시 (스냅샷 직렬화 결과의 CRC, 변경 감지용)
+	static uint32 ComputeCategoryHash(const FFXCategoryData& Category);
+
+private:
+	bool ReadSnapshot(TArray<FFXCategoryData>& OutCategories) const;
+	// @param bOutFullyReplayed 저널 끝까지 손상 없이 재생했는지 (저널이 없어도 true)
+	int32 ReplayJournal(TArray<FFXCategoryData>& Categories, bool& bOutFullyReplayed) const;
+	void CloseJournal();
+
+	FString DatabaseDirectory;
+	TUniquePtr<IFileHandle> JournalHandle;
+	int32 JournalRecordCount = 0;
+	bool bJournalDamaged = false;
+	bool bLoaded = false;
+};
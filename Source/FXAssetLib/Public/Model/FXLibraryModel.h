@@ -5,25 +5,87 @@
 #include "CoreMinimal.h"
 #include "FXLibrarySettings.h"
 #include "Model/FXLibraryState.h"
+#include "Model/FXLibraryDatabase.h"
+#include "Model/FXLibrarySnapshot.h"
+#include "Model/FXLibraryStorage.h"
+#include "Model/FXAssetRegistryView.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+
+/**
+ * 정리 대상 항목 (RedirectedPath가 유효하면 이동된 참조 항목을 새 경로로 교체, 아니면 제거)
+ */
+struct FFXCleanupEntry
+{
+	FName CategoryName;
+	FSoftObjectPath Path;
+	FSoftObjectPath RedirectedPath;
+};
+
+/**
+ * 검증 결과 (스냅샷 기준으로 계산, 게임 스레드에서 적용)
+ */
+struct FFXCleanupResult
+{
+	uint64 SnapshotVersion = 0;
+	int32 NumChecked = 0;
+	double QuerySeconds = 0.0;
+	TArray<FFXCleanupEntry> Entries;
+};
+
+/**
+ * 에셋 레지스트리 변경 1건 (라이브러리 서비스가 레지스트리 이벤트를 모아서 전달)
+ */
+enum class EFXAssetRegistryChange : uint8
+{
+	Removed,    // 에셋 삭제: 해당 에셋을 사용하는 항목 제거
+	Renamed,    // 에셋 이동/이름 변경: 항목이 새 경로를 따라감 (OldAssetPath -> AssetPath)
+	Added       // 에셋 추가: 최근 삭제로 제거된 항목과 경로가 같으면 복원 (되돌리기/소스 컨트롤 동기화)
+};
+
+struct FFXAssetRegistryChange
+{
+	EFXAssetRegistryChange Type = EFXAssetRegistryChange::Removed;
+	FSoftObjectPath AssetPath;
+	FSoftObjectPath OldAssetPath;
+};
+
+/**
+ * 삭제로 제거된 항목 (같은 경로의 에셋이 다시 추가되면 카테고리/변형/참조 정보 그대로 복원)
+ */
+struct FFXRemovedEntry
+{
+	FName CategoryName;
+	FSoftObjectPath Path;
+	bool bReferenced = false;
+	TOptional<FFXAssetVariant> Variant;
+};
+
+// 비동기 정리 완료 (제거된 항목 수)
+DECLARE_DELEGATE_OneParam(FOnFXCleanupComplete, int32 /*RemovedCount*/);
 
 /**
  * FX Library 데이터 모델
- * UFXLibrarySettings와 FFXLibraryState 사이의 중재자
+ * 저장소(기본: UFXLibrarySettings)와 FFXLibraryState 사이의 중재자
  * 데이터 로드, 저장, 검증 로직 담당
  */
 class FXASSETLIB_API FFXLibraryModel
 {
 public:
+	// 에디터 기본 구성 (Settings 저장소 + 엔진 에셋 레지스트리)
 	FFXLibraryModel();
+
+	// 저장소/레지스트리 지정 (메모리 구현으로 에디터 없이 실행/측정)
+	FFXLibraryModel(TSharedRef<IFXLibraryStorage> InStorage, TSharedRef<IFXAssetRegistryView> InRegistry);
 	~FFXLibraryModel();
 
 	// State 참조 설정
 	void SetState(TSharedPtr<FFXLibraryState> InState);
 
-	// Settings에서 State로 데이터 로드
+	// Settings에서 State로 데이터 로드 (Database 백엔드는 최초 1회 스냅샷/저널에서 Settings로 로드)
 	void LoadFromSettings();
 
-	// State에서 Settings로 데이터 저장
+	// State에서 Settings로 데이터 반영 후 전체 저장 예약 (Database 백엔드는 스냅샷 압축)
 	void SaveToSettings();
 
 	// 카테고리 관리
@@ -35,20 +97,139 @@ public:
 	bool AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath);
 	int32 RemoveAssetFromCategory(FName CategoryName, const FSoftObjectPath& AssetPath);
 
+	// 일괄 변경 (배치 전체를 하나의 트랜잭션으로 처리: 변경 알림 1회, 저장 1회)
+	// @return 실제로 추가/제거/이동된 항목 수
+	int32 AddAssetsToCategory(FName CategoryName, const TArray<FSoftObjectPath>& AssetPaths, bool bCreateCategory = true);
+	int32 RemoveAssetsFromCategory(FName CategoryName, const TArray<FSoftObjectPath>& AssetPaths);    // None: 모든 카테고리
+	int32 MoveAssetsToCategory(FName SourceCategory, FName TargetCategory, const TArray<FSoftObjectPath>& AssetPaths);
+
+	/**
+	 * 라이브러리 복사본의 레지스트리 태그(FXLib.Category)로 인덱스 재구성 (로드 없이 RootPath 하위 조회)
+	 * 이미 등록된 에셋은 현재 카테고리를 유지하고, 없는 카테고리는 생성
+	 * @return 추가된 항목 수
+	 */
+	int32 RebuildFromAssetRegistry(const FString& RootPath);
+
+	// 항목이 어느 카테고리에든 등록되어 있는지 확인
+	bool IsAssetRegistered(const FSoftObjectPath& AssetPath) const;
+
+	// 파라미터 오버라이드 변형 관리 (기본 에셋 + User Parameter 오버라이드만 저장)
+	bool AddVariantToCategory(FName CategoryName, const FFXAssetVariant& Variant);
+
+	// 참조 전용 등록 (복사/참조 수집 없이 원본 경로를 그대로 등록)
+	bool AddReferencedAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath);
+
 	// 검증
 	bool ValidateCategory(FName CategoryName) const;
 	bool ValidateAsset(const FSoftObjectPath& AssetPath) const;
 
 	// 정리 (유효하지 않은 에셋/카테고리 제거)
+	// 에셋 검증은 스냅샷의 전체 경로를 레지스트리에 한 번에 조회하여 수행
 	int32 CleanupInvalidAssets();
 	int32 CleanupEmptyCategories();
 
+	// 에셋 검증을 워커 스레드에서 수행하고 제거/교체만 게임 스레드에서 적용
+	// @return 이미 진행 중이면 false
+	bool CleanupInvalidAssetsAsync(FOnFXCleanupComplete OnComplete = FOnFXCleanupComplete());
+	bool IsCleanupInProgress() const { return PendingCleanup.IsValid(); }
+
+	/**
+	 * 스냅샷의 모든 항목 검증 (스레드 무관, 레지스트리는 스레드 안전해야 함)
+	 * 기본 에셋이 없는 항목은 제거, 리다이렉터가 된 참조 항목은 이동 경로를 따라감
+	 */
+	static FFXCleanupResult FindInvalidEntries(const FFXLibrarySnapshot& Snapshot, const IFXAssetRegistryView& Registry);
+
+	/**
+	 * 에셋 레지스트리 변경을 증분 반영 (변경 수에 비례, 라이브러리 전체를 검증하지 않음)
+	 * 영향 항목은 State의 경로 역색인으로 찾고, 전체를 한 배치로 적용 (알림 1회, 스냅샷 게시 1회)
+	 * @return 제거/교체/복원된 항목 수
+	 */
+	int32 ApplyRegistryChanges(TConstArrayView<FFXAssetRegistryChange> Changes);
+
+	// 변경이 라이브러리 항목에 영향을 주는지 (이벤트 수신 시 O(1) 선별용)
+	bool IsAffectedByRegistryChange(EFXAssetRegistryChange Type, const FSoftObjectPath& AssetPath) const;
+
+	/**
+	 * 특징 벡터 태그가 없는 나이아가라 시스템 (참조 전용 항목, 태그 도입 전 복사본)
+	 * 라이브러리 서비스가 조금씩 비동기 로드하여 추출한 뒤 SetEffectFeatures로 반영
+	 * @param MaxCount 꺼낼 최대 개수
+	 */
+	void ConsumePendingFeatureAssets(TArray<FSoftObjectPath>& OutAssetPaths, int32 MaxCount);
+	bool HasPendingFeatureAssets() const { return PendingFeatureAssets.Num() > 0; }
+
+	// 추출한 특징 벡터 반영 (유사 이펙트 표시 중이면 표시 목록 갱신)
+	bool SetEffectFeatures(const FSoftObjectPath& AssetPath, const FFXEffectFeatures& Features);
+
 	// State 접근
 	TSharedPtr<FFXLibraryState> GetState() const { return State; }
 
+	// 확정된 라이브러리 데이터의 불변 스냅샷 (스레드 안전, 변경 확정마다 새로 게시)
+	FFXLibrarySnapshotPtr GetSnapshot() const { return SnapshotPublisher->GetSnapshot(); }
+
+	// 비동기 작업이 캡처할 게시기 (모델보다 오래 살아도 안전)
+	TSharedRef<FFXLibrarySnapshotPublisher, ESPMode::ThreadSafe> GetSnapshotPublisher() const { return SnapshotPublisher; }
+
 private:
+	// 팀 공유 라이브러리의 외부 변경을 State에 반영 (바뀐 카테고리만)
+	void ApplyExternalChanges(const TArray<FName>& ChangedCategories, const TArray<FName>& RemovedCategories);
+
+	// 변경 1건을 저장소에 반영하고 쓰기 지연 저장 요청 (배치 내부는 스냅샷 게시를 FinishBatch로 미룸)
+	void CommitChange(const FFXJournalRecord& Record, bool bPublishSnapshot = true);
+
+	// 확정된 저장소 카테고리로 스냅샷 게시 (표시된 카테고리만 복사), 새 항목의 검색 속성도 함께 조회
+	void PublishSnapshot();
+
+	// 추가된 항목의 클래스/해시태그/특징 벡터를 레지스트리 1회 조회로 검색/유사 이펙트 색인에 반영
+	void ResolveSearchAttributes();
+
+	// 에셋 추가/제거/교체 저널 레코드 생성 (변형/참조 정보 포함)
+	FFXJournalRecord MakeAssetRecord(EFXJournalOp Op, FName CategoryName, const FSoftObjectPath& AssetPath) const;
+
+	// State에서 저장소 카테고리 배열 재구성
+	void RebuildStorageCategories();
+
+	// 배치 내부용: 알림/저장 없이 저장소와 State에 반영 (저장은 CommitChange로 예약)
+	void AddCategoryNoNotify(FName CategoryName);
+	bool AddAssetNoNotify(FName CategoryName, const FSoftObjectPath& AssetPath);
+	bool RemoveAssetNoNotify(FName CategoryName, const FSoftObjectPath& AssetPath);
+	bool ReplaceAssetNoNotify(FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath);
+
+	// 레지스트리 변경 1건 적용 (배치 내부)
+	int32 RemoveDeletedAsset(const FSoftObjectPath& AssetPath);
+	int32 FollowRenamedAsset(const FSoftObjectPath& OldAssetPath, const FSoftObjectPath& NewAssetPath);
+	int32 RestoreRemovedAsset(const FSoftObjectPath& AssetPath);
+
+	// 배치 종료: 표시 목록 갱신, 변경 알림 1회, 저장 1회
+	void FinishBatch(int32 ChangedCount);
+
+	// 이동된 참조 항목의 리다이렉터를 따라 새 경로 반환 (없으면 빈 경로)
+	static FSoftObjectPath ResolveRedirectedAsset(const IFXAssetRegistryView& Registry, const FSoftObjectPath& AssetPath);
+
+	// 검증 결과를 State/저장소에 적용 (스냅샷 이후 이미 바뀐 항목은 건너뜀)
+	// @return 제거된 항목 수
+	int32 ApplyCleanupResult(const FFXCleanupResult& Result);
+
+	// 진행 중인 비동기 정리 완료 확인 (게임 스레드 틱)
+	bool TickPendingCleanup(float DeltaTime);
+
 	TSharedPtr<FFXLibraryState> State;
-	UFXLibrarySettings* GetMutableSettings() const;
-	const UFXLibrarySettings* GetSettings() const;
+	TSharedRef<IFXLibraryStorage> Storage;
+	TSharedRef<IFXAssetRegistryView> Registry;
+	TSharedRef<FFXLibrarySnapshotPublisher, ESPMode::ThreadSafe> SnapshotPublisher;
+	FDelegateHandle SharedLibraryChangedHandle;
+
+	// 비동기 정리 (워커 결과는 틱에서 게임 스레드로 적용)
+	TFuture<FFXCleanupResult> PendingCleanup;
+	FOnFXCleanupComplete PendingCleanupComplete;
+	FTSTicker::FDelegateHandle CleanupTickerHandle;
+
+	// 삭제로 제거된 항목 (에셋 경로별, 오래된 순으로 MaxRecentlyRemovedAssets개까지 유지)
+	TMap<FSoftObjectPath, TArray<FFXRemovedEntry>> RecentlyRemoved;
+	TArray<FSoftObjectPath> RecentlyRemovedOrder;
+	static constexpr int32 MaxRecentlyRemovedAssets = 256;
+
+	// 특징 벡터 추출 대기 에셋 (추가 순서, 중복 확인용 집합)
+	TArray<FSoftObjectPath> PendingFeatureAssets;
+	TSet<FSoftObjectPath> PendingFeatureAssetSet;
 };
 
@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+#include "Model/FXOrderedIndexSet.h"
+#include "Model/FXPathTable.h"
+
+/**
+ * 검색 필드 (비트 마스크, 토큰 키 앞에 필드 접두어를 붙여 필드별 사전 범위를 분리)
+ */
+enum class EFXSearchField : uint8
+{
+	None     = 0,
+	Name     = 1 << 0,    // 에셋 이름 토큰 (NS_FireBall_01 -> ns, fire, ball, 01, ns_fireball_01)
+	Category = 1 << 1,    // 카테고리 이름
+	Hashtag  = 1 << 2,    // FXLib.Hashtags 태그
+	Class    = 1 << 3,    // 에셋 클래스 (NiagaraSystem)
+	All      = Name | Category | Hashtag | Class
+};
+ENUM_CLASS_FLAGS(EFXSearchField);
+
+/**
+ * 검색 질의 (공백으로 구분된 절은 모두 만족해야 함, 모든 값은 접두어로 비교)
+ *
+ *   fire            이름/카테고리/해시태그/클래스 중 하나가 fire로 시작
+ *   #smoke          해시태그      cat:Explosion  카테고리      class:Niagara  클래스      name:ns_  이름
+ *   #fire|#smoke    절 안의 | 는 OR
+ *   -#wip           제외
+ */
+struct FXASSETLIB_API FFXSearchQuery
+{
+	struct FAlternative
+	{
+		EFXSearchField Fields = EFXSearchField::All;
+		FString Prefix;
+	};
+
+	struct FClause
+	{
+		TArray<FAlternative, TInlineAllocator<1>> Alternatives;
+		bool bNegated = false;
+	};
+
+	TArray<FClause> Clauses;
+
+	bool IsEmpty() const { return Clauses.Num() == 0; }
+
+	static FFXSearchQuery Parse(const FString& Text);
+};
+
+/**
+ * 라이브러리 항목 역색인 (토큰 -> 항목 경로 ID)
+ * 항목 추가/제거/속성 변경마다 해당 항목의 토큰만 증분 갱신
+ * 토큰 사전을 정렬 상태로 유지하여 접두어는 이진 탐색 범위로 찾고, 절 결합은 경로 ID 비트 배열 AND/OR로 계산
+ */
+class FXASSETLIB_API FFXLibrarySearchIndex
+{
+public:
+	// 카테고리 항목 추가 (같은 항목이 여러 카테고리에 있으면 이름 토큰은 처음 한 번만 색인)
+	void AddEntry(FFXPathId PathId, const FSoftObjectPath& Path, FName CategoryName);
+
+	// 카테고리 항목 제거 (마지막 카테고리에서 빠지면 모든 토큰 제거)
+	void RemoveEntry(FFXPathId PathId, FName CategoryName);
+
+	// 카테고리의 모든 항목 제거
+	void RemoveCategory(FName CategoryName);
+
+	/**
+	 * 클래스/해시태그 속성 설정 (에셋 레지스트리 값, 모델이 조회하여 전달)
+	 * @param Hashtags 쉼표/공백 구분 목록
+	 * @return 색인이 바뀌었으면 true
+	 */
+	bool SetAttributes(FFXPathId PathId, FName ClassName, const FString& Hashtags);
+
+	// 추가된 뒤 아직 속성이 설정되지 않은 항목을 꺼냄 (모델이 레지스트리 1회 조회로 채움)
+	void ConsumePendingAttributeIds(TArray<FFXPathId>& OutIds);
+
+	// 질의를 만족하는 항목 (경로 ID 오름차순, 빈 질의는 색인된 모든 항목)
+	void Search(const FFXSearchQuery& Query, TArray<FFXPathId>& OutIds) const;
+
+	// 색인된 항목 수 (카테고리 하나 이상에 있는 경로)
+	int32 NumEntries() const { return NumLiveDocuments; }
+	bool ContainsEntry(FFXPathId PathId) const { return LiveDocuments.IsValidIndex(PathId) && LiveDocuments[PathId]; }
+
+	// 항목이 들어 있는 카테고리 (순서 무관, 색인되지 않은 항목은 빈 목록)
+	TConstArrayView<FName> GetEntryCategories(FFXPathId PathId) const;
+	int32 NumTokens() const { return TokenKeys.Num(); }
+
+	void Reset();
+
+	// 메모리 사용량 (문서 + 토큰 사전 + 포스팅)
+	SIZE_T GetAllocatedSize() const;
+
+	// 이름을 검색 토큰으로 분리 (소문자, 구분자/대소문자/숫자 경계, 전체 이름 포함)
+	static void TokenizeName(const FString& Name, TArray<FString>& OutTokens);
+
+private:
+	struct FDocument
+	{
+		TArray<int32, TInlineAllocator<6>> NameTokens;
+		TArray<int32, TInlineAllocator<4>> AttributeTokens;
+		TArray<FName, TInlineAllocator<1>> Categories;
+		bool bAttributesPending = false;
+	};
+
+	static FString MakeTokenKey(EFXSearchField Field, const FString& Token);
+
+	int32 FindOrAddToken(const FString& Key);
+	void AddPostings(FFXPathId PathId, TConstArrayView<int32> TokenIds);
+	void RemovePostings(FFXPathId PathId, TConstArrayView<int32> TokenIds);
+
+	// 키 접두어로 시작하는 모든 토큰의 포스팅을 비트 배열에 합침
+	void CollectPrefix(const FString& KeyPrefix, TBitArray<>& InOutMatches) const;
+
+	// 경로 ID -> 문서 (경로 테이블과 같은 인덱스)
+	TArray<FDocument> Documents;
+	TBitArray<> LiveDocuments;
+	int32 NumLiveDocuments = 0;
+
+	// 토큰 사전 (ID -> 키, 키 -> ID, 키 사전순 ID)
+	TArray<FString> TokenKeys;
+	TMap<FString, int32> TokenLookup;
+	TArray<int32> SortedTokens;
+
+	// 토큰 ID -> 항목 경로 ID
+	TArray<TFXOrderedIndexSet<FFXPathId>> Postings;
+
+	TArray<FFXPathId> PendingAttributeIds;
+};
@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FXLibrarySettings.h"
+#include "Misc/ScopeRWLock.h"
+
+class FFXLibrarySnapshot;
+
+using FFXLibrarySnapshotPtr = TSharedPtr<const FFXLibrarySnapshot, ESPMode::ThreadSafe>;
+using FFXCategorySnapshotRef = TSharedRef<const FFXCategoryData, ESPMode::ThreadSafe>;
+
+/**
+ * FX Library 불변 스냅샷
+ * 확정된(Settings에 반영된) 라이브러리 데이터의 읽기 전용 사본
+ * 한 번 게시된 스냅샷은 바뀌지 않으므로 백그라운드 스레드에서 잠금 없이 읽을 수 있음
+ *
+ * 카테고리 단위 copy-on-write: 바뀌지 않은 카테고리는 이전 스냅샷과 같은 객체를 공유
+ */
+class FXASSETLIB_API FFXLibrarySnapshot
+{
+public:
+	// 게시 순서대로 증가 (0: 아직 로드 전 빈 스냅샷)
+	uint64 GetVersion() const { return Version; }
+
+	// 표시 순서의 카테고리 목록
+	const TArray<FFXCategorySnapshotRef>& GetCategories() const { return Categories; }
+
+	// 이름으로 카테고리 찾기 (없으면 nullptr)
+	const FFXCategoryData* FindCategory(FName CategoryName) const;
+
+	// 전체 카테고리의 등록 항목 수
+	int32 GetNumEntries() const { return NumEntries; }
+
+private:
+	friend class FFXLibrarySnapshotPublisher;
+
+	uint64 Version = 0;
+	TArray<FFXCategorySnapshotRef> Categories;
+	TMap<FName, int32> CategoryIndex;
+	int32 NumEntries = 0;
+};
+
+/**
+ * 스냅샷 게시 통계 (세션 누적)
+ */
+struct FXASSETLIB_API FFXSnapshotStats
+{
+	int32 Published = 0;            // 게시된 스냅샷 수
+	int32 CategoriesCopied = 0;     // 새로 복사한 카테고리
+	int32 CategoriesShared = 0;     // 이전 스냅샷과 공유한 카테고리
+};
+
+/**
+ * 스냅샷 게시기
+ * 게임 스레드: 변경된 카테고리를 표시하고 변경 확정 후 Publish
+ * 모든 스레드: GetSnapshot으로 최신 스냅샷 참조 획득 (포인터 교체 순간에만 짧게 잠금)
+ *
+ * 비동기 작업은 게시기(TSharedRef)나 GetSnapshot 결과를 캡처하여 모델 수명과 무관하게 사용
+ */
+class FXASSETLIB_API FFXLibrarySnapshotPublisher
+{
+public:
+	FFXLibrarySnapshotPublisher();
+
+	// 최신 스냅샷 (스레드 안전, 항상 유효)
+	FFXLibrarySnapshotPtr GetSnapshot() const;
+
+	// 게임 스레드: 다음 게시에서 새로 복사할 카테고리 표시
+	void MarkCategoryDirty(FName CategoryName);
+	void MarkAllDirty();
+
+	bool IsDirty() const { return bAllDirty || DirtyCategories.Num() > 0; }
+
+	/**
+	 * 게임 스레드: 확정된 카테고리 목록으로 새 스냅샷 게시
+	 * 표시된 카테고리만 복사하고 나머지는 이전 스냅샷의 객체를 그대로 공유
+	 * 표시된 변경이 없으면 아무 일도 하지 않음
+	 */
+	void Publish(const TArray<FFXCategoryData>& CommittedCategories);
+
+	const FFXSnapshotStats& GetStats() const { return Stats; }
+
+private:
+	mutable FRWLock SnapshotLock;
+	FFXLibrarySnapshotPtr CurrentSnapshot;
+
+	TSet<FName> DirtyCategories;
+	bool bAllDirty = true;
+
+	FFXSnapshotStats Stats;
+};
@@ -4,6 +4,57 @@
 
 #include "CoreMinimal.h"
 #include "UObject/SoftObjectPath.h"
+#include "FXLibrarySettings.h"
+#include "Model/FXOrderedIndexSet.h"
+#include "Model/FXCategoryTree.h"
+#include "Model/FXPathTable.h"
+#include "Model/FXLibrarySearchIndex.h"
+#include "Model/FXSimilarityIndex.h"
+
+/**
+ * State 메모리 사용량 (항목 = 카테고리별 등록 항목)
+ */
+struct FXASSETLIB_API FFXLibraryStateMemoryStats
+{
+	int32 NumEntries = 0;
+	int32 NumUniquePaths = 0;
+	int32 NumViewItems = 0;
+	SIZE_T PathTableBytes = 0;
+	SIZE_T CategoryBytes = 0;
+	SIZE_T VisibleBytes = 0;
+	SIZE_T SearchIndexBytes = 0;
+	SIZE_T SimilarityIndexBytes = 0;
+
+	double GetBytesPerEntry() const
+	{
+		return NumEntries > 0 ? double(PathTableBytes + CategoryBytes + VisibleBytes + SearchIndexBytes + SimilarityIndexBytes) / NumEntries : 0.0;
+	}
+};
+
+/**
+ * 표시 목록(VisibleAssets) 변경 내용
+ * 항목은 경로 테이블의 뷰 항목이므로 같은 경로는 변경 전후 같은 포인터 (타일 위젯 재사용)
+ */
+struct FXASSETLIB_API FFXVisibleAssetsDelta
+{
+	// 전체 교체 (카테고리 전환, 검색어/유사 이펙트 기준 변경, 로드, 카테고리 항목 일괄 교체)
+	bool bReset = false;
+
+	// 선택된 카테고리에 추가된 항목 (목록 끝에 추가됨)
+	TArray<TSharedPtr<FSoftObjectPath>> Added;
+
+	// 선택된 카테고리에서 제거된 항목
+	TArray<TSharedPtr<FSoftObjectPath>> Removed;
+
+	bool IsEmpty() const { return !bReset && Added.Num() == 0 && Removed.Num() == 0; }
+
+	void Reset()
+	{
+		bReset = false;
+		Added.Reset();
+		Removed.Reset();
+	}
+};
 
 /**
  * FX Library 상태 관리 클래스
@@ -19,24 +70,52 @@ public:
 	DECLARE_MULTICAST_DELEGATE(FOnStateChanged);
 	FOnStateChanged OnStateChanged;
 
-	// 카테고리 관련 상태
+	// 표시 목록 변경 델리게이트 (UpdateVisibleAssets가 목록을 갱신한 직접 호출, 배치 중에는 합쳐서 1회)
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnVisibleAssetsChanged, const FFXVisibleAssetsDelta&);
+	FOnVisibleAssetsChanged OnVisibleAssetsChanged;
+
+	// 카테고리 관련 상태 (Categories: 표시 순서, CategoryToAssets: 카테고리별 경로 ID의 순서 유지 해시 집합)
+	// 항목 경로는 PathTable에 한 번만 저장되며, CategoryToAssets는 아래 조회/변경 함수로 접근
 	TArray<TSharedPtr<FName>> Categories;
-	TMap<FName, TArray<FSoftObjectPath>> CategoryToAssets;
+	TMap<FName, TFXOrderedIndexSet<FFXPathId>> CategoryToAssets;
 	TMap<FName, FSoftObjectPath> CategoryIcons;
+
+	// 파라미터 오버라이드 변형 (라이브러리 항목 경로 -> 변형 정보)
+	TMap<FSoftObjectPath, FFXAssetVariant> AssetVariants;
+
+	// 참조 전용 항목 (복사본이 아닌 프로젝트 원본 에셋)
+	TSet<FSoftObjectPath> ReferencedAssets;
 	TSharedPtr<FName> SelectedCategory;
 	TSharedPtr<FName> HoveredCategory;
 
-	// 현재 표시 중인 에셋 목록
+	// 현재 표시 중인 에셋 목록 (경로 테이블의 뷰 항목 공유, 매번 새로 할당하지 않음)
+	// 선택된 카테고리의 항목 추가/제거는 전체 재구성 없이 목록을 패치
+	// 검색 중에는 모든 카테고리에서 검색어와 일치하는 항목 (변경 시 역색인으로 재검색)
+	// 유사 이펙트 표시 중에는 기준 항목 + 특징 벡터가 가까운 순의 항목
 	TArray<TSharedPtr<FSoftObjectPath>> VisibleAssets;
 
 	// UI 상태
 	bool bIsCategoryModalOpen = false;
 	bool bIsLoading = false;
 
+	// 카테고리 트리에서 펼친 노드 경로 (모달을 다시 열어도 유지)
+	TSet<FName> ExpandedCategoryPaths;
+
 	// 액션: 카테고리 선택
 	void SetSelectedCategory(TSharedPtr<FName> Category);
 	void SetHoveredCategory(TSharedPtr<FName> Category);
 
+	// 액션: 검색어 (비어 있으면 선택된 카테고리 표시, 문법은 FFXSearchQuery)
+	void SetSearchText(const FString& InSearchText);
+	const FString& GetSearchText() const { return SearchText; }
+	bool IsSearchActive() const { return !SearchQuery.IsEmpty(); }
+
+	// 액션: 유사 이펙트 (기준 항목과 특징 벡터가 가까운 항목 표시, 검색어와 동시에 쓰지 않음)
+	void SetSimilarSource(const FSoftObjectPath& EntryPath);
+	void ClearSimilarSource();
+	bool IsSimilarityActive() const { return SimilarSourceId != FXInvalidPathId; }
+	FSoftObjectPath GetSimilarSource() const;
+
 	// 액션: 카테고리 모달
 	void OpenCategoryModal();
 	void CloseCategoryModal();
@@ -47,13 +126,150 @@ public:
 	void LoadCategoryIcon(FName CategoryName, const FSoftObjectPath& IconPath);
 	void UpdateVisibleAssets();
 
+	// 액션: 카테고리 추가/제거 (이름 기준 중복 방지)
+	TSharedPtr<FName> AddCategory(FName CategoryName);
+	bool RemoveCategory(FName CategoryName);
+
+	// 조회: 이름으로 카테고리 항목 찾기 (없으면 nullptr)
+	TSharedPtr<FName> FindCategory(FName CategoryName) const;
+
+	// 조회: 경로형 카테고리 트리 (예: Fire/Torch/Small, 노드별 항목 수는 증분 유지)
+	const FFXCategoryTree& GetCategoryTree() const { return CategoryTree; }
+
 	// 액션: 에셋 관리
 	void AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath);
 	void RemoveAssetFromCategory(FName CategoryName, const FSoftObjectPath& AssetPath);
 
+	// 알림 없이 카테고리 항목 변경 (일괄 처리용, 호출자가 UpdateVisibleAssets/NotifyStateChanged 호출)
+	bool InsertCategoryAsset(FName CategoryName, const FSoftObjectPath& AssetPath);
+	bool EraseCategoryAsset(FName CategoryName, const FSoftObjectPath& AssetPath);
+	void SetCategoryAssets(FName CategoryName, const TArray<FSoftObjectPath>& Assets);
+
+	// 알림 없이 항목 경로를 같은 위치에서 교체 (이름이 바뀐 에셋 따라가기)
+	bool ReplaceCategoryAsset(FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath);
+
+	// 조회: 카테고리 항목
+	TArray<FSoftObjectPath> GetCategoryAssets(FName CategoryName) const;
+	int32 GetCategoryAssetCount(FName CategoryName) const;
+	bool IsAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath) const;
+	bool IsAssetInAnyCategory(const FSoftObjectPath& AssetPath) const;
+
+	// 조회: 에셋(SubPath 제외)을 사용하는 등록 항목 (카테고리, 항목 경로), 경로 테이블 역색인으로 라이브러리 크기와 무관
+	void FindAssetEntries(const FSoftObjectPath& AssetPath, TArray<TPair<FName, FSoftObjectPath>>& OutEntries) const;
+	bool HasAssetEntries(const FSoftObjectPath& AssetPath) const;
+
+	// 검색 속성(클래스/해시태그) 조회가 필요한 에셋 경로를 꺼냄 (추가된 항목, SubPath 제외, 중복 없음)
+	void ConsumePendingSearchAttributeAssets(TArray<FSoftObjectPath>& OutAssetPaths);
+
+	// 에셋(SubPath 제외)을 사용하는 모든 항목의 검색 속성 설정 (호출자가 UpdateVisibleAssets 호출)
+	// @return 검색 색인이 바뀌었으면 true
+	bool SetSearchAttributes(const FSoftObjectPath& AssetPath, FName ClassName, const FString& Hashtags);
+
+	const FFXPathTable& GetPathTable() const { return PathTable; }
+	const FFXLibrarySearchIndex& GetSearchIndex() const { return SearchIndex; }
+
+	// 에셋(SubPath 제외)을 사용하는 모든 항목의 특징 벡터 설정 (호출자가 UpdateVisibleAssets 호출)
+	// @return 유사 이펙트 색인이 바뀌었으면 true
+	bool SetEffectFeatures(const FSoftObjectPath& AssetPath, const FFXEffectFeatures& Features);
+
+	// 에셋(SubPath 제외)의 특징 벡터가 이미 있는지 (백그라운드 추출 대상 선별)
+	bool HasEffectFeatures(const FSoftObjectPath& AssetPath) const;
+
+	const FFXSimilarityIndex& GetSimilarityIndex() const { return SimilarityIndex; }
+	FFXLibraryStateMemoryStats GetMemoryStats() const;
+
+	// 조회: 항목 경로에 해당하는 변형 (변형이 아니면 nullptr)
+	const FFXAssetVariant* FindAssetVariant(const FSoftObjectPath& EntryPath) const;
+
+	// 조회: 참조 전용 항목인지 (false면 라이브러리가 소유한 복사본)
+	bool IsReferencedAsset(const FSoftObjectPath& EntryPath) const;
+
 	// 상태 초기화
 	void Reset();
 
+	// 배치 범위 안에서는 알림을 보류하고 가장 바깥 범위가 끝날 때 1회만 발생
 	void NotifyStateChanged();
+
+	/**
+	 * 변경 알림 병합 범위 (중첩 가능)
+	 * 범위 안의 UpdateVisibleAssets/NotifyStateChanged는 표시만 하고,
+	 * 가장 바깥 범위가 닫힐 때 표시 목록 재구성 1회 + 알림 1회로 합쳐짐
+	 */
+	class FScopedBatch : public FNoncopyable
+	{
+	public:
+		explicit FScopedBatch(FFXLibraryState& InState)
+			: State(InState)
+		{
+			State.BeginBatch();
+		}
+
+		~FScopedBatch()
+		{
+			State.EndBatch();
+		}
+
+	private:
+		FFXLibraryState& State;
+	};
+
+	void BeginBatch();
+	void EndBatch();
+	bool IsInBatch() const { return BatchDepth > 0; }
+
+	// 배치로 생략된 알림 수 (세션 누적)
+	int32 GetSuppressedNotificationCount() const { return SuppressedNotifications; }
+
+private:
+	// 카테고리 이름 -> Categories 항목 (중복 확인/조회 O(1))
+	TMap<FName, TSharedPtr<FName>> CategoryLookup;
+
+	// Categories에서 유도한 계층 (카테고리 추가/제거, 항목 추가/제거마다 증분 갱신)
+	FFXCategoryTree CategoryTree;
+
+	// 항목 경로 인턴 테이블 (카테고리 포함 수로 참조 카운트, 다시 로드 후 참조 없는 ID 정리)
+	FFXPathTable PathTable;
+	bool bPathTableCompactPending = false;
+
+	// 검색 역색인 (카테고리 항목 변경마다 증분 갱신) 및 현재 검색어
+	FFXLibrarySearchIndex SearchIndex;
+	FString SearchText;
+	FFXSearchQuery SearchQuery;
+	TArray<FFXPathId> SearchResults;
+
+	// 유사 이펙트 색인 (특징은 에셋 성질이므로 다시 로드해도 유지) 및 현재 기준 항목
+	FFXSimilarityIndex SimilarityIndex;
+	FFXPathId SimilarSourceId = FXInvalidPathId;
+	TArray<FFXSimilarEffect> SimilarResults;
+
+	// 배치 상태 (보류된 표시 목록 재구성/알림)
+	int32 BatchDepth = 0;
+	bool bVisibleAssetsDirty = false;
+	bool bNotifyPending = false;
+	int32 SuppressedNotifications = 0;
+
+	// 다음 UpdateVisibleAssets에서 반영할 표시 목록 변경
+	FFXVisibleAssetsDelta PendingVisibleDelta;
+
+	bool IsSelectedCategory(FName CategoryName) const
+	{
+		return SelectedCategory.IsValid() && *SelectedCategory == CategoryName;
+	}
+
+	// 카테고리 포함 참조 해제 (마지막 참조면 ID별 색인 정리)
+	void ReleasePathId(FFXPathId PathId);
+	void HandlePathIdFreed(FFXPathId PathId);
+	void CompactPathTable();
+
+	// 검색 결과 또는 유사 이펙트를 표시 중인지 (항목 변경은 패치 대신 재구성)
+	bool IsQueryViewActive() const { return IsSearchActive() || IsSimilarityActive(); }
+
+	// 선택된 카테고리(검색 중이면 검색 결과, 유사 이펙트 표시 중이면 가까운 순) 전체로 표시 목록 재구성
+	void RebuildVisibleAssets();
+
+	// 대기 중인 추가/제거만 표시 목록에 반영 (결과가 카테고리와 다르면 false)
+	bool PatchVisibleAssets();
+
+	void RebuildCategoryLookup();
 };
 
@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FXLibrarySettings.h"
+#include "Model/FXLibraryDatabase.h"
+#include "Model/FXCategoryIndex.h"
+
+/**
+ * FX Library 카테고리 저장소 인터페이스
+ * 모델이 변경하는 확정 데이터(카테고리/항목 목록)와 저장 예약을 추상화
+ *
+ * FFXSettingsLibraryStorage: UFXLibrarySettings + 쓰기 지연 저장 (에디터 기본)
+ * FFXInMemoryLibraryStorage: 메모리 전용 (벤치마크/헤드리스 실행)
+ */
+class FXASSETLIB_API IFXLibraryStorage
+{
+public:
+	virtual ~IFXLibraryStorage() = default;
+
+	// 세션 최초 로드 (백엔드에서 카테고리 읽기)
+	virtual void Load() = 0;
+
+	// 확정된 카테고리 목록 (직접 교체/수정한 뒤에는 InvalidateCategoryIndex 호출)
+	virtual TArray<FFXCategoryData>& GetCategories() = 0;
+	virtual const TArray<FFXCategoryData>& GetCategories() const = 0;
+
+	virtual FFXCategoryData* FindCategory(FName CategoryName) = 0;
+	virtual const FFXCategoryData* FindCategory(FName CategoryName) const = 0;
+
+	virtual FFXCategoryData* AddCategory(FName CategoryName, const FSoftObjectPath& IconPath = FSoftObjectPath()) = 0;
+	virtual bool RemoveCategory(FName CategoryName) = 0;
+	virtual bool AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath) = 0;
+	virtual int32 RemoveAssetFromCategory(FName CategoryName, const FSoftObjectPath& AssetPath) = 0;
+	virtual bool ReplaceAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath) = 0;
+	virtual bool IsAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath) const = 0;
+	virtual void InvalidateCategoryIndex() = 0;
+
+	// 저장 예약 (변경 1건 / 전체)
+	virtual void MarkDirty(const FFXJournalRecord& Record) = 0;
+	virtual void MarkFullSaveDirty() = 0;
+	virtual bool IsDirty() const = 0;
+
+	// 대기 중인 변경 즉시 저장
+	virtual bool Flush() = 0;
+
+	// 팀 공유 라이브러리의 외부 변경을 받는 저장소인지 (Settings 기반만 해당)
+	virtual bool ReceivesSharedChanges() const { return false; }
+};
+
+/**
+ * UFXLibrarySettings 기반 저장소 (Ini / Database / Shared 백엔드는 Settings 설정을 따름)
+ */
+class FXASSETLIB_API FFXSettingsLibraryStorage : public IFXLibraryStorage
+{
+public:
+	virtual void Load() override;
+
+	virtual TArray<FFXCategoryData>& GetCategories() override;
+	virtual const TArray<FFXCategoryData>& GetCategories() const override;
+
+	virtual FFXCategoryData* FindCategory(FName CategoryName) override;
+	virtual const FFXCategoryData* FindCategory(FName CategoryName) const override;
+
+	virtual FFXCategoryData* AddCategory(FName CategoryName, const FSoftObjectPath& IconPath = FSoftObjectPath()) override;
+	virtual bool RemoveCategory(FName CategoryName) override;
+	virtual bool AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath) override;
+	virtual int32 RemoveAssetFromCategory(FName CategoryName, const FSoftObjectPath& AssetPath) override;
+	virtual bool ReplaceAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath) override;
+	virtual bool IsAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath) const override;
+	virtual void InvalidateCategoryIndex() override;
+
+	virtual void MarkDirty(const FFXJournalRecord& Record) override;
+	virtual void MarkFullSaveDirty() override;
+	virtual bool IsDirty() const override;
+	virtual bool Flush() override;
+
+	virtual bool ReceivesSharedChanges() const override { return true; }
+
+private:
+	UFXLibrarySettings* GetSettings() const;
+};
+
+/**
+ * 메모리 전용 저장소 (저장 요청은 횟수만 기록)
+ */
+class FXASSETLIB_API FFXInMemoryLibraryStorage : public IFXLibraryStorage
+{
+public:
+	FFXInMemoryLibraryStorage() = default;
+	explicit FFXInMemoryLibraryStorage(TArray<FFXCategoryData> InCategories);
+
+	virtual void Load() override {}
+
+	virtual TArray<FFXCategoryData>& GetCategories() override { return Categories; }
+	virtual const TArray<FFXCategoryData>& GetCategories() const override { return Categories; }
+
+	virtual FFXCategoryData* FindCategory(FName CategoryName) override;
+	virtual const FFXCategoryData* FindCategory(FName CategoryName) const override;
+
+	virtual FFXCategoryData* AddCategory(FName CategoryName, const FSoftObjectPath& IconPath = FSoftObjectPath()) override;
+	virtual bool RemoveCategory(FName CategoryName) override;
+	virtual bool AddAssetToCategory(FName CategoryName, const FSoftObjectPath& AssetPath) override;
+	virtual int32 RemoveAssetFromCategory(FName CategoryName, const FSoftObjectPath& AssetPath) override;
+	virtual bool ReplaceAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath, const FSoftObjectPath& NewAssetPath) override;
+	virtual bool IsAssetInCategory(FName CategoryName, const FSoftObjectPath& AssetPath) const override;
+	virtual void InvalidateCategoryIndex() override;
+
+	virtual void MarkDirty(const FFXJournalRecord& Record) override;
+	virtual void MarkFullSaveDirty() override;
+	virtual bool IsDirty() const override { return bDirty; }
+	virtual bool Flush() override;
+
+	int32 GetNumMarkedDirty() const { return NumMarkedDirty; }
+	int32 GetNumFlushes() const { return NumFlushes; }
+
+	// MarkDirty로 전달된 저널 레코드 (발생 순서, 테스트에서 재생 결과 비교용)
+	const TArray<FFXJournalRecord>& GetMarkedRecords() const { return MarkedRecords; }
+
+private:
+	TArray<FFXCategoryData> Categories;
+
+	// 이름 -> Categories 인덱스 / 카테고리별 멤버십 (Categories 직접 수정 후 InvalidateCategoryIndex로 재생성)
+	FFXCategoryIndex CategoryIndex;
+
+	TArray<FFXJournalRecord> MarkedRecords;
+	bool bDirty = false;
+	int32 NumMarkedDirty = 0;
+	int32 NumFlushes = 0;
+};
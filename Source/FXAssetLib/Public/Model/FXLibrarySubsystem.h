@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+#include "Model/FXLibraryModel.h"
+#include "FXLibrarySubsystem.generated.h"
+
+class FFXLibraryState;
+struct FAssetData;
+
+/**
+ * FX Library 서비스 (에디터 세션당 1개)
+ * 라이브러리 State/Model을 소유하고 에디터 시작 시 한 번만 로드
+ * 모든 패널/등록 창은 같은 State를 공유하며, State::OnStateChanged로 변경 알림을 받음
+ * (뷰는 AddSP로 바인딩하여 닫힌 뒤에는 자동으로 알림에서 제외)
+ *
+ * 에셋 레지스트리의 삭제/이름 변경/추가 이벤트 중 라이브러리 항목에 해당하는 것만 모아
+ * 다음 틱에 한 번에 모델에 반영 (정리 버튼 없이도 항목이 유효하게 유지되고 이동된 에셋을 따라감)
+ *
+ * 특징 벡터 태그가 없는 항목은 몇 개씩 비동기 로드하여 유사 이펙트 특징을 추출 (패키지 로드는 백그라운드,
+ * 로드된 시스템 순회만 게임 스레드), 추출 결과는 경로별로 State의 유사 이펙트 색인에 캐시
+ */
+UCLASS()
+class FXASSETLIB_API UFXLibrarySubsystem : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// 에디터 서브시스템 조회 (에디터가 없으면 nullptr)
+	static UFXLibrarySubsystem* Get();
+
+	TSharedPtr<FFXLibraryModel> GetModel() const { return Model; }
+	TSharedPtr<FFXLibraryState> GetState() const { return State; }
+
+	// 저장소에서 다시 로드 (Refresh 버튼 등 명시적 요청 시에만)
+	void Reload();
+
+	/**
+	 * 에셋의 특징 벡터를 즉시 추출 (유사 이펙트 기준 항목의 특징이 아직 없을 때, 동기 로드)
+	 * @return 특징이 있거나 추출에 성공하면 true
+	 */
+	bool ExtractEffectFeatures(const FSoftObjectPath& AssetPath);
+
+private:
+	// 에셋 레지스트리 이벤트
+	void HandleAssetAdded(const FAssetData& AssetData);
+	void HandleAssetRemoved(const FAssetData& AssetData);
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	// 라이브러리 항목에 영향을 주는 변경만 대기열에 추가 (같은 틱의 변경은 한 번에 반영)
+	void QueueRegistryChange(EFXAssetRegistryChange Type, const FSoftObjectPath& AffectedPath, const FSoftObjectPath& AssetPath, const FSoftObjectPath& OldAssetPath = FSoftObjectPath());
+
+	// 아직 반영되지 않은 변경의 결과 경로인지 (삭제 직후 되돌리기, 연속 이름 변경)
+	bool IsPendingResultPath(const FSoftObjectPath& AssetPath) const;
+
+	bool FlushRegistryChanges(float DeltaTime);
+
+	// 특징 추출 대기 에셋을 배치 단위로 비동기 로드 (로드 중이면 대기)
+	bool TickFeatureExtraction(float DeltaTime);
+	void HandleFeatureAssetsLoaded(TArray<FSoftObjectPath> AssetPaths);
+
+	TSharedPtr<FFXLibraryState> State;
+	TSharedPtr<FFXLibraryModel> Model;
+
+	TArray<FFXAssetRegistryChange> PendingRegistryChanges;
+	FTSTicker::FDelegateHandle RegistryChangesTickerHandle;
+
+	// 백그라운드 특징 추출
+	FStreamableManager FeatureStreamable;
+	TSharedPtr<FStreamableHandle> FeatureLoadHandle;
+	FTSTicker::FDelegateHandle FeatureExtractionTickerHandle;
+	bool bFeatureLoadInProgress = false;
+};
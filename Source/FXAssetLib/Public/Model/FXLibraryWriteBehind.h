@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Model/FXLibraryDatabase.h"
+
+/**
+ * 쓰기 지연 저장 통계 (세션 누적)
+ */
+struct FXASSETLIB_API FFXWriteBehindStats
+{
+	int32 MutationsMarked = 0;      // 저장 요청된 변경 수
+	int32 Flushes = 0;              // 실제 저장 횟수
+	int32 ConfigWrites = 0;         // ini 저장 (SaveConfig + DefaultGame.ini 갱신)
+	int32 JournalBatches = 0;       // 저널 일괄 추가
+	int32 SnapshotWrites = 0;       // 스냅샷 압축
+	int32 SharedWrites = 0;         // 팀 공유 라이브러리 병합 후 쓰기
+	int32 WritesAvoided = 0;        // 병합되어 생략된 저장 수
+};
+
+/**
+ * FX Library 쓰기 지연 저장기
+ * 라이브러리 변경은 Settings(메모리)에 즉시 반영하고 더티 표시만 하며,
+ * 디바운스 타이머 / 에디터 유휴 / 종료 시점에 한 번에 저장
+ *
+ * Ini 백엔드: 전체 config 1회 저장
+ * Database 백엔드: 대기 중인 저널 레코드를 한 번에 추가 (임계치 초과 또는 전체 변경 시 스냅샷)
+ * Shared 백엔드: 공유 파일에 병합 후 1회 쓰기
+ * 어느 백엔드든 저장에 실패하면 대기 중인 변경을 유지하고 다음 디바운스에 재시도
+ */
+class FXASSETLIB_API FFXLibraryWriteBehind
+{
+public:
+	// 에디터 세션 공용 인스턴스
+	static FFXLibraryWriteBehind& Get();
+
+	// 모듈 시작/종료 시 호출 (종료 시 남은 변경 저장)
+	void Startup();
+	void Shutdown();
+
+	// 변경 1건 저장 요청 (Database 백엔드는 레코드를 저널 대기열에 추가)
+	void MarkDirty(const FFXJournalRecord& Record);
+
+	// 전체 저장 요청 (정리/재구성 등 Settings 카테고리 전체가 바뀐 경우)
+	void MarkFullSaveDirty();
+
+	// 대기 중인 변경을 즉시 저장
+	bool Flush();
+
+	bool IsDirty() const { return bDirty; }
+
+	const FFXWriteBehindStats& GetStats() const { return Stats; }
+
+private:
+	bool Tick(float DeltaTime);
+
+	// 다음 틱에 저장할 조건인지 (디바운스 경과, 최대 지연 초과, 에디터 유휴)
+	bool ShouldFlush(double Now) const;
+
+	void MarkDirtyInternal();
+	void EnsureTicker();
+
+	// 저장 실패 시 대기 중인 변경을 유지한 채 디바운스 타이머를 다시 시작
+	void RearmAfterFailedFlush();
+
+	TArray<FFXJournalRecord> PendingRecords;
+	bool bDirty = false;
+	bool bFullSaveRequired = false;
+
+	double FirstDirtyTime = 0.0;
+	double LastDirtyTime = 0.0;
+	int32 PendingMutations = 0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle PreExitHandle;
+
+	FFXWriteBehindStats Stats;
+};
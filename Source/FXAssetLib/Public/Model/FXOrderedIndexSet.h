@@ -0,0 +1,215 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+
+/**
+ * 삽입 순서(표시 순서)를 유지하는 해시 인덱스 집합
+ * 추가/제거/교체/포함 확인 모두 O(1)
+ * 항목은 연속 배열에 저장하고, 제거된 슬롯은 비트 배열로 표시(툼스톤)한 뒤 절반을 넘으면 한 번에 압축
+ */
+template <typename ElementType>
+class TFXOrderedIndexSet
+{
+public:
+	TFXOrderedIndexSet() = default;
+
+	explicit TFXOrderedIndexSet(const TArray<ElementType>& InElements)
+	{
+		Append(InElements);
+	}
+
+	// 추가 (이미 있으면 false)
+	bool Add(const ElementType& Element)
+	{
+		if (Indices.Contains(Element))
+		{
+			return false;
+		}
+
+		Indices.Add(Element, Slots.Num());
+		Slots.Add(Element);
+		LiveSlots.Add(true);
+		return true;
+	}
+
+	void Append(const TArray<ElementType>& InElements)
+	{
+		Slots.Reserve(Slots.Num() + InElements.Num());
+		LiveSlots.Reserve(LiveSlots.Num() + InElements.Num());
+		Indices.Reserve(Indices.Num() + InElements.Num());
+		for (const ElementType& Element : InElements)
+		{
+			Add(Element);
+		}
+	}
+
+	// 제거 (없으면 false)
+	bool Remove(const ElementType& Element)
+	{
+		int32 SlotIndex = INDEX_NONE;
+		if (!Indices.RemoveAndCopyValue(Element, SlotIndex))
+		{
+			return false;
+		}
+
+		LiveSlots[SlotIndex] = false;
+		NumTombstones++;
+
+		if (NumTombstones > MinTombstonesToCompact && NumTombstones * 2 > Slots.Num())
+		{
+			Compact();
+		}
+		return true;
+	}
+
+	// 같은 위치의 항목 교체 (새 항목이 이미 있으면 기존 항목만 제거)
+	bool Replace(const ElementType& Element, const ElementType& NewElement)
+	{
+		if (Element == NewElement || !Indices.Contains(Element))
+		{
+			return false;
+		}
+
+		if (Indices.Contains(NewElement))
+		{
+			return Remove(Element);
+		}
+
+		int32 SlotIndex = INDEX_NONE;
+		Indices.RemoveAndCopyValue(Element, SlotIndex);
+		Slots[SlotIndex] = NewElement;
+		Indices.Add(NewElement, SlotIndex);
+		return true;
+	}
+
+	bool Contains(const ElementType& Element) const
+	{
+		return Indices.Contains(Element);
+	}
+
+	int32 Num() const
+	{
+		return Indices.Num();
+	}
+
+	bool IsEmpty() const
+	{
+		return Indices.Num() == 0;
+	}
+
+	void Reset()
+	{
+		Slots.Reset();
+		LiveSlots.Reset();
+		Indices.Reset();
+		NumTombstones = 0;
+	}
+
+	// 메모리 사용량 (슬롯 배열 + 해시 인덱스)
+	SIZE_T GetAllocatedSize() const
+	{
+		return Slots.GetAllocatedSize() + LiveSlots.GetAllocatedSize() + Indices.GetAllocatedSize();
+	}
+
+	// 표시 순서대로 배열로 변환
+	TArray<ElementType> ToArray() const
+	{
+		TArray<ElementType> Result;
+		Result.Reserve(Num());
+		for (const ElementType& Element : *this)
+		{
+			Result.Add(Element);
+		}
+		return Result;
+	}
+
+	/**
+	 * 툼스톤을 건너뛰는 읽기 전용 반복자 (range-for 지원)
+	 */
+	class FConstIterator
+	{
+	public:
+		FConstIterator(const TArray<ElementType>& InSlots, const TBitArray<>& InLiveSlots, int32 InIndex)
+			: Slots(InSlots)
+			, LiveSlots(InLiveSlots)
+			, Index(InIndex)
+		{
+			SkipTombstones();
+		}
+
+		const ElementType& operator*() const
+		{
+			return Slots[Index];
+		}
+
+		FConstIterator& operator++()
+		{
+			++Index;
+			SkipTombstones();
+			return *this;
+		}
+
+		bool operator!=(const FConstIterator& Other) const
+		{
+			return Index != Other.Index;
+		}
+
+	private:
+		void SkipTombstones()
+		{
+			while (Index < Slots.Num() && !LiveSlots[Index])
+			{
+				++Index;
+			}
+		}
+
+		const TArray<ElementType>& Slots;
+		const TBitArray<>& LiveSlots;
+		int32 Index;
+	};
+
+	FConstIterator begin() const
+	{
+		return FConstIterator(Slots, LiveSlots, 0);
+	}
+
+	FConstIterator end() const
+	{
+		return FConstIterator(Slots, LiveSlots, Slots.Num());
+	}
+
+private:
+	// 툼스톤을 제거하고 인덱스 재작성 (순서 유지)
+	void Compact()
+	{
+		int32 WriteIndex = 0;
+		for (int32 ReadIndex = 0; ReadIndex < Slots.Num(); ++ReadIndex)
+		{
+			if (!LiveSlots[ReadIndex])
+			{
+				continue;
+			}
+
+			if (WriteIndex != ReadIndex)
+			{
+				Slots[WriteIndex] = MoveTemp(Slots[ReadIndex]);
+			}
+			Indices.FindChecked(Slots[WriteIndex]) = WriteIndex;
+			WriteIndex++;
+		}
+
+		Slots.SetNum(WriteIndex);
+		LiveSlots.Init(true, WriteIndex);
+		NumTombstones = 0;
+	}
+
+	static constexpr int32 MinTombstonesToCompact = 32;
+
+	TArray<ElementType> Slots;
+	TBitArray<> LiveSlots;
+	TMap<ElementType, int32> Indices;
+	int32 NumTombstones = 0;
+};
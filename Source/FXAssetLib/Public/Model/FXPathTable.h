@@ -0,0 +1,73 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+// 라이브러리 항목 경로 ID (경로 테이블 인덱스)
+using FFXPathId = uint32;
+static constexpr FFXPathId FXInvalidPathId = MAX_uint32;
+
+/**
+ * 라이브러리 항목 경로 인턴 테이블
+ * 같은 경로는 한 번만 저장하고 32비트 ID로 참조
+ * 에셋 경로 -> 항목 ID 역색인으로 레지스트리 변경(삭제/이름 변경)의 영향 항목을 바로 찾음
+ * 뷰(STileView) 항목용 공유 포인터는 경로마다 처음 표시될 때 한 번만 생성하여 재사용
+ * ID는 카테고리 포함 수로 참조 카운트하며, 0이 되면 해제하고 다음 등록에 재사용
+ */
+class FXASSETLIB_API FFXPathTable
+{
+public:
+	// 경로 등록 (이미 있으면 기존 ID, 새 ID의 참조 카운트는 0)
+	FFXPathId Intern(const FSoftObjectPath& Path);
+
+	// 카테고리 포함 참조 추가/해제
+	// @return Release는 마지막 참조가 빠져 ID가 해제되었으면 true (호출자가 ID별 색인 정리)
+	void AddRef(FFXPathId Id);
+	bool Release(FFXPathId Id);
+
+	// 다시 로드 시작: 모든 참조 카운트를 0으로 (ID는 유지하여 같은 경로는 같은 ID/뷰 항목 재사용)
+	void ClearRefCounts();
+
+	// 다시 로드 후 참조가 없는 ID 해제
+	void Compact(TArray<FFXPathId>& OutFreedIds);
+
+	// 등록된 경로의 ID (없으면 FXInvalidPathId)
+	FFXPathId Find(const FSoftObjectPath& Path) const;
+
+	// 에셋 경로(SubPath 제외)로 등록된 모든 항목 ID (기본 항목 + 변형 항목, 역색인 조회)
+	void FindByAssetPath(const FSoftObjectPath& AssetPath, TArray<FFXPathId>& OutIds) const;
+
+	const FSoftObjectPath& Get(FFXPathId Id) const
+	{
+		return Paths[Id];
+	}
+
+	// 뷰 항목 (경로당 하나, 카테고리 전환 시 할당 없이 참조 카운트만 증가)
+	const TSharedPtr<FSoftObjectPath>& GetViewItem(FFXPathId Id);
+
+	// 사용 중인 경로 수 (해제된 ID 제외)
+	int32 Num() const { return Paths.Num() - FreeIds.Num(); }
+
+	// 생성된 뷰 항목 수
+	int32 NumViewItems() const { return NumCreatedViewItems; }
+
+	void Reset();
+
+	// 메모리 사용량 (경로 배열 + 해시 인덱스 + 뷰 항목)
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	TArray<FSoftObjectPath> Paths;
+	TMap<FSoftObjectPath, FFXPathId> Ids;
+	TMap<FSoftObjectPath, TArray<FFXPathId, TInlineAllocator<1>>> IdsByAssetPath;
+	TArray<TSharedPtr<FSoftObjectPath>> ViewItems;
+	int32 NumCreatedViewItems = 0;
+
+	// ID별 카테고리 포함 수, 해제된 ID (재사용 대기)
+	TArray<int32> RefCounts;
+	TArray<FFXPathId> FreeIds;
+
+	void Free(FFXPathId Id);
+};
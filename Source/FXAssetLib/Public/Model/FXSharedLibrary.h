@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FXLibrarySettings.h"
+
+struct FFileChangeData;
+
+/**
+ * 외부 변경 알림 (Settings 카테고리에 이미 반영된 뒤 호출)
+ * @param ChangedCategories 추가되었거나 내용이 바뀐 카테고리
+ * @param RemovedCategories 삭제된 카테고리
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnFXSharedLibraryChanged, const TArray<FName>& /*ChangedCategories*/, const TArray<FName>& /*RemovedCategories*/);
+
+/**
+ * 팀 공유 FX 라이브러리
+ * 공유 디렉터리의 스냅샷 파일(FFXLibraryDatabase 형식)을 팀 전체가 함께 사용
+ *
+ * 쓰기: 잠금 파일을 얻은 뒤 디스크의 최신 내용과 3-way 병합 후 원자적으로 교체
+ * 읽기: 디렉터리 감시로 외부 변경을 감지하고, 바뀐 카테고리만 Settings와 각 모델의 State에 반영
+ *
+ * 파일 위치: <SharedLibraryDirectory>/FXLibrary.fxdb, FXLibrary.fxdb.lock
+ */
+class FXASSETLIB_API FFXSharedLibrary
+{
+public:
+	// 에디터 세션 공용 인스턴스
+	static FFXSharedLibrary& Get();
+
+	/**
+	 * 공유 파일을 Settings 카테고리로 로드하고 디렉터리 감시 시작
+	 * 공유 파일이 없으면 현재 Settings 카테고리로 새로 만듦
+	 * @return 공유 파일에서 로드했으면 true
+	 */
+	bool Load();
+
+	/**
+	 * 현재 Settings 카테고리를 공유 파일에 병합 후 기록
+	 * 다른 사용자의 변경이 병합되면 Settings에 반영하고 OnExternalChange 발생
+	 * @return 잠금 획득 및 쓰기 성공 여부
+	 */
+	bool Write();
+
+	// 디렉터리 감시 해제
+	void Shutdown();
+
+	// 이번 세션에 Load가 수행되었는지
+	bool IsLoaded() const { return bLoaded; }
+
+	FString GetLibraryPath() const;
+	FString GetLockPath() const;
+
+	/**
+	 * 카테고리 3-way 병합 (Base: 마지막으로 동기화한 공유 내용)
+	 * 카테고리/항목 단위로 한쪽만 바꾼 내용은 그대로 반영, 양쪽이 추가한 항목은 모두 유지
+	 * 한쪽이 삭제하고 다른 쪽이 수정한 카테고리는 유지
+	 */
+	static void MergeCategories(
+		const TArray<FFXCategoryData>& Base,
+		const TArray<FFXCategoryData>& Ours,
+		const TArray<FFXCategoryData>& Theirs,
+		TArray<FFXCategoryData>& OutMerged);
+
+	FOnFXSharedLibraryChanged OnExternalChange;
+
+private:
+	bool ReadSharedFile(TArray<FFXCategoryData>& OutCategories, uint32& OutCrc) const;
+	bool WriteSharedFile(const TArray<FFXCategoryData>& Categories);
+
+	// 잠금 파일 (한 번만 시도, 없으면 생성, 오래된 잠금은 제거 후 생성)
+	bool AcquireLock();
+	void ReleaseLock();
+
+	void StartWatching();
+	void OnDirectoryChanged(const TArray<FFileChangeData>& FileChanges);
+
+	// 디스크의 공유 내용을 로컬 변경과 병합하여 반영
+	void SyncFromDisk();
+
+	// 병합 결과를 Settings에 적용하고 바뀐 카테고리만 알림
+	void ApplyMerged(TArray<FFXCategoryData>&& Merged);
+
+	// 마지막으로 읽거나 쓴 공유 내용 (병합 기준)
+	TArray<FFXCategoryData> BaseCategories;
+	uint32 LastKnownCrc = 0;
+
+	FString WatchedDirectory;
+	FDelegateHandle WatcherHandle;
+	FString LockOwner;
+	bool bLoaded = false;
+};
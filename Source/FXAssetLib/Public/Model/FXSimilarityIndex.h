@@ -0,0 +1,110 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Model/FXPathTable.h"
+
+/**
+ * 이펙트 특징 벡터 (나이아가라 시스템 요약, 각 차원은 대략 0~1로 정규화되어 그대로 유클리드 거리로 비교)
+ * 라이브러리 복사본은 등록 시 FXLib.Features 태그로 저장되어 로드 없이 읽음
+ */
+struct FXASSETLIB_API FFXEffectFeatures
+{
+	enum EDimension : int32
+	{
+		EmitterCount,           // log2(1 + 활성 이미터 수) / 5
+		GpuEmitterRatio,        // GPU 시뮬레이션 이미터 비율
+		SpriteRatio,            // 렌더러 종류 비율
+		MeshRatio,
+		RibbonRatio,
+		LightRatio,
+		OtherRendererRatio,
+		RenderersPerEmitter,    // log2(1 + 이미터당 렌더러 수) / 3
+		SpawnRate,              // log10(1 + 초당 스폰 수 합) / 4
+		BurstCount,             // log10(1 + 버스트 스폰 수 합) / 4
+		ColorR,                 // 대표 색조 (색 파라미터의 최대 채널로 나눈 평균)
+		ColorG,
+		ColorB,
+		ColorIntensity,         // log2(1 + 최대 채널 평균) / 6 (HDR 발광 세기)
+		MaterialCount,          // log2(1 + 고유 머테리얼 수) / 5
+		TextureCount,           // log2(1 + 고유 텍스처 수) / 6
+		NumDimensions
+	};
+
+	float Values[NumDimensions] = {};
+
+	// 태그 값 형식 ("0.25,0,1,..." 차원 순서)
+	FString ToTagString() const;
+	static bool ParseTagString(const FString& Text, FFXEffectFeatures& OutFeatures);
+
+	bool operator==(const FFXEffectFeatures& Other) const
+	{
+		return FMemory::Memcmp(Values, Other.Values, sizeof(Values)) == 0;
+	}
+};
+
+/**
+ * 유사 이펙트 검색 결과 1건
+ */
+struct FFXSimilarEffect
+{
+	FFXPathId PathId = FXInvalidPathId;
+	float Distance = 0.0f;
+};
+
+/**
+ * 이펙트 특징 벡터 최근접 이웃 색인 (경로 ID -> 특징 행)
+ *
+ * 4개 행을 한 블록에 차원별로 모아 두고(블록당 차원 x 4열), 질의 1회에
+ * 블록마다 차원 수만큼의 SIMD 뺄셈/곱셈-덧셈으로 4개 행의 거리를 동시에 계산
+ * 전체 스캔이지만 16차원 x 5만 행도 1 ms 안팎이라 별도 트리 구조 없이 항상 정확한 결과
+ *
+ * 행은 경로 ID별로 유지되며, 항목이 마지막 카테고리에서 빠져 ID가 해제되면 FFXLibraryState가 행을 제거 (해제된 ID는 다른 경로에 재사용됨)
+ * 다시 로드 중에는 ID 정리가 배치 끝으로 미뤄지므로 그 사이 카테고리에 없는 행은 질의 시 필터로 제외
+ */
+class FXASSETLIB_API FFXSimilarityIndex
+{
+public:
+	/**
+	 * 항목의 특징 설정 (있으면 덮어씀)
+	 * @return 값이 바뀌었으면 true
+	 */
+	bool SetFeatures(FFXPathId PathId, const FFXEffectFeatures& Features);
+
+	bool Contains(FFXPathId PathId) const;
+	bool GetFeatures(FFXPathId PathId, FFXEffectFeatures& OutFeatures) const;
+	bool Remove(FFXPathId PathId);
+
+	/**
+	 * 질의 벡터와 가까운 항목 (거리 오름차순)
+	 * @param MaxResults 반환할 최대 개수
+	 * @param Filter false를 반환하는 항목은 제외 (상위 후보에 들 때만 호출)
+	 */
+	void FindNearest(const FFXEffectFeatures& Query, int32 MaxResults, TFunctionRef<bool(FFXPathId)> Filter, TArray<FFXSimilarEffect>& OutResults) const;
+
+	int32 Num() const { return RowPathIds.Num(); }
+
+	void Reset();
+
+	// 메모리 사용량 (블록 + 행 매핑)
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	static constexpr int32 LanesPerBlock = 4;
+
+	// 4개 행의 특징 (Values[차원][열], 차원마다 16바이트 정렬된 4열을 한 레지스터로 로드)
+	struct alignas(16) FBlock
+	{
+		float Values[FFXEffectFeatures::NumDimensions][LanesPerBlock];
+	};
+
+	void WriteRow(int32 Row, const FFXEffectFeatures& Features);
+	void ReadRow(int32 Row, FFXEffectFeatures& OutFeatures) const;
+
+	TArray<FBlock> Blocks;
+
+	// 행 -> 경로 ID, 경로 ID -> 행 (없으면 INDEX_NONE)
+	TArray<FFXPathId> RowPathIds;
+	TArray<int32> PathRows;
+};
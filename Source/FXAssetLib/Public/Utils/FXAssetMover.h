@@ -8,6 +8,7 @@
 
 // Forward declarations
 struct FReferencedAsset;
+struct FFXRegistrationStats;
 
 /**
  * 에셋 복사/이동 유틸리티 클래스
@@ -43,13 +44,15 @@ public:
 	 * @param DestinationFolderPath 대상 폴더 경로
 	 * @param NewAssetName 새로운 에셋 이름 (확장자 제외)
 	 * @param RootPath 루트 경로 (참조된 에셋들의 폴더 경로 생성에 사용)
+	 * @param OutReferenceMap 사용된 원본 경로 -> 새 경로 매핑 (선택, 변형 생성 시 재사용)
 	 * @return 복사된 에셋의 경로 (실패 시 빈 경로)
 	 */
 	static FSoftObjectPath CopyAssetWithReferences(
 		const FSoftObjectPath& SourceAssetPath,
 		const FString& DestinationFolderPath,
 		const FString& NewAssetName,
-		const FString& RootPath
+		const FString& RootPath,
+		TMap<FSoftObjectPath, FSoftObjectPath>* OutReferenceMap = nullptr
 	);
 
 	/**
@@ -63,20 +66,76 @@ public:
 		const TMap<FSoftObjectPath, FSoftObjectPath>& ReferenceMap
 	);
 
+	/**
+	 * 에셋의 패키지를 디스크에 저장
+	 * @param Asset 저장할 에셋
+	 * @return 성공 여부
+	 */
+	static bool SaveAssetPackage(UObject* Asset);
+
+	/**
+	 * 라이브러리 메타데이터 키를 에셋 레지스트리 태그로 노출 (모듈 시작 시 1회)
+	 * 패키지 메타데이터 중 등록된 키만 저장 시 태그로 기록되어 로드 없이 조회 가능
+	 */
+	static void RegisterLibraryMetadataTags();
+
+	/**
+	 * 등록된 라이브러리 복사본에 카테고리/해시태그(나이아가라 시스템은 특징 벡터도) 메타데이터 기록 후 저장
+	 * @param AssetPath 복사된 에셋 경로
+	 * @param CategoryName 등록 카테고리
+	 * @param Hashtags 사용자 입력 해시태그 (공백/쉼표 구분, # 생략 가능)
+	 * @return 성공 여부
+	 */
+	static bool WriteLibraryMetadata(
+		const FSoftObjectPath& AssetPath,
+		FName CategoryName,
+		const FString& Hashtags
+	);
+
+	/**
+	 * 해시태그 입력을 태그 값 형식으로 정규화 (예: "#fire smoke, #Fire" -> "fire,smoke")
+	 */
+	static FString NormalizeHashtags(const FString& Hashtags);
+
+	/**
+	 * 마지막 등록(CopyAssetWithReferences 호출 이후)의 경로 처리 통계
+	 */
+	static const FFXRegistrationStats& GetLastRegistrationStats();
+
+	/**
+	 * 머테리얼의 Expression 목록 수집 (ExpressionCollection 우선, 실패 시 Expressions 배열)
+	 * @param Material 대상 머테리얼
+	 * @param OutExpressions 수집된 Expression 목록
+	 */
+	static void CollectMaterialExpressions(
+		class UMaterial* Material,
+		TArray<class UMaterialExpression*, TInlineAllocator<64>>& OutExpressions
+	);
+
 private:
 	/**
-	 * 대상 폴더에서 같은 이름의 에셋을 검색
+	 * 대상 폴더에서 같은 이름의 에셋을 검색 (Package.Asset 경로로 직접 조회)
 	 * @param DestinationFolder 대상 폴더 경로
 	 * @param AssetName 에셋 이름
 	 * @return 찾은 에셋 경로 (없으면 빈 경로)
 	 */
 	static FSoftObjectPath FindExistingAsset(
-		const FString& DestinationFolder,
-		const FString& AssetName
+		FName DestinationFolder,
+		FName AssetName
 	);
 
 	/**
-	 * 두 에셋이 같은 원본에서 복사된 것인지 확인
+	 * 에셋 타입별 대상 폴더 경로 (루트 경로/타입 단위로 캐시)
+	 */
+	static FName GetDestinationFolder(const FString& RootPath, FName AssetType);
+
+	/**
+	 * 현재 등록의 통계 (수정용)
+	 */
+	static FFXRegistrationStats& GetMutableRegistrationStats();
+
+	/**
+	 * 두 에셋이 같은 원본에서 복사된 것인지 확인 (기존 에셋의 FXLib.Source 태그 비교, 로드 없음)
 	 * @param SourceAssetPath 원본 에셋 경로
 	 * @param ExistingAssetPath 기존 에셋 경로
 	 * @return 같은 원본이면 true
@@ -94,7 +153,7 @@ private:
 	 * @param ReferenceMap 원본 경로 -> 새 경로 매핑 (출력)
 	 */
 	static void CopyReferencedAssetsRecursive(
-		const TArray<FReferencedAsset>& ReferencedAssets,
+		const TArray<FReferencedAsset, TInlineAllocator<16>>& ReferencedAssets,
 		const FString& RootPath,
 		TSet<FSoftObjectPath>& ProcessedAssets,
 		TMap<FSoftObjectPath, FSoftObjectPath>& ReferenceMap
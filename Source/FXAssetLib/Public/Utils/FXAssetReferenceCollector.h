@@ -14,7 +14,7 @@ struct FAssetIdentifier;
 struct FXASSETLIB_API FReferencedAsset
 {
 	FSoftObjectPath AssetPath;      // 참조된 에셋 경로
-	FString AssetType;               // 에셋 타입 (예: "Texture2D", "Material")
+	FName AssetType;                 // 에셋 타입 (예: "Texture2D", "Material")
 	//FString ReferenceType;           // 참조 타입 (Hard/Soft)
 
 	FReferencedAsset()
@@ -24,7 +24,7 @@ struct FXASSETLIB_API FReferencedAsset
 	{
 	}
 
-	FReferencedAsset(const FSoftObjectPath& InAssetPath, const FString& InAssetType)// , const FString& InReferenceType)
+	FReferencedAsset(const FSoftObjectPath& InAssetPath, FName InAssetType)// , const FString& InReferenceType)
 		: AssetPath(InAssetPath)
 		, AssetType(InAssetType)
 		//, ReferenceType(InReferenceType)
@@ -32,6 +32,26 @@ struct FXASSETLIB_API FReferencedAsset
 	}
 };
 
+/**
+ * 참조 목록 (대부분의 에셋은 참조가 적으므로 인라인 저장)
+ */
+using FReferencedAssetArray = TArray<FReferencedAsset, TInlineAllocator<16>>;
+
+/**
+ * 등록 1회 동안의 경로 처리 통계
+ * 레지스트리 조회 수가 참조 수가 아닌 복사된 패키지 수에 비례하는지 확인하는 용도
+ */
+struct FXASSETLIB_API FFXRegistrationStats
+{
+	int32 RegistryQueries = 0;          // Asset Registry 조회 수
+	int32 CopiedPackages = 0;           // 복사된 패키지 수
+
+	void Reset()
+	{
+		*this = FFXRegistrationStats();
+	}
+};
+
 /**
  * 에셋 참조 수집 유틸리티 클래스
  * Reference Viewer의 "Show Referenced" 기능과 유사한 기능 제공
@@ -42,9 +62,10 @@ public:
 	/**
 	 * 특정 에셋이 참조하는 모든 에셋 목록을 수집합니다.
 	 * @param AssetPath 참조를 수집할 에셋의 경로
+	 * @param Stats 조회/문자열 생성 수를 누적할 통계 (선택)
 	 * @return 참조된 에셋 목록
 	 */
-	static TArray<FReferencedAsset> CollectAllReferences(const FSoftObjectPath& AssetPath);
+	static FReferencedAssetArray CollectAllReferences(const FSoftObjectPath& AssetPath, FFXRegistrationStats* Stats = nullptr);
 
 private:
 	/**
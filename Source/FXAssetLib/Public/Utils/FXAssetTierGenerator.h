@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+// Forward declarations
+struct FFXCostTierSettings;
+class UNiagaraSystem;
+
+/**
+ * 비용 티어 변형 생성 유틸리티 클래스
+ * 등록된 나이아가라 시스템을 복제하여 Low/Medium 등 티어별로 스폰/파티클 수를 줄인 형제 에셋 생성
+ * 기본 복사본과 변형의 연결은 기본 복사본의 FXLib.Tiers 레지스트리 태그로 기록 (이름 변경 후에도 조회 가능)
+ */
+class FXASSETLIB_API FXAssetTierGenerator
+{
+public:
+	/**
+	 * 라이브러리 기본 복사본으로부터 티어별 변형을 생성
+	 * 참조 갱신/이미터 공유/텍스처 패킹이 끝난 기본 복사본을 복제하므로 변형도 같은 처리 결과를 공유
+	 * 라이브러리 메타데이터(WriteLibraryMetadata) 기록 전에 호출해야 변형이 카테고리 태그를 물려받지 않음
+	 * @param BaseAssetPath 기본 복사본 경로
+	 * @param DestinationFolderPath 대상 폴더 경로 (기본 복사본과 같은 카테고리 폴더)
+	 * @param Tiers 생성할 티어 설정 목록
+	 * @return 생성된 변형 에셋 경로 목록
+	 */
+	static TArray<FSoftObjectPath> GenerateCostTiers(
+		const FSoftObjectPath& BaseAssetPath,
+		const FString& DestinationFolderPath,
+		const TArray<FFXCostTierSettings>& Tiers
+	);
+
+	/**
+	 * 기본 에셋의 티어 변형 경로를 반환
+	 * 기본 복사본의 FXLib.Tiers 태그로 조회하고 변형이 이동되었으면 리다이렉터를 따라감
+	 * (태그 기록 전에 등록된 에셋은 같은 폴더의 BaseName_TierName)
+	 * @param BaseAssetPath 라이브러리에 등록된 기본 에셋 경로 (변형 항목이면 SubPath 무시)
+	 * @param TierName 티어 이름
+	 * @return 변형 에셋 경로 (존재하지 않으면 빈 경로)
+	 */
+	static FSoftObjectPath FindTierVariant(const FSoftObjectPath& BaseAssetPath, FName TierName);
+
+private:
+	/**
+	 * 티어 설정을 나이아가라 시스템에 적용 (스폰 스케일, 파티클 수, 이미터 비활성화)
+	 * @return 변경 사항이 있으면 true
+	 */
+	static bool ApplyTierToSystem(UNiagaraSystem* NiagaraSystem, const FFXCostTierSettings& Tier);
+
+	/**
+	 * 티어 변형 에셋 이름 생성
+	 */
+	static FString MakeTierAssetName(const FString& BaseAssetName, FName TierName);
+
+	/**
+	 * 티어 태그 값 변환 ("Low=/Game/.../NS_Fire_Low.NS_Fire_Low,Medium=...")
+	 */
+	static FString MakeTierTagString(const TArray<TPair<FName, FSoftObjectPath>>& TierLinks);
+	static FSoftObjectPath FindTierInTagString(const FString& TagString, FName TierName);
+};
@@ -0,0 +1,27 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class UNiagaraSystem;
+struct FFXEffectFeatures;
+
+/**
+ * 이펙트 특징 추출 유틸리티 클래스
+ * 참조 갱신(UpdateNiagaraAssetReferences)과 같은 경로(이미터 핸들 -> 렌더러 -> 머테리얼)를 순회하며
+ * 유사 이펙트 검색용 특징 벡터를 계산 (에셋 로드 후 게임 스레드에서 호출)
+ */
+class FXASSETLIB_API FXEffectFeatureExtractor
+{
+public:
+	/**
+	 * 나이아가라 시스템의 특징 벡터 계산
+	 * 이미터 수/GPU 비율, 렌더러 종류 비율, 스폰 속도/버스트 수, 색 파라미터의 대표 색, 머테리얼/텍스처 수
+	 * @param NiagaraSystem 로드된 시스템
+	 * @param OutFeatures 계산된 특징 (출력)
+	 * @return 활성 이미터가 하나 이상이면 true
+	 */
+	static bool ExtractFeatures(const UNiagaraSystem* NiagaraSystem, FFXEffectFeatures& OutFeatures);
+};
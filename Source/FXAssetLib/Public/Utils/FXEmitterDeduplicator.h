@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+// Forward declarations
+class UNiagaraSystem;
+class UNiagaraEmitter;
+struct FVersionedNiagaraEmitterData;
+
+/**
+ * 공유 이미터 유틸리티 클래스
+ * 라이브러리 시스템들 사이에서 구조가 동일한 이미터를 찾아 RootPath/Emitters 의 공유 UNiagaraEmitter 에셋으로 묶고
+ * 각 시스템의 이미터가 공유 에셋을 부모로 상속하도록 설정
+ */
+class FXASSETLIB_API FXEmitterDeduplicator
+{
+public:
+	/**
+	 * 시스템의 이미터들을 공유 이미터에 연결 (없으면 새 공유 이미터 생성)
+	 * @param NiagaraSystem 라이브러리에 복사된 나이아가라 시스템
+	 * @param RootPath 라이브러리 루트 경로
+	 * @return 공유 이미터에 연결된 이미터 수
+	 */
+	static int32 ShareIdenticalEmitters(UNiagaraSystem* NiagaraSystem, const FString& RootPath);
+
+	/**
+	 * 이미터의 구조 해시 계산
+	 * 스크립트 그래프 컴파일 해시, 모듈 입력 상수(RapidIterationParameters), 시뮬레이션 설정,
+	 * 렌더러 종류/머테리얼 참조/속성 값을 조합 (이름/GUID 제외)
+	 * 해시가 같은 이미터만 공유 이미터를 부모로 삼으므로 상속 병합 후에도 동작이 바뀌지 않음
+	 * @param UniqueEmitterName 파라미터 이름에 들어가는 이미터 고유 이름 (시스템 간 비교를 위해 정규화)
+	 * @return 해시 문자열 (계산 불가 시 빈 문자열)
+	 */
+	static FString ComputeEmitterHash(const FVersionedNiagaraEmitterData& EmitterData, const FString& UniqueEmitterName);
+
+private:
+	/**
+	 * RootPath의 공유 이미터 해시 인덱스 반환 (처음 호출 시 폴더를 스캔하여 생성)
+	 */
+	static TMap<FString, FSoftObjectPath>& GetSharedEmitterIndex(const FString& RootPath);
+
+	/**
+	 * 이미터 인스턴스를 복제하여 공유 이미터 에셋 생성
+	 */
+	static UNiagaraEmitter* CreateSharedEmitter(UNiagaraEmitter* SourceEmitter, const FString& EmitterName, const FString& RootPath);
+};
@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "FXLibraryScriptingLibrary.generated.h"
+
+/**
+ * 라이브러리 조회 조건 (비어 있는 조건은 적용하지 않음)
+ */
+USTRUCT(BlueprintType)
+struct FFXLibraryQuery
+{
+	GENERATED_BODY()
+
+	// 조회할 카테고리 (비어 있으면 전체)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Query")
+	TArray<FName> Categories;
+
+	// 에셋 클래스 (하위 클래스 포함, 변형은 기본 에셋 클래스로 판단)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Query")
+	TArray<TObjectPtr<UClass>> Classes;
+
+	// 에셋 레지스트리 태그 (모두 일치해야 함, 값이 비어 있으면 태그 존재 여부만 확인)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Query")
+	TMap<FName, FString> Tags;
+
+	// 파라미터 오버라이드 변형 항목 포함 여부
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Query")
+	bool bIncludeVariants = true;
+};
+
+/**
+ * 라이브러리 조회 결과 항목
+ */
+USTRUCT(BlueprintType)
+struct FFXLibraryEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Entry")
+	FName Category;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Entry")
+	FSoftObjectPath Path;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Entry")
+	bool bIsVariant = false;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Entry")
+	bool bIsReferenced = false;
+};
+
+/**
+ * FX Library 스크립팅 API (Blueprint / Python: unreal.FXLibraryScriptingLibrary)
+ * 배열 단위로 처리하며, 각 호출은 하나의 트랜잭션으로 변경 알림 1회, 저장 1회만 수행
+ */
+UCLASS()
+class FXASSETLIB_API UFXLibraryScriptingLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * 카테고리에 항목 일괄 추가 (이미 있는 항목은 건너뜀)
+	 * @return 추가된 항목 수
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FX Library|Scripting")
+	static int32 AddAssets(FName Category, const TArray<FSoftObjectPath>& AssetPaths, bool bCreateCategory = true);
+
+	/**
+	 * 카테고리에서 항목 일괄 제거 (Category가 None이면 모든 카테고리에서 제거)
+	 * @return 제거된 항목 수
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FX Library|Scripting")
+	static int32 RemoveAssets(FName Category, const TArray<FSoftObjectPath>& AssetPaths);
+
+	/**
+	 * 항목을 다른 카테고리로 일괄 이동 (변형/참조 정보 유지)
+	 * @return 이동된 항목 수
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FX Library|Scripting")
+	static int32 MoveAssets(FName SourceCategory, FName TargetCategory, const TArray<FSoftObjectPath>& AssetPaths);
+
+	/**
+	 * 조건에 맞는 항목 조회 (에셋 레지스트리는 한 번만 조회)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FX Library|Scripting")
+	static TArray<FFXLibraryEntry> QueryEntries(const FFXLibraryQuery& Query);
+
+	/**
+	 * RootPath 하위 라이브러리 복사본의 레지스트리 태그로 항목 복구 (에셋 로드 없음)
+	 * 이미 등록된 항목은 건너뜀
+	 * @return 추가된 항목 수
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FX Library|Scripting")
+	static int32 RebuildFromAssetRegistry(const FString& RootPath);
+
+	// 카테고리 목록 (표시 순서)
+	UFUNCTION(BlueprintCallable, Category = "FX Library|Scripting")
+	static TArray<FName> GetCategories();
+};
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+// Forward declarations
+class UMaterial;
+
+/**
+ * 마스터 머테리얼 중복 제거 유틸리티 클래스
+ * 머테리얼 그래프 해시가 같은 라이브러리 마스터 머테리얼(RootPath/Materials)을 찾아
+ * 복사 대신 재사용할 수 있도록 함 (셰이더 퍼뮤테이션/셰이더 메모리 절감)
+ * 라이브러리 마스터의 해시는 복사 시 FXLib.GraphHash 레지스트리 태그로 기록하므로 인덱스 생성 시 로드하지 않음
+ */
+class FXASSETLIB_API FXMaterialDeduplicator
+{
+public:
+	/**
+	 * 원본 마스터 머테리얼과 동일한 그래프를 가진 라이브러리 마스터 머테리얼 검색
+	 * @param SourceMaterialPath 원본 마스터 머테리얼 경로
+	 * @param RootPath 라이브러리 루트 경로
+	 * @param ReferenceMap 원본 -> 라이브러리 복사본 매핑 (마스터가 참조하는 에셋은 미리 처리되어 있어야 함)
+	 * @return 동일한 라이브러리 마스터 경로 (없으면 빈 경로)
+	 */
+	static FSoftObjectPath FindEquivalentMaster(const FSoftObjectPath& SourceMaterialPath, const FString& RootPath, const TMap<FSoftObjectPath, FSoftObjectPath>& ReferenceMap);
+
+	/**
+	 * 새로 복사된 라이브러리 마스터 머테리얼의 해시를 태그로 기록하고 인덱스에 등록
+	 * @param MasterPath 복사된 마스터 머테리얼 경로 (참조 갱신 완료)
+	 * @param RootPath 라이브러리 루트 경로
+	 */
+	static void RegisterMaster(const FSoftObjectPath& MasterPath, const FString& RootPath);
+
+	/**
+	 * 레지스트리에서 에셋이 제거/이름 변경되었을 때 해당 경로를 포함하는 마스터 인덱스 폐기 (다음 검색 시 태그로 재생성)
+	 */
+	static void InvalidateIndexForPath(const FSoftObjectPath& AssetPath);
+
+	/**
+	 * 머테리얼 그래프 해시 계산
+	 * 노드 클래스/프로퍼티 값/연결 구조와 머테리얼 설정을 조합
+	 * (에디터 위치, GUID, 설명은 제외하고 오브젝트 참조는 라이브러리 기준 전체 경로로 비교)
+	 * @param ReferenceMap 참조를 라이브러리 복사본 경로로 바꿀 매핑 (라이브러리 마스터는 nullptr)
+	 * @return 해시 문자열 (계산 불가 시 빈 문자열)
+	 */
+	static FString ComputeMaterialGraphHash(const UMaterial* Material, const TMap<FSoftObjectPath, FSoftObjectPath>* ReferenceMap = nullptr);
+
+private:
+	/**
+	 * RootPath의 마스터 머테리얼 해시 인덱스 반환 (처음 호출 시 폴더의 GraphHash 태그로 생성, 로드 없음)
+	 */
+	static TMap<FString, FSoftObjectPath>& GetMasterIndex(const FString& RootPath);
+};
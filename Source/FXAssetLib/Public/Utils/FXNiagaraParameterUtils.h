@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class UNiagaraComponent;
+struct FFXUserParameterOverride;
+
+/**
+ * 나이아가라 User Parameter 오버라이드 유틸리티 클래스
+ * 파라미터 변형의 캡처(레벨의 컴포넌트 -> 오버라이드)와 적용(오버라이드 -> 스폰된 컴포넌트) 담당
+ */
+class FXASSETLIB_API FFXNiagaraParameterUtils
+{
+public:
+	/**
+	 * 컴포넌트의 User Parameter 중 시스템 기본값과 다른 값을 오버라이드로 수집
+	 * @param NiagaraComponent 값을 읽을 컴포넌트
+	 * @param OutOverrides 수집된 오버라이드 목록 (출력)
+	 * @return 수집된 오버라이드 개수
+	 */
+	static int32 CaptureUserParameterOverrides(
+		const UNiagaraComponent* NiagaraComponent,
+		TArray<FFXUserParameterOverride>& OutOverrides
+	);
+
+	/**
+	 * 오버라이드 목록을 컴포넌트에 적용
+	 * @param NiagaraComponent 적용할 컴포넌트
+	 * @param Overrides 적용할 오버라이드 목록
+	 * @return 적용된 오버라이드 개수
+	 */
+	static int32 ApplyUserParameterOverrides(
+		UNiagaraComponent* NiagaraComponent,
+		const TArray<FFXUserParameterOverride>& Overrides
+	);
+};
@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class UMaterial;
+class UTexture2D;
+class UMaterialExpressionTextureSample;
+struct FExpressionInput;
+
+/**
+ * 텍스처 채널 패킹 결과
+ */
+struct FXASSETLIB_API FFXTexturePackResult
+{
+	int32 PackedTextures = 0;       // 생성된 RGBA 패킹 텍스처 수
+	int32 SamplersSaved = 0;        // 제거된 Texture Sample 노드(샘플러) 수
+	int64 MemoryBytesSaved = 0;     // 절감된 텍스처 메모리 (모든 밉 기준 추정치)
+
+	FFXTexturePackResult& operator+=(const FFXTexturePackResult& Other)
+	{
+		PackedTextures += Other.PackedTextures;
+		SamplersSaved += Other.SamplersSaved;
+		MemoryBytesSaved += Other.MemoryBytesSaved;
+		return *this;
+	}
+};
+
+/**
+ * 텍스처 채널 패킹 유틸리티 클래스
+ * 같은 머테리얼에서 같은 UV로 샘플링되는 단일 채널(그레이스케일) 마스크 텍스처들을
+ * 하나의 RGBA(TC_Masks) 텍스처로 합치고 Expression 연결을 채널 출력으로 재배선
+ */
+class FXASSETLIB_API FXTexturePacker
+{
+public:
+	/**
+	 * 라이브러리에 복사된 머테리얼의 그레이스케일 마스크를 패킹
+	 * @param Material 대상 머테리얼 (라이브러리 복사본)
+	 * @param RootPath 라이브러리 루트 경로 (패킹 텍스처 저장 위치)
+	 * @return 패킹 결과 (절감된 샘플러/메모리)
+	 */
+	static FFXTexturePackResult PackGrayscaleMasks(UMaterial* Material, const FString& RootPath);
+
+private:
+	/**
+	 * 재배선된 입력이 패킹 텍스처의 서로 다른 단일 채널을 읽는지 확인 (잘못된 연결은 에러 로그)
+	 * @param PackedSample 패킹 텍스처를 샘플링하는 노드
+	 * @param ChannelInputs 재배선된 입력과 읽어야 할 채널 (0 = R ... 3 = A)
+	 * @return 모든 입력이 올바른 채널에 연결되었는지 여부
+	 */
+	static bool VerifyChannelWiring(const UMaterialExpressionTextureSample* PackedSample, const TArray<TPair<FExpressionInput*, int32>>& ChannelInputs);
+
+	/**
+	 * 그레이스케일 텍스처 여부 (단일 채널 소스/압축 설정)
+	 */
+	static bool IsGrayscaleTexture(const UTexture2D* Texture);
+
+	/**
+	 * 텍스처들을 채널 순서(R, G, B, A)대로 하나의 텍스처로 합쳐 에셋 생성
+	 * @param ChannelTextures 채널별 소스 텍스처 (최대 4개, 같은 해상도와 샘플링 설정, 설정은 첫 텍스처에서 복사)
+	 * @param RootPath 라이브러리 루트 경로
+	 * @param BaseName 에셋 이름 기반 (머테리얼 이름)
+	 * @return 생성된 텍스처 (실패 시 nullptr)
+	 */
+	static UTexture2D* CreatePackedTexture(const TArray<UTexture2D*, TInlineAllocator<4>>& ChannelTextures, const FString& RootPath, const FString& BaseName);
+};
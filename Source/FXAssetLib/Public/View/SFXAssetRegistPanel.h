@@ -30,6 +30,8 @@ private:
 	FString AssetName;
 	FString CategoryName;
 	FString Hashtags;
+	bool bGenerateCostTiers = false;
+	bool bReferenceOnly = false;
 
 	// 선택된 에셋들
 	TArray<FAssetData> SelectedAssets;
@@ -53,6 +55,8 @@ private:
 	void OnAssetNameChanged(const FText& NewText);
 	void OnCategorySelectionChanged(TSharedPtr<FString> NewSelection, ESelectInfo::Type SelectInfo);
 	void OnHashtagsChanged(const FText& NewText);
+	void OnGenerateCostTiersChanged(ECheckBoxState NewState);
+	void OnReferenceOnlyChanged(ECheckBoxState NewState);
 
 	// 카테고리 목록 로드
 	void LoadCategoryOptions();
@@ -11,6 +11,7 @@
 
 // Forward declarations
 class FFXLibraryState;
+struct FFXVisibleAssetsDelta;
 class SFXLibraryPanelController;
 class SFXCategoryModalWidget;
 
@@ -31,13 +32,26 @@ public:
 	void OnCategoryHovered(TSharedPtr<FName> Category);
 	void OnCategoryUnhovered();
 	void OnBrowseToAsset(TSharedPtr<FSoftObjectPath> AssetPath);
+	void OnSpawnAssetTier(TSharedPtr<FSoftObjectPath> AssetPath, FName TierName);
 	void OnRemoveAssetFromLibrary(TSharedPtr<FSoftObjectPath> AssetPath);
+	void OnCreateVariantFromSelection(TSharedPtr<FSoftObjectPath> AssetPath);
+	void OnFindSimilarAssets(TSharedPtr<FSoftObjectPath> AssetPath);
 	void OnCategorySelected(TSharedPtr<FName> Category);
 	void CloseCategorySubWidget();
 
 	// State 변경 시 UI 업데이트
 	void RefreshUI();
 
+	// 표시 목록 변경 시 타일 뷰 패치 (항목 포인터가 유지되므로 바뀐 타일만 생성)
+	void OnVisibleAssetsChanged(const FFXVisibleAssetsDelta& Delta);
+
+	// 빠른 스폰 팔레트 열기 (Ctrl+K)
+	void OpenQuickSpawnPalette();
+
+	// 키보드 단축키
+	virtual bool SupportsKeyboardFocus() const override { return true; }
+	virtual FReply OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
+
 private:
 	// UI 생성 콜백
 	TSharedRef<ITableRow> GenAssetTile(TSharedPtr<FSoftObjectPath> Item, const TSharedRef<STableViewBase>& Owner);
@@ -45,6 +59,9 @@ private:
 	// 썸네일 풀 가져오기
 	TSharedPtr<class FAssetThumbnailPool> GetThumbnailPool();
 
+	// 검색어 입력
+	void OnSearchTextChanged(const FText& NewText);
+
 	// 카테고리 버튼 이벤트 처리
 	FReply OnCategoryButtonMouseDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent);
 	FReply OnCategoryButtonMouseUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent);
@@ -60,6 +77,7 @@ private:
 	// UI 위젯
 	TSharedPtr<STileView<TSharedPtr<FSoftObjectPath>>> AssetTileView;
 	TSharedPtr<class SBorder> CategoryButton;
+	TSharedPtr<class SSearchBox> SearchBox;
 	TSharedPtr<SFXCategoryModalWidget> CategorySubWidget;
 
 	// 썸네일 풀
@@ -22,6 +22,7 @@ public:
 		SLATE_ARGUMENT(SFXLibraryPanel*, ParentPanel)
 		SLATE_ARGUMENT(TSharedPtr<FAssetThumbnail>, Thumbnail)
 		SLATE_ARGUMENT(FString, AssetName)
+		SLATE_ARGUMENT(bool, bIsReferenced)
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs);
@@ -33,5 +34,6 @@ private:
 	SFXLibraryPanel* ParentPanel;
 	TSharedPtr<FAssetThumbnail> Thumbnail;
 	FString AssetName;
+	bool bIsReferenced = false;
 };
 
@@ -4,16 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
-#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STreeView.h"
 #include "Widgets/Views/STableViewBase.h"
 
 // Forward declarations
 class SFXLibraryPanel;
 class FFXLibraryState;
+struct FFXCategoryTreeNode;
 
 /**
  * 카테고리 모달 위젯
- * 버튼을 누르고 있는 동안 카테고리 목록을 표시하는 모달
+ * 버튼을 누르면 경로형 카테고리 트리(예: Fire/Torch/Small)를 표시하는 모달
+ * 하위 노드 행과 아이콘 브러시는 펼쳐져 화면에 보일 때만 생성
  */
 class FXASSETLIB_API SFXCategoryModalWidget : public SCompoundWidget
 {
@@ -25,13 +27,26 @@ public:
 
 	void Construct(const FArguments& InArgs);
 
+	// 카테고리 트리 구조가 바뀌었으면 다시 그림 (항목 수는 행이 직접 바인딩)
+	void RefreshTree();
+
 	// 카테고리 행 생성
-	TSharedRef<ITableRow> GenerateCategoryRow(TSharedPtr<FName> Item, const TSharedRef<STableViewBase>& Owner);
+	TSharedRef<ITableRow> GenerateCategoryRow(TSharedPtr<FFXCategoryTreeNode> Item, const TSharedRef<STableViewBase>& Owner);
+
+private:
+	void GetCategoryChildren(TSharedPtr<FFXCategoryTreeNode> Item, TArray<TSharedPtr<FFXCategoryTreeNode>>& OutChildren);
+	void OnCategoryExpansionChanged(TSharedPtr<FFXCategoryTreeNode> Item, bool bExpanded);
+
+	// State의 펼침 상태와 선택된 카테고리 위치 복원
+	void RestoreExpansion();
+
+	// 카테고리 아이콘 브러시 (처음 표시될 때 로드, 모달이 닫힐 때 해제)
+	const FSlateBrush* GetCategoryIconBrush(FName CategoryName);
 
 private:
 	SFXLibraryPanel* ParentPanel;
 	TSharedPtr<FFXLibraryState> State;
-	TSharedPtr<SListView<TSharedPtr<FName>>> CategoryListView;
-	TArray<TSharedPtr<FName>>* CategoryListSource = nullptr;
+	TSharedPtr<STreeView<TSharedPtr<FFXCategoryTreeNode>>> CategoryTreeView;
+	TMap<FName, TSharedPtr<FSlateBrush>> IconBrushes;
+	uint32 TreeVersion = 0;
 };
-
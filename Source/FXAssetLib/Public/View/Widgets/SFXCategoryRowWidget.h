@@ -4,23 +4,23 @@
 
 #include "CoreMinimal.h"
 #include "Widgets/Views/STableRow.h"
-#include "UObject/SoftObjectPath.h"
+#include "Model/FXCategoryTree.h"
 
 // Forward declarations
 class SFXLibraryPanel;
 
 /**
  * 카테고리 행 위젯
- * 카테고리 리스트에서 각 카테고리를 표시하는 위젯
+ * 카테고리 트리에서 각 노드를 표시하는 위젯 (아이콘, 마지막 경로 구간, 하위 포함 항목 수)
+ * 카테고리 노드는 클릭하면 선택, 폴더 노드는 펼치기/접기
  */
-class FXASSETLIB_API SFXCategoryRowWidget : public STableRow<TSharedPtr<FName>>
+class FXASSETLIB_API SFXCategoryRowWidget : public STableRow<TSharedPtr<FFXCategoryTreeNode>>
 {
 public:
 	SLATE_BEGIN_ARGS(SFXCategoryRowWidget) {}
-		SLATE_ARGUMENT(TSharedPtr<FName>, CategoryName)
-		SLATE_ARGUMENT(FSlateBrush*, BackgroundBrush)
+		SLATE_ARGUMENT(TSharedPtr<FFXCategoryTreeNode>, Node)
+		SLATE_ARGUMENT(const FSlateBrush*, IconBrush)
 		SLATE_ARGUMENT(SFXLibraryPanel*, ParentPanel)
-		SLATE_ARGUMENT(TSharedPtr<FName>, HoveredCategory)
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable);
@@ -29,9 +29,9 @@ public:
 	virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
 
 private:
-	TSharedPtr<FName> CategoryName;
-	FSlateBrush* BackgroundBrush;
-	SFXLibraryPanel* ParentPanel;
-	TSharedPtr<FName> HoveredCategory;
-};
+	const FSlateBrush* GetIconBrush() const;
 
+	TSharedPtr<FFXCategoryTreeNode> Node;
+	const FSlateBrush* IconBrush = nullptr;
+	SFXLibraryPanel* ParentPanel = nullptr;
+};
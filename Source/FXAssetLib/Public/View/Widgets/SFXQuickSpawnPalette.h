@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableViewBase.h"
+#include "UObject/SoftObjectPath.h"
+#include "Model/FXFuzzyMatcher.h"
+
+// Forward declarations
+class FFXLibraryState;
+class SSearchBox;
+
+// 팔레트에서 항목 선택 (스폰할 항목 경로)
+DECLARE_DELEGATE_OneParam(FOnFXQuickSpawn, TSharedPtr<FSoftObjectPath>);
+
+/**
+ * 빠른 스폰 팔레트 결과 항목
+ */
+struct FFXQuickSpawnItem
+{
+	FSoftObjectPath AssetPath;
+	FString DisplayName;
+	FString CategoryText;
+	int32 Distance = 0;
+};
+
+/**
+ * 빠른 스폰 팔레트
+ * 모든 카테고리의 항목 이름을 오타 허용 매칭으로 찾고 Enter로 스폰 (Up/Down 선택, Esc 닫기)
+ */
+class FXASSETLIB_API SFXQuickSpawnPalette : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SFXQuickSpawnPalette) {}
+		SLATE_ARGUMENT(TSharedPtr<FFXLibraryState>, State)
+		SLATE_EVENT(FOnFXQuickSpawn, OnSpawn)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	// 팔레트를 연 직후 키보드 포커스를 받을 위젯
+	TSharedPtr<SWidget> GetWidgetToFocus() const;
+
+private:
+	// 라이브러리 항목으로 후보 구성 (열 때 1회)
+	void BuildCandidates();
+
+	// 검색어 변경 시 결과 갱신 (이어 쓰면 이전 결과 풀만 재검사)
+	void OnQueryChanged(const FText& NewText);
+	FReply OnQueryKeyDown(const FGeometry& MyGeometry, const FKeyEvent& KeyEvent);
+
+	TSharedRef<ITableRow> GenerateResultRow(TSharedPtr<FFXQuickSpawnItem> Item, const TSharedRef<STableViewBase>& Owner);
+	void OnResultDoubleClicked(TSharedPtr<FFXQuickSpawnItem> Item);
+
+	// 선택 이동 (Delta: -1 위, +1 아래)
+	void MoveSelection(int32 Delta);
+
+	// 항목 스폰 후 팔레트 닫기
+	void SpawnItem(TSharedPtr<FFXQuickSpawnItem> Item);
+	void Close();
+
+	FText GetStatusText() const;
+
+private:
+	TSharedPtr<FFXLibraryState> State;
+	FOnFXQuickSpawn OnSpawn;
+
+	// 후보 (매처 후보 인덱스 -> 항목 경로)
+	// 경로 ID는 카테고리 편집 후 다른 항목에 재사용될 수 있으므로 팔레트가 열려 있는 동안 보관하지 않음
+	FFXFuzzyMatcher Matcher;
+	TArray<FSoftObjectPath> CandidatePaths;
+
+	TArray<TSharedPtr<FFXQuickSpawnItem>> Results;
+	TSharedPtr<SSearchBox> SearchBox;
+	TSharedPtr<SListView<TSharedPtr<FFXQuickSpawnItem>>> ResultListView;
+
+	// 마지막 검색 측정값 (상태 표시)
+	double LastMatchMs = 0.0;
+};